@@ -0,0 +1,607 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+// Microbenchmarks for the arithmetic operators of every arithmetic simd
+// type, matrix multiplication for every size, quat multiplication and
+// rotation, and the transform factory functions. Each benchmark applies
+// one operation to a small working set of independent inputs and reports
+// the throughput in ns and cycles per operation.
+//
+// Usage: tue.bench [--json FILE] [filter...]
+//
+// A filter selects every benchmark whose group (simd, matmult, quat,
+// transform), name, or type it equals. With no filters, every benchmark
+// is run. With --json, the results are also written to FILE as JSON.
+//
+// Cycles are read from the time-stamp counter where there is one, so on
+// CPUs that change frequency they're reference cycles rather than core
+// cycles. Elsewhere only ns/op is reported. Build with optimizations and
+// the instruction sets you care about enabled (e.g., -O2 -march=native).
+
+#include <tue/mat.hpp>
+#include <tue/math.hpp>
+#include <tue/quat.hpp>
+#include <tue/simd.hpp>
+#include <tue/transform.hpp>
+#include <tue/vec.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define TUE_BENCH_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TUE_BENCH_TSC
+#endif
+
+namespace
+{
+    using namespace tue;
+
+    constexpr std::size_t working_set_size = 256;
+    constexpr int trial_count = 3;
+    constexpr auto min_trial_duration = std::chrono::milliseconds(10);
+
+    struct result
+    {
+        std::string group;
+        std::string name;
+        std::string type;
+        double ns_per_op;
+        double cycles_per_op;
+    };
+
+    std::vector<std::string> filters;
+    std::vector<result> results;
+
+    bool selected(
+        const std::string& group,
+        const std::string& name,
+        const std::string& type)
+    {
+        return filters.empty() || std::any_of(
+            filters.begin(), filters.end(), [&](const std::string& f)
+        {
+            return f == group || f == name || f == type;
+        });
+    }
+
+    std::uint64_t read_cycle_counter() noexcept
+    {
+#ifdef TUE_BENCH_TSC
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    // A fixed-size array of X's. std::allocator needn't honor the
+    // alignment of the wider simd types before C++17, so the array is
+    // carved out of a byte buffer instead of using std::vector.
+    template<typename X>
+    class working_set
+    {
+        static_assert(std::is_trivially_destructible<X>::value, "");
+
+        static constexpr std::size_t size_in_bytes =
+            sizeof(X) * working_set_size;
+
+        std::unique_ptr<unsigned char[]> storage_;
+        X* data_;
+
+    public:
+        working_set()
+            : storage_(new unsigned char[size_in_bytes + alignof(X)])
+        {
+            void* p = storage_.get();
+            auto space = size_in_bytes + alignof(X);
+            data_ = static_cast<X*>(
+                std::align(alignof(X), size_in_bytes, p, space));
+            for (std::size_t i = 0; i < working_set_size; ++i)
+            {
+                new(data_ + i) X();
+            }
+        }
+
+        const X& operator[](std::size_t i) const noexcept
+        {
+            return data_[i];
+        }
+
+        X& operator[](std::size_t i) noexcept
+        {
+            return data_[i];
+        }
+    };
+
+    /*
+     * Input generation
+     */
+    template<typename T>
+    std::enable_if_t<std::is_floating_point<T>::value, T>
+    make_component(std::size_t i) noexcept
+    {
+        return T(1) + static_cast<T>(i % 97) / T(97);
+    }
+
+    // Small and nonzero, so no operator overflows or divides by zero.
+    template<typename T>
+    std::enable_if_t<std::is_integral<T>::value, T>
+    make_component(std::size_t i) noexcept
+    {
+        return static_cast<T>(1 + i % 7);
+    }
+
+    // Fills a working set of X's, which have components of type T.
+    template<typename X, typename T>
+    working_set<X> make_inputs(std::size_t seed)
+    {
+        constexpr auto component_count = sizeof(X) / sizeof(T);
+        working_set<X> result;
+        for (std::size_t i = 0; i < working_set_size; ++i)
+        {
+            auto data = reinterpret_cast<T*>(&result[i]);
+            for (std::size_t j = 0; j < component_count; ++j)
+            {
+                data[j] = make_component<T>(
+                    seed * 31 + i * component_count + j);
+            }
+        }
+        return result;
+    }
+
+    /*
+     * Timing
+     */
+    template<typename Pass>
+    void time_pass(Pass pass, double& ns, double& cycles)
+    {
+        using clock = std::chrono::steady_clock;
+        pass();
+
+        std::size_t repetitions = 1;
+        for (;; repetitions *= 2)
+        {
+            const auto start = clock::now();
+            for (std::size_t i = 0; i < repetitions; ++i)
+            {
+                pass();
+            }
+            if (clock::now() - start >= min_trial_duration)
+            {
+                break;
+            }
+        }
+
+        ns = std::numeric_limits<double>::infinity();
+        cycles = std::numeric_limits<double>::infinity();
+        for (int trial = 0; trial < trial_count; ++trial)
+        {
+            const auto start = clock::now();
+            const auto start_cycles = read_cycle_counter();
+            for (std::size_t i = 0; i < repetitions; ++i)
+            {
+                pass();
+            }
+            const auto elapsed_cycles = read_cycle_counter() - start_cycles;
+            const std::chrono::duration<double, std::nano> elapsed =
+                clock::now() - start;
+
+            const auto ops = static_cast<double>(
+                repetitions * working_set_size);
+            ns = std::min(ns, elapsed.count() / ops);
+            cycles = std::min(
+                cycles, static_cast<double>(elapsed_cycles) / ops);
+        }
+    }
+
+    // Times f applied to each pair of lhs and rhs.
+    template<typename L, typename R, typename F>
+    void run(
+        const std::string& group,
+        const std::string& name,
+        const std::string& type,
+        const working_set<L>& lhs,
+        const working_set<R>& rhs,
+        F f)
+    {
+        if (!selected(group, name, type))
+        {
+            return;
+        }
+
+        working_set<decltype(f(lhs[0], rhs[0]))> out;
+        result r = { group, name, type, 0, 0 };
+        time_pass([&]
+        {
+            for (std::size_t i = 0; i < working_set_size; ++i)
+            {
+                out[i] = f(lhs[i], rhs[i]);
+            }
+            // Keep the compiler from hoisting the pass out of the
+            // repetition loop.
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        }, r.ns_per_op, r.cycles_per_op);
+
+#ifdef TUE_BENCH_TSC
+        std::printf(
+            "%-10s %-16s %-24s %10.3f %10.3f\n",
+            group.c_str(), name.c_str(), type.c_str(),
+            r.ns_per_op, r.cycles_per_op);
+#else
+        std::printf(
+            "%-10s %-16s %-24s %10.3f %10s\n",
+            group.c_str(), name.c_str(), type.c_str(),
+            r.ns_per_op, "-");
+#endif
+        results.push_back(r);
+    }
+
+    bool write_json(const char* path)
+    {
+        const auto file = std::fopen(path, "w");
+        if (!file)
+        {
+            return false;
+        }
+
+        std::fprintf(file, "{\n  \"benchmarks\": [");
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const auto& r = results[i];
+            std::fprintf(file,
+                "%s\n    {\"group\": \"%s\", \"name\": \"%s\", "
+                "\"type\": \"%s\", \"ns_per_op\": %.4f, ",
+                i == 0 ? "" : ",",
+                r.group.c_str(), r.name.c_str(), r.type.c_str(),
+                r.ns_per_op);
+#ifdef TUE_BENCH_TSC
+            std::fprintf(file, "\"cycles_per_op\": %.4f}", r.cycles_per_op);
+#else
+            std::fprintf(file, "\"cycles_per_op\": null}");
+#endif
+        }
+        std::fprintf(file, "\n  ]\n}\n");
+        return std::fclose(file) == 0;
+    }
+
+    /*
+     * Type names
+     */
+    template<typename T>
+    std::string component_name()
+    {
+        return std::string(std::is_floating_point<T>::value ? "float"
+            : std::is_signed<T>::value ? "int" : "uint")
+            + std::to_string(sizeof(T) * 8);
+    }
+
+    template<typename T>
+    std::string prefix()
+    {
+        return std::is_same<T, float>::value ? "f" : "d";
+    }
+
+    template<typename T, int C, int R>
+    std::string mat_name()
+    {
+        return prefix<T>() + "mat"
+            + std::to_string(C) + "x" + std::to_string(R);
+    }
+
+    /*
+     * simd
+     */
+    template<typename T, int N>
+    std::enable_if_t<std::is_signed<T>::value>
+    bench_simd_signed(
+        const std::string& type,
+        const working_set<simd<T, N>>& lhs,
+        const working_set<simd<T, N>>& rhs)
+    {
+        run("simd", "operator-(unary)", type, lhs, rhs,
+            [](const auto& x, const auto&) { return -x; });
+    }
+
+    template<typename T, int N>
+    std::enable_if_t<!std::is_signed<T>::value>
+    bench_simd_signed(
+        const std::string&,
+        const working_set<simd<T, N>>&,
+        const working_set<simd<T, N>>&)
+    {
+    }
+
+    template<typename T, int N>
+    std::enable_if_t<std::is_integral<T>::value>
+    bench_simd_integral(
+        const std::string& type,
+        const working_set<simd<T, N>>& lhs,
+        const working_set<simd<T, N>>& rhs)
+    {
+        run("simd", "operator%", type, lhs, rhs,
+            [](const auto& x, const auto& y) { return x % y; });
+        run("simd", "operator~", type, lhs, rhs,
+            [](const auto& x, const auto&) { return ~x; });
+        run("simd", "operator&", type, lhs, rhs,
+            [](const auto& x, const auto& y) { return x & y; });
+        run("simd", "operator|", type, lhs, rhs,
+            [](const auto& x, const auto& y) { return x | y; });
+        run("simd", "operator^", type, lhs, rhs,
+            [](const auto& x, const auto& y) { return x ^ y; });
+        run("simd", "operator<<", type, lhs, rhs,
+            [](const auto& x, const auto&) { return x << 3; });
+        run("simd", "operator>>", type, lhs, rhs,
+            [](const auto& x, const auto&) { return x >> 3; });
+    }
+
+    template<typename T, int N>
+    std::enable_if_t<!std::is_integral<T>::value>
+    bench_simd_integral(
+        const std::string&,
+        const working_set<simd<T, N>>&,
+        const working_set<simd<T, N>>&)
+    {
+    }
+
+    template<typename T, int N>
+    bool bench_simd()
+    {
+        const auto type = component_name<T>() + "x" + std::to_string(N);
+        const auto lhs = make_inputs<simd<T, N>, T>(1);
+        const auto rhs = make_inputs<simd<T, N>, T>(2);
+
+        run("simd", "operator+", type, lhs, rhs,
+            [](const auto& x, const auto& y) { return x + y; });
+        run("simd", "operator-", type, lhs, rhs,
+            [](const auto& x, const auto& y) { return x - y; });
+        run("simd", "operator*", type, lhs, rhs,
+            [](const auto& x, const auto& y) { return x * y; });
+        run("simd", "operator/", type, lhs, rhs,
+            [](const auto& x, const auto& y) { return x / y; });
+        bench_simd_signed<T, N>(type, lhs, rhs);
+        bench_simd_integral<T, N>(type, lhs, rhs);
+        return true;
+    }
+
+    template<typename T, int... Ns>
+    void bench_simd_all()
+    {
+        const bool benched[] = { bench_simd<T, Ns>()... };
+        static_cast<void>(benched);
+    }
+
+    /*
+     * matmult
+     */
+    template<typename T, int C, int R>
+    bool bench_matmult_mv()
+    {
+        const auto m = mat_name<T, C, R>();
+        const auto v = prefix<T>() + "vec";
+        const auto mats = make_inputs<mat<T, C, R>, T>(1);
+        const auto lhs_vecs = make_inputs<vec<T, R>, T>(2);
+        const auto rhs_vecs = make_inputs<vec<T, C>, T>(3);
+
+        run("matmult", "vec*mat", v + std::to_string(R) + "*" + m,
+            lhs_vecs, mats,
+            [](const auto& x, const auto& y) { return x * y; });
+        run("matmult", "mat*vec", m + "*" + v + std::to_string(C),
+            mats, rhs_vecs,
+            [](const auto& x, const auto& y) { return x * y; });
+        return true;
+    }
+
+    // Times mat<T, N, R> * mat<T, C, N>.
+    template<typename T, int N, int R, int C>
+    bool bench_matmult_mm()
+    {
+        const auto lhs = make_inputs<mat<T, N, R>, T>(1);
+        const auto rhs = make_inputs<mat<T, C, N>, T>(2);
+        run("matmult", "mat*mat",
+            mat_name<T, N, R>() + "*" + mat_name<T, C, N>(), lhs, rhs,
+            [](const auto& x, const auto& y) { return x * y; });
+        return true;
+    }
+
+    template<typename T, int N, int R>
+    bool bench_matmult_row()
+    {
+        const bool benched[] = {
+            bench_matmult_mv<T, N, R>(),
+            bench_matmult_mm<T, N, R, 2>(),
+            bench_matmult_mm<T, N, R, 3>(),
+            bench_matmult_mm<T, N, R, 4>(),
+        };
+        static_cast<void>(benched);
+        return true;
+    }
+
+    template<typename T, int N>
+    bool bench_matmult_column()
+    {
+        const bool benched[] = {
+            bench_matmult_row<T, N, 2>(),
+            bench_matmult_row<T, N, 3>(),
+            bench_matmult_row<T, N, 4>(),
+        };
+        static_cast<void>(benched);
+        return true;
+    }
+
+    template<typename T>
+    void bench_matmult_all()
+    {
+        const bool benched[] = {
+            bench_matmult_column<T, 2>(),
+            bench_matmult_column<T, 3>(),
+            bench_matmult_column<T, 4>(),
+        };
+        static_cast<void>(benched);
+    }
+
+    /*
+     * quat
+     */
+    template<typename T>
+    void bench_quat()
+    {
+        const auto q = prefix<T>() + "quat";
+        const auto v = prefix<T>() + "vec3";
+        const auto lhs = make_inputs<quat<T>, T>(1);
+        const auto rhs = make_inputs<quat<T>, T>(2);
+        const auto vecs = make_inputs<vec3<T>, T>(3);
+
+        run("quat", "quat*quat", q + "*" + q, lhs, rhs,
+            [](const auto& x, const auto& y) { return x * y; });
+        run("quat", "vec3*quat", v + "*" + q, vecs, rhs,
+            [](const auto& x, const auto& y) { return x * y; });
+    }
+
+    /*
+     * transform
+     */
+    template<typename T>
+    void bench_transform()
+    {
+        const auto p = prefix<T>();
+        const auto t = std::string(std::is_same<T, float>::value
+            ? "float" : "double");
+        const auto angles = make_inputs<T, T>(1);
+        const auto vec3s = make_inputs<vec3<T>, T>(2);
+        const auto vec4s = make_inputs<vec4<T>, T>(3);
+        const auto quats = make_inputs<quat<T>, T>(4);
+
+        run("transform", "axis_angle", p + "vec3", vec3s, angles,
+            [](const auto& v, const auto&)
+        {
+            return transform::axis_angle(v);
+        });
+        run("transform", "rotation_vec", p + "vec3," + t, vec3s, angles,
+            [](const auto& axis, const auto& angle)
+        {
+            return transform::rotation_vec(axis, angle);
+        });
+        run("transform", "rotation_quat", p + "vec3," + t, vec3s, angles,
+            [](const auto& axis, const auto& angle)
+        {
+            return transform::rotation_quat(axis, angle);
+        });
+        run("transform", "rotation_quat", p + "vec3", vec3s, angles,
+            [](const auto& v, const auto&)
+        {
+            return transform::rotation_quat(v);
+        });
+        run("transform", "translation_mat", p + "vec3", vec3s, angles,
+            [](const auto& v, const auto&)
+        {
+            return transform::translation_mat(v);
+        });
+        run("transform", "rotation_mat", t, angles, angles,
+            [](const auto& angle, const auto&)
+        {
+            return transform::rotation_mat(angle);
+        });
+        run("transform", "rotation_mat", p + "vec3," + t, vec3s, angles,
+            [](const auto& axis, const auto& angle)
+        {
+            return transform::rotation_mat(axis, angle);
+        });
+        run("transform", "rotation_mat", p + "vec3", vec3s, angles,
+            [](const auto& v, const auto&)
+        {
+            return transform::rotation_mat(v);
+        });
+        run("transform", "rotation_mat", p + "quat", quats, angles,
+            [](const auto& q, const auto&)
+        {
+            return transform::rotation_mat(q);
+        });
+        run("transform", "scale_mat", p + "vec3", vec3s, angles,
+            [](const auto& v, const auto&)
+        {
+            return transform::scale_mat(v);
+        });
+        run("transform", "perspective_mat", p + "vec4", vec4s, angles,
+            [](const auto& v, const auto&)
+        {
+            return transform::perspective_mat(v[0], v[1], v[2], v[3]);
+        });
+        run("transform", "ortho_mat", p + "vec4", vec4s, angles,
+            [](const auto& v, const auto&)
+        {
+            return transform::ortho_mat(v[0], v[1], v[2], v[3]);
+        });
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const char* json_path = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--json") == 0)
+        {
+            if (++i == argc)
+            {
+                std::fprintf(stderr, "--json requires a file name\n");
+                return 2;
+            }
+            json_path = argv[i];
+        }
+        else
+        {
+            filters.emplace_back(argv[i]);
+        }
+    }
+
+    std::printf(
+        "%-10s %-16s %-24s %10s %10s\n",
+        "group", "name", "type", "ns/op", "cycles/op");
+
+    bench_simd_all<float, 2, 4, 8, 16>();
+    bench_simd_all<double, 2, 4, 8>();
+    bench_simd_all<std::int8_t, 2, 4, 8, 16, 32, 64>();
+    bench_simd_all<std::int16_t, 2, 4, 8, 16, 32>();
+    bench_simd_all<std::int32_t, 2, 4, 8, 16>();
+    bench_simd_all<std::int64_t, 2, 4, 8>();
+    bench_simd_all<std::uint8_t, 2, 4, 8, 16, 32, 64>();
+    bench_simd_all<std::uint16_t, 2, 4, 8, 16, 32>();
+    bench_simd_all<std::uint32_t, 2, 4, 8, 16>();
+    bench_simd_all<std::uint64_t, 2, 4, 8>();
+
+    bench_matmult_all<float>();
+    bench_matmult_all<double>();
+
+    bench_quat<float>();
+    bench_quat<double>();
+
+    bench_transform<float>();
+    bench_transform<double>();
+
+    if (json_path && !write_json(json_path))
+    {
+        std::fprintf(stderr, "Couldn't write %s\n", json_path);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,514 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+// Sweeps every math:: function that has an SIMD kernel over its domain and
+// reports, for the scalar <cmath> path, the generic per-component fallback,
+// and the accelerated simd path:
+//
+// - the max and mean error in ulps against a long double reference, and
+// - the throughput in ns per element.
+//
+// Usage: tue.mathbench [function...]
+//
+// With no arguments, every function is measured. Otherwise only the named
+// functions are. Build with optimizations and the instruction sets you care
+// about enabled (e.g., -O2 -march=native), since that's what selects the
+// accelerated kernels.
+
+#include <tue/math.hpp>
+#include <tue/simd.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using namespace tue;
+
+    // How samples are spread over a domain. Functions whose interesting
+    // behavior spans many orders of magnitude (log, recip, etc.) are
+    // sampled uniformly in the exponent instead of the value.
+    enum class spread
+    {
+        linear,
+        logarithmic,
+    };
+
+    struct domain
+    {
+        double lo;
+        double hi;
+        spread s;
+    };
+
+    constexpr std::size_t error_sample_count = 1 << 16;
+    constexpr std::size_t timing_sample_count = 4096;
+    constexpr auto min_timing_duration = std::chrono::milliseconds(20);
+
+    int argument_count;
+    char** arguments;
+    volatile double sink;
+
+    bool selected(const char* name) noexcept
+    {
+        if (argument_count <= 1)
+        {
+            return true;
+        }
+        for (int i = 1; i < argument_count; ++i)
+        {
+            if (std::strcmp(arguments[i], name) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<typename T>
+    const char* type_name() noexcept
+    {
+        return sizeof(T) == sizeof(float) ? "float" : "double";
+    }
+
+    template<typename T>
+    std::vector<T> make_samples(
+        const domain& d, std::size_t count, unsigned seed)
+    {
+        std::mt19937_64 rng(seed);
+        std::vector<T> result(count);
+        if (d.s == spread::linear)
+        {
+            std::uniform_real_distribution<double> dist(d.lo, d.hi);
+            for (auto& x : result)
+            {
+                x = static_cast<T>(dist(rng));
+            }
+        }
+        else
+        {
+            std::uniform_real_distribution<double> dist(
+                std::log2(d.lo), std::log2(d.hi));
+            for (auto& x : result)
+            {
+                x = static_cast<T>(std::exp2(dist(rng)));
+            }
+        }
+        return result;
+    }
+
+    // The distance between actual and expected in units of the spacing
+    // between T's around expected.
+    template<typename T>
+    double ulp_error(T actual, long double expected) noexcept
+    {
+        constexpr auto infinity = std::numeric_limits<double>::infinity();
+        if (std::isnan(expected) || std::isnan(actual))
+        {
+            return std::isnan(expected) && std::isnan(actual) ? 0 : infinity;
+        }
+
+        const auto rounded = static_cast<T>(expected);
+        if (actual == rounded)
+        {
+            return 0;
+        }
+        if (std::isinf(rounded) || std::isinf(actual))
+        {
+            return infinity;
+        }
+
+        int exponent;
+        std::frexp(rounded, &exponent);
+        exponent = std::max(exponent, std::numeric_limits<T>::min_exponent);
+        const auto ulp = std::ldexp(
+            1.0L, exponent - std::numeric_limits<T>::digits);
+        return static_cast<double>(
+            std::abs(static_cast<long double>(actual) - expected) / ulp);
+    }
+
+    template<typename T, typename F>
+    void scalar_loop(
+        F f, const T* x, const T* y, T* out, std::size_t count) noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            out[i] = f(x[i], y[i]);
+        }
+    }
+
+    template<typename T, int N, typename F>
+    void simd_loop(
+        F f, const T* x, const T* y, T* out, std::size_t count) noexcept
+    {
+        for (std::size_t i = 0; i < count; i += N)
+        {
+            f(simd<T, N>::loadu(x + i), simd<T, N>::loadu(y + i))
+                .storeu(out + i);
+        }
+    }
+
+    template<typename Loop>
+    double ns_per_element(Loop loop, std::size_t count)
+    {
+        using clock = std::chrono::steady_clock;
+        loop();
+        for (std::size_t repetitions = 1; ; repetitions *= 2)
+        {
+            const auto start = clock::now();
+            for (std::size_t i = 0; i < repetitions; ++i)
+            {
+                loop();
+            }
+            const auto elapsed = clock::now() - start;
+            if (elapsed >= min_timing_duration)
+            {
+                const std::chrono::duration<double, std::nano> ns = elapsed;
+                return ns.count() / static_cast<double>(repetitions * count);
+            }
+        }
+    }
+
+    template<typename T>
+    struct samples
+    {
+        std::vector<T> x;
+        std::vector<T> y;
+        std::vector<long double> expected;
+        std::vector<T> timing_x;
+        std::vector<T> timing_y;
+    };
+
+    template<typename T, typename Loop>
+    void report(
+        const char* name,
+        const char* type,
+        const char* path,
+        const domain& d,
+        const samples<T>& s,
+        Loop loop)
+    {
+        std::vector<T> out(error_sample_count);
+        loop(s.x.data(), s.y.data(), out.data(), error_sample_count);
+
+        double max_error = 0;
+        double total_error = 0;
+        for (std::size_t i = 0; i < error_sample_count; ++i)
+        {
+            const auto error = ulp_error(out[i], s.expected[i]);
+            max_error = std::max(max_error, error);
+            total_error += error;
+        }
+
+        std::vector<T> timing_out(timing_sample_count);
+        const auto ns = ns_per_element([&]
+        {
+            loop(
+                s.timing_x.data(),
+                s.timing_y.data(),
+                timing_out.data(),
+                timing_sample_count);
+        }, timing_sample_count);
+        sink = sink + static_cast<double>(timing_out[0]);
+
+        std::printf(
+            "%-13s %-10s %-9s [%9.3g, %9.3g] %10.4g %10.4g %9.3f\n",
+            name, type, path, d.lo, d.hi,
+            max_error, total_error / error_sample_count, ns);
+    }
+
+    template<typename T, int N>
+    const char* simd_name() noexcept
+    {
+        static char name[16];
+        std::snprintf(
+            name, sizeof(name), "float%dx%d", int(sizeof(T) * 8), N);
+        return name;
+    }
+
+    template<typename T, int N, typename Fallback, typename Accelerated>
+    bool measure_simd(
+        const char* name,
+        const domain& d,
+        const samples<T>& s,
+        Fallback fallback,
+        Accelerated accelerated)
+    {
+        report(name, simd_name<T, N>(), "fallback", d, s,
+            [&](const T* x, const T* y, T* out, std::size_t count)
+        {
+            simd_loop<T, N>(fallback, x, y, out, count);
+        });
+        report(name, simd_name<T, N>(), "simd", d, s,
+            [&](const T* x, const T* y, T* out, std::size_t count)
+        {
+            simd_loop<T, N>(accelerated, x, y, out, count);
+        });
+        return true;
+    }
+
+    // Measures one function with component type T. accelerated is called
+    // with both T's and simd's. The scalar path is measured once, and the
+    // fallback and accelerated paths once for each component count in Ns.
+    template<typename T, int... Ns,
+        typename Reference, typename Fallback, typename Accelerated>
+    void measure(
+        const char* name,
+        const domain& x_domain,
+        const domain& y_domain,
+        Reference reference,
+        Fallback fallback,
+        Accelerated accelerated)
+    {
+        if (!selected(name))
+        {
+            return;
+        }
+
+        samples<T> s;
+        s.x = make_samples<T>(x_domain, error_sample_count, 1);
+        s.y = make_samples<T>(y_domain, error_sample_count, 2);
+        s.timing_x = make_samples<T>(x_domain, timing_sample_count, 3);
+        s.timing_y = make_samples<T>(y_domain, timing_sample_count, 4);
+        for (std::size_t i = 0; i < error_sample_count; ++i)
+        {
+            s.expected.push_back(reference(
+                static_cast<long double>(s.x[i]),
+                static_cast<long double>(s.y[i])));
+        }
+
+        report(name, type_name<T>(), "scalar", x_domain, s,
+            [&](const T* x, const T* y, T* out, std::size_t count)
+        {
+            scalar_loop(accelerated, x, y, out, count);
+        });
+
+        const bool measured[] = {
+            measure_simd<T, Ns>(name, x_domain, s, fallback, accelerated)...
+        };
+        static_cast<void>(measured);
+    }
+
+    template<typename T, int... Ns>
+    void measure_all()
+    {
+        using std::abs;
+        const domain none = { 0, 0, spread::linear };
+
+        measure<T, Ns...>(
+            "sin",
+            { -100, 100, spread::linear }, none,
+            [](long double x, long double) { return std::sin(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::sin_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::sin(x); });
+
+        measure<T, Ns...>(
+            "cos",
+            { -100, 100, spread::linear }, none,
+            [](long double x, long double) { return std::cos(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::cos_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::cos(x); });
+
+        measure<T, Ns...>(
+            "sin_accurate",
+            { -1e6, 1e6, spread::linear }, none,
+            [](long double x, long double) { return std::sin(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::sin_accurate_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::sin_accurate(x); });
+
+        measure<T, Ns...>(
+            "cos_accurate",
+            { -1e6, 1e6, spread::linear }, none,
+            [](long double x, long double) { return std::cos(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::cos_accurate_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::cos_accurate(x); });
+
+        measure<T, Ns...>(
+            "tan",
+            { -1.5, 1.5, spread::linear }, none,
+            [](long double x, long double) { return std::tan(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::tan_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::tan(x); });
+
+        measure<T, Ns...>(
+            "asin",
+            { -1, 1, spread::linear }, none,
+            [](long double x, long double) { return std::asin(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::asin_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::asin(x); });
+
+        measure<T, Ns...>(
+            "acos",
+            { -1, 1, spread::linear }, none,
+            [](long double x, long double) { return std::acos(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::acos_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::acos(x); });
+
+        measure<T, Ns...>(
+            "atan",
+            { -100, 100, spread::linear }, none,
+            [](long double x, long double) { return std::atan(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::atan_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::atan(x); });
+
+        measure<T, Ns...>(
+            "atan2",
+            { -10, 10, spread::linear }, { -10, 10, spread::linear },
+            [](long double y, long double x) { return std::atan2(y, x); },
+            [](const auto& y, const auto& x)
+            {
+                return tue::detail_::atan2_ss<T>(y, x);
+            },
+            [](const auto& y, const auto& x) { return math::atan2(y, x); });
+
+        measure<T, Ns...>(
+            "exp",
+            { -80, 80, spread::linear }, none,
+            [](long double x, long double) { return std::exp(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::exp_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::exp(x); });
+
+        measure<T, Ns...>(
+            "exp2",
+            { -120, 120, spread::linear }, none,
+            [](long double x, long double) { return std::exp2(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::exp2_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::exp2(x); });
+
+        measure<T, Ns...>(
+            "log",
+            { 1e-30, 1e30, spread::logarithmic }, none,
+            [](long double x, long double) { return std::log(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::log_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::log(x); });
+
+        measure<T, Ns...>(
+            "log2",
+            { 1e-30, 1e30, spread::logarithmic }, none,
+            [](long double x, long double) { return std::log2(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::log2_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::log2(x); });
+
+        measure<T, Ns...>(
+            "pow",
+            { 1e-2, 1e2, spread::logarithmic }, { -4, 4, spread::linear },
+            [](long double x, long double y) { return std::pow(x, y); },
+            [](const auto& x, const auto& y)
+            {
+                return tue::detail_::pow_ss<T>(x, y);
+            },
+            [](const auto& x, const auto& y) { return math::pow(x, y); });
+
+        measure<T, Ns...>(
+            "recip",
+            { 1e-3, 1e3, spread::logarithmic }, none,
+            [](long double x, long double) { return 1 / x; },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::recip_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::recip(x); });
+
+        measure<T, Ns...>(
+            "recip_fast",
+            { 1e-3, 1e3, spread::logarithmic }, none,
+            [](long double x, long double) { return 1 / x; },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::recip_fast_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::recip_fast(x); });
+
+        measure<T, Ns...>(
+            "sqrt",
+            { 1e-3, 1e3, spread::logarithmic }, none,
+            [](long double x, long double) { return std::sqrt(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::sqrt_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::sqrt(x); });
+
+        measure<T, Ns...>(
+            "rsqrt",
+            { 1e-3, 1e3, spread::logarithmic }, none,
+            [](long double x, long double) { return 1 / std::sqrt(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::rsqrt_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::rsqrt(x); });
+
+        measure<T, Ns...>(
+            "rsqrt_fast",
+            { 1e-3, 1e3, spread::logarithmic }, none,
+            [](long double x, long double) { return 1 / std::sqrt(x); },
+            [](const auto& x, const auto&)
+            {
+                return tue::detail_::rsqrt_fast_s<T>(x);
+            },
+            [](const auto& x, const auto&) { return math::rsqrt_fast(x); });
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    argument_count = argc;
+    arguments = argv;
+
+    std::printf(
+        "%-13s %-10s %-9s %-23s %10s %10s %9s\n",
+        "function", "type", "path", "domain",
+        "max ulp", "mean ulp", "ns/elem");
+    measure_all<float, 4, 8, 16>();
+    measure_all<double, 2, 4, 8>();
+    return 0;
+}
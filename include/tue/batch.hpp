@@ -0,0 +1,518 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "detail_/batch/kernels.generic.hpp"
+#include "detail_/batch/kernels.simd.hpp"
+#include "detail_/cpu_features.hpp"
+#include "mat.hpp"
+#include "quat.hpp"
+#include "vec.hpp"
+
+#ifdef TUE_CPU_DISPATCH
+#include "detail_/batch/kernels.avx2.hpp"
+#include "detail_/batch/kernels.avx512.hpp"
+#include "detail_/batch/kernels.sse2.hpp"
+#endif
+
+/*!
+ * \defgroup  batch_hpp <tue/batch.hpp>
+ *
+ * \brief     Functions that operate on whole arrays of objects at once.
+ *
+ * \details   Unlike the rest of Tuesday, which only uses the instruction sets
+ *            enabled at compile time, these functions detect the instruction
+ *            sets supported by the CPU the first time one of them is called
+ *            and dispatch to the best matching kernel from then on. This lets
+ *            a single binary built for a baseline target still take
+ *            advantage of newer hardware. The transform and rotate functions
+ *            also accept component types other than `float`. Those are
+ *            processed in blocks of the widest `simd` type enabled at compile
+ *            time instead, as is `compose()` for every component type.
+ *
+ *            Unless stated otherwise, `in` and `out` may point to the same
+ *            array, but they may not otherwise overlap.
+ *
+ *            When a function's output is at least `stream_threshold` bytes
+ *            and doesn't alias its input, the output is written with
+ *            non-temporal stores that bypass the cache. Such outputs are too
+ *            big to stay cached anyway, and this keeps them from evicting
+ *            everything else. The stores are fenced before the function
+ *            returns.
+ */
+namespace tue
+{
+    namespace batch
+    {
+        /*!
+         * \addtogroup  batch_hpp
+         * @{
+         */
+
+        /*!
+         * \brief  An instruction set a batch kernel can be written for.
+         */
+        enum class isa
+        {
+            /*!
+             * \brief  Portable scalar code.
+             */
+            generic,
+
+            /*!
+             * \brief  SSE2.
+             */
+            sse2,
+
+            /*!
+             * \brief  AVX2 and FMA3.
+             */
+            avx2,
+
+            /*!
+             * \brief  AVX-512F.
+             */
+            avx512,
+        };
+
+        /*!
+         * \brief  The output size, in bytes, at or above which the batch
+         *         functions write their output with non-temporal stores.
+         */
+        constexpr std::size_t stream_threshold = 4 * 1024 * 1024;
+
+        /*!@}*/
+    }
+
+    namespace detail_
+    {
+        using transform_kernel = void (*)(
+            const mat<float, 4, 4>&,
+            const vec3<float>*,
+            vec3<float>*,
+            std::size_t);
+
+        using normalize_kernel = void (*)(
+            const vec3<float>*,
+            vec3<float>*,
+            std::size_t);
+
+        using rotate_kernel = void (*)(
+            const quat<float>*,
+            const vec3<float>*,
+            vec3<float>*,
+            std::size_t);
+
+        // The transform kernels are indexed by batch_transform.
+        struct batch_kernels
+        {
+            batch::isa isa;
+
+            transform_kernel transform[3];
+
+            normalize_kernel normalize;
+
+            rotate_kernel rotate;
+
+            transform_kernel transform_stream[3];
+
+            normalize_kernel normalize_stream;
+
+            rotate_kernel rotate_stream;
+        };
+
+        inline batch::isa supported_batch_isa() noexcept
+        {
+            static const auto features = detect_cpu_features();
+            if (features.avx512) return batch::isa::avx512;
+            if (features.avx2) return batch::isa::avx2;
+            if (features.sse2) return batch::isa::sse2;
+            return batch::isa::generic;
+        }
+
+        inline batch_kernels make_batch_kernels(batch::isa isa) noexcept
+        {
+            switch (isa)
+            {
+#ifdef TUE_CPU_DISPATCH
+            case batch::isa::avx512:
+                return {
+                    isa,
+                    {
+                        &transform_avx512<batch_transform::points, false>,
+                        &transform_avx512<batch_transform::vectors, false>,
+                        &transform_avx512<batch_transform::homogeneous, false>,
+                    },
+                    &normalize_avx512<false>,
+                    &rotate_avx512<false>,
+                    {
+                        &transform_avx512<batch_transform::points, true>,
+                        &transform_avx512<batch_transform::vectors, true>,
+                        &transform_avx512<batch_transform::homogeneous, true>,
+                    },
+                    &normalize_avx512<true>,
+                    &rotate_avx512<true>,
+                };
+            case batch::isa::avx2:
+                return {
+                    isa,
+                    {
+                        &transform_avx2<batch_transform::points, false>,
+                        &transform_avx2<batch_transform::vectors, false>,
+                        &transform_avx2<batch_transform::homogeneous, false>,
+                    },
+                    &normalize_avx2<false>,
+                    &rotate_avx2<false>,
+                    {
+                        &transform_avx2<batch_transform::points, true>,
+                        &transform_avx2<batch_transform::vectors, true>,
+                        &transform_avx2<batch_transform::homogeneous, true>,
+                    },
+                    &normalize_avx2<true>,
+                    &rotate_avx2<true>,
+                };
+            case batch::isa::sse2:
+                return {
+                    isa,
+                    {
+                        &transform_sse2<batch_transform::points, false>,
+                        &transform_sse2<batch_transform::vectors, false>,
+                        &transform_sse2<batch_transform::homogeneous, false>,
+                    },
+                    &normalize_sse2<false>,
+                    &rotate_sse2<false>,
+                    {
+                        &transform_sse2<batch_transform::points, true>,
+                        &transform_sse2<batch_transform::vectors, true>,
+                        &transform_sse2<batch_transform::homogeneous, true>,
+                    },
+                    &normalize_sse2<true>,
+                    &rotate_sse2<true>,
+                };
+#endif
+            default:
+                return {
+                    batch::isa::generic,
+                    {
+                        &transform_generic<batch_transform::points>,
+                        &transform_generic<batch_transform::vectors>,
+                        &transform_generic<batch_transform::homogeneous>,
+                    },
+                    &normalize_generic,
+                    &rotate_generic<float>,
+                    {
+                        &transform_generic<batch_transform::points>,
+                        &transform_generic<batch_transform::vectors>,
+                        &transform_generic<batch_transform::homogeneous>,
+                    },
+                    &normalize_generic,
+                    &rotate_generic<float>,
+                };
+            }
+        }
+
+        inline batch_kernels& active_batch_kernels() noexcept
+        {
+            static auto kernels = make_batch_kernels(supported_batch_isa());
+            return kernels;
+        }
+
+        // Returns how many of the first count elements of out should be
+        // written with regular stores. The rest, if any, should be written
+        // with non-temporal stores, starting from a 16-byte aligned address.
+        inline std::size_t batch_stream_head(
+            const void* in, const vec3<float>* out, std::size_t count) noexcept
+        {
+            if (in == out
+                || count * sizeof(vec3<float>) < batch::stream_threshold)
+            {
+                return count;
+            }
+
+            std::size_t head = 0;
+            while (reinterpret_cast<std::uintptr_t>(out + head) % 16 != 0)
+            {
+                ++head;
+            }
+            return head;
+        }
+
+        template<batch_transform K, typename T>
+        inline void batch_transform_s(
+            const mat<T, 4, 4>& m,
+            const vec3<T>* in,
+            vec3<T>* out,
+            std::size_t count) noexcept
+        {
+            transform_simd<K, T, batch_simd_width<T>()>(m, in, out, count);
+        }
+
+        template<batch_transform K>
+        inline void batch_transform_s(
+            const mat<float, 4, 4>& m,
+            const vec3<float>* in,
+            vec3<float>* out,
+            std::size_t count) noexcept
+        {
+            const auto& kernels = active_batch_kernels();
+            const auto k = static_cast<int>(K);
+            const auto head = batch_stream_head(in, out, count);
+            kernels.transform[k](m, in, out, head);
+            if (head < count)
+            {
+                kernels.transform_stream[k](
+                    m, in + head, out + head, count - head);
+            }
+        }
+
+        template<typename T>
+        inline void batch_rotate_s(
+            const quat<T>* rotations,
+            const vec3<T>* in,
+            vec3<T>* out,
+            std::size_t count) noexcept
+        {
+            rotate_simd<T, batch_simd_width<T>()>(rotations, in, out, count);
+        }
+
+        inline void batch_rotate_s(
+            const quat<float>* rotations,
+            const vec3<float>* in,
+            vec3<float>* out,
+            std::size_t count) noexcept
+        {
+            const auto& kernels = active_batch_kernels();
+            const auto head = batch_stream_head(in, out, count);
+            kernels.rotate(rotations, in, out, head);
+            if (head < count)
+            {
+                kernels.rotate_stream(
+                    rotations + head, in + head, out + head, count - head);
+            }
+        }
+    }
+
+    namespace batch
+    {
+        /*!
+         * \addtogroup  batch_hpp
+         * @{
+         */
+
+        /*!
+         * \brief   Returns the best instruction set supported by both the
+         *          current CPU and the compiler.
+         *
+         * \return  The best instruction set supported by both the current
+         *          CPU and the compiler.
+         */
+        inline isa supported_isa() noexcept
+        {
+            return tue::detail_::supported_batch_isa();
+        }
+
+        /*!
+         * \brief   Returns the instruction set the batch functions currently
+         *          dispatch to.
+         *
+         * \return  The instruction set the batch functions currently
+         *          dispatch to.
+         */
+        inline isa active_isa() noexcept
+        {
+            return tue::detail_::active_batch_kernels().isa;
+        }
+
+        /*!
+         * \brief       Changes the instruction set the batch functions
+         *              dispatch to.
+         *
+         * \details     Any instruction set better than `supported_isa()` is
+         *              clamped to `supported_isa()`. This is meant for tests
+         *              and benchmarks. It isn't thread-safe, so it shouldn't
+         *              be called while any batch function might be running.
+         *
+         * \param isa   The requested instruction set.
+         *
+         * \return      The instruction set actually selected.
+         */
+        inline batch::isa set_active_isa(batch::isa isa) noexcept
+        {
+            const auto supported = supported_isa();
+            if (static_cast<int>(isa) > static_cast<int>(supported))
+            {
+                isa = supported;
+            }
+
+            auto& kernels = tue::detail_::active_batch_kernels();
+            kernels = tue::detail_::make_batch_kernels(isa);
+            return kernels.isa;
+        }
+
+        /*!
+         * \brief        Transforms an array of points by a 4x4 matrix.
+         *
+         * \details      Each output is computed the same way as
+         *               `(vec4<T>(in[i], T(1)) * m).xyz()`.
+         *
+         * \tparam T     The component type.
+         *
+         * \param m      The transformation matrix.
+         * \param in     The points to transform.
+         * \param out    Where to write the transformed points.
+         * \param count  The number of points.
+         */
+        template<typename T>
+        inline void transform_points(
+            const mat<T, 4, 4>& m,
+            const vec3<T>* in,
+            vec3<T>* out,
+            std::size_t count) noexcept
+        {
+            tue::detail_::batch_transform_s<
+                tue::detail_::batch_transform::points>(m, in, out, count);
+        }
+
+        /*!
+         * \brief        Transforms an array of direction vectors by a 4x4
+         *               matrix, ignoring its translation.
+         *
+         * \details      Each output is computed the same way as
+         *               `(vec4<T>(in[i], T(0)) * m).xyz()`.
+         *
+         * \tparam T     The component type.
+         *
+         * \param m      The transformation matrix.
+         * \param in     The vectors to transform.
+         * \param out    Where to write the transformed vectors.
+         * \param count  The number of vectors.
+         */
+        template<typename T>
+        inline void transform_vectors(
+            const mat<T, 4, 4>& m,
+            const vec3<T>* in,
+            vec3<T>* out,
+            std::size_t count) noexcept
+        {
+            tue::detail_::batch_transform_s<
+                tue::detail_::batch_transform::vectors>(m, in, out, count);
+        }
+
+        /*!
+         * \brief        Transforms an array of points by a 4x4 projective
+         *               matrix, including the perspective divide.
+         *
+         * \details      Each output is computed the same way as
+         *               `r.xyz() / r.w()` where
+         *               `r = vec4<T>(in[i], T(1)) * m`. The `float` kernels
+         *               multiply by the reciprocal of `r.w()` instead of
+         *               dividing, so results may differ in the last bit.
+         *
+         * \tparam T     The component type.
+         *
+         * \param m      The transformation matrix.
+         * \param in     The points to transform.
+         * \param out    Where to write the transformed points.
+         * \param count  The number of points.
+         */
+        template<typename T>
+        inline void transform_homogeneous(
+            const mat<T, 4, 4>& m,
+            const vec3<T>* in,
+            vec3<T>* out,
+            std::size_t count) noexcept
+        {
+            tue::detail_::batch_transform_s<
+                tue::detail_::batch_transform::homogeneous>(
+                    m, in, out, count);
+        }
+
+        /*!
+         * \brief        Normalizes an array of vectors.
+         *
+         * \details      Each output is computed the same way as
+         *               `math::normalize(in[i])`.
+         *
+         * \param in     The vectors to normalize.
+         * \param out    Where to write the normalized vectors.
+         * \param count  The number of vectors.
+         */
+        inline void normalize(
+            const vec3<float>* in,
+            vec3<float>* out,
+            std::size_t count) noexcept
+        {
+            const auto& kernels = tue::detail_::active_batch_kernels();
+            const auto head = tue::detail_::batch_stream_head(in, out, count);
+            kernels.normalize(in, out, head);
+            if (head < count)
+            {
+                kernels.normalize_stream(in + head, out + head, count - head);
+            }
+        }
+
+        /*!
+         * \brief            Rotates an array of vectors, each by its own
+         *                   rotation quaternion.
+         *
+         * \details          Each output is computed the same way as
+         *                   `math::rotate(in[i], rotations[i])`. Each
+         *                   rotation must be a unit quaternion.
+         *
+         * \tparam T         The component type.
+         *
+         * \param rotations  The rotation quaternions.
+         * \param in         The vectors to rotate.
+         * \param out        Where to write the rotated vectors.
+         * \param count      The number of vectors and rotations.
+         */
+        template<typename T>
+        inline void rotate(
+            const quat<T>* rotations,
+            const vec3<T>* in,
+            vec3<T>* out,
+            std::size_t count) noexcept
+        {
+            tue::detail_::batch_rotate_s(rotations, in, out, count);
+        }
+
+        /*!
+         * \brief        Composes two arrays of rotation quaternions
+         *               pairwise.
+         *
+         * \details      Each output is computed the same way as
+         *               `lhs[i] * rhs[i]`, i.e. the rotation `lhs[i]`
+         *               followed by the rotation `rhs[i]`. `out` may point
+         *               to the same array as `lhs` or `rhs`.
+         *
+         * \tparam T     The component type.
+         *
+         * \param lhs    The first rotation of each pair.
+         * \param rhs    The second rotation of each pair.
+         * \param out    Where to write the composed rotations.
+         * \param count  The number of pairs.
+         */
+        template<typename T>
+        inline void compose(
+            const quat<T>* lhs,
+            const quat<T>* rhs,
+            quat<T>* out,
+            std::size_t count) noexcept
+        {
+            tue::detail_::compose_simd<
+                T, tue::detail_::batch_simd_width<T>()>(
+                    lhs, rhs, out, count);
+        }
+
+        /*!@}*/
+    }
+}
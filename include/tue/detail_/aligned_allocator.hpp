@@ -0,0 +1,71 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace tue
+{
+    namespace detail_
+    {
+        // An allocator that respects alignof(T) even when it's greater than
+        // what operator new guarantees, which C++14 doesn't otherwise do.
+        template<typename T>
+        class aligned_allocator
+        {
+            static constexpr std::size_t alignment =
+                alignof(T) > alignof(void*) ? alignof(T) : alignof(void*);
+
+        public:
+            using value_type = T;
+
+            aligned_allocator() noexcept = default;
+
+            template<typename U>
+            aligned_allocator(const aligned_allocator<U>&) noexcept
+            {
+            }
+
+            // Over-allocates, aligns, and stores the original pointer just
+            // before the aligned one so deallocate() can find it.
+            T* allocate(std::size_t n)
+            {
+                const auto raw = ::operator new(
+                    n * sizeof(T) + alignment - 1 + sizeof(void*));
+                const auto unaligned =
+                    reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*);
+                const auto aligned =
+                    (unaligned + alignment - 1) & ~(alignment - 1);
+                reinterpret_cast<void**>(aligned)[-1] = raw;
+                return reinterpret_cast<T*>(aligned);
+            }
+
+            void deallocate(T* p, std::size_t) noexcept
+            {
+                ::operator delete(reinterpret_cast<void**>(p)[-1]);
+            }
+        };
+
+        template<typename T, typename U>
+        inline bool operator==(
+            const aligned_allocator<T>&, const aligned_allocator<U>&) noexcept
+        {
+            return true;
+        }
+
+        template<typename T, typename U>
+        inline bool operator!=(
+            const aligned_allocator<T>&, const aligned_allocator<U>&) noexcept
+        {
+            return false;
+        }
+    }
+}
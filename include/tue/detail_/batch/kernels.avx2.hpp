@@ -0,0 +1,260 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+
+#include "../../mat.hpp"
+#include "../../quat.hpp"
+#include "../../vec.hpp"
+#include "../cpu_features.hpp"
+#include "kernels.generic.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        // Loads p[0..3] into the low lane and p[stride..stride+3] into the
+        // high lane.
+        TUE_TARGET("avx2,fma")
+        inline __m256 load_lanes_avx2(
+            const float* p, std::size_t stride) noexcept
+        {
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm_loadu_ps(p)),
+                _mm_loadu_ps(p + stride), 1);
+        }
+
+        // Stores 128-bit lane k to p[k*stride..k*stride+3]. If Stream is
+        // true, each destination must be 16-byte aligned, and the stores
+        // bypass the cache.
+        template<bool Stream>
+        TUE_TARGET("avx2,fma")
+        inline void store_lanes_avx2(
+            float* p, std::size_t stride, const __m256& v) noexcept
+        {
+            if (Stream)
+            {
+                _mm_stream_ps(p, _mm256_castps256_ps128(v));
+                _mm_stream_ps(p + stride, _mm256_extractf128_ps(v, 1));
+            }
+            else
+            {
+                _mm_storeu_ps(p, _mm256_castps256_ps128(v));
+                _mm_storeu_ps(p + stride, _mm256_extractf128_ps(v, 1));
+            }
+        }
+
+        // Loads 8 consecutive vec3<float>'s as 8 x's, 8 y's, and 8 z's.
+        // Each 128-bit lane is deinterleaved the same way as in
+        // load_vec3x4_sse2().
+        TUE_TARGET("avx2,fma")
+        inline void load_vec3x8_avx2(
+            const float* p, __m256& x, __m256& y, __m256& z) noexcept
+        {
+            const auto m0 = load_lanes_avx2(p + 0, 12);
+            const auto m1 = load_lanes_avx2(p + 4, 12);
+            const auto m2 = load_lanes_avx2(p + 8, 12);
+            x = _mm256_shuffle_ps(
+                m0,
+                _mm256_shuffle_ps(m1, m2, _MM_SHUFFLE(1, 1, 2, 2)),
+                _MM_SHUFFLE(2, 0, 3, 0));
+            y = _mm256_shuffle_ps(
+                _mm256_shuffle_ps(m0, m1, _MM_SHUFFLE(0, 0, 1, 1)),
+                _mm256_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 2, 3, 3)),
+                _MM_SHUFFLE(2, 0, 2, 0));
+            z = _mm256_shuffle_ps(
+                _mm256_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 1, 2, 2)),
+                m2,
+                _MM_SHUFFLE(3, 0, 2, 0));
+        }
+
+        // Stores 8 x's, 8 y's, and 8 z's as 8 consecutive vec3<float>'s.
+        template<bool Stream>
+        TUE_TARGET("avx2,fma")
+        inline void store_vec3x8_avx2(
+            float* p,
+            const __m256& x, const __m256& y, const __m256& z) noexcept
+        {
+            store_lanes_avx2<Stream>(p + 0, 12, _mm256_shuffle_ps(
+                _mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+                _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)),
+                _MM_SHUFFLE(2, 0, 2, 0)));
+            store_lanes_avx2<Stream>(p + 4, 12, _mm256_shuffle_ps(
+                _mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+                _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)),
+                _MM_SHUFFLE(2, 0, 2, 0)));
+            store_lanes_avx2<Stream>(p + 8, 12, _mm256_shuffle_ps(
+                _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+                _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)),
+                _MM_SHUFFLE(2, 0, 2, 0)));
+        }
+
+        // Loads 8 consecutive quat<float>'s as 8 x's, 8 y's, 8 z's, and 8
+        // w's.
+        TUE_TARGET("avx2,fma")
+        inline void load_quatx8_avx2(
+            const float* p,
+            __m256& x, __m256& y, __m256& z, __m256& w) noexcept
+        {
+            const auto q0 = load_lanes_avx2(p + 0, 16);
+            const auto q1 = load_lanes_avx2(p + 4, 16);
+            const auto q2 = load_lanes_avx2(p + 8, 16);
+            const auto q3 = load_lanes_avx2(p + 12, 16);
+            const auto t0 = _mm256_unpacklo_ps(q0, q1);
+            const auto t1 = _mm256_unpacklo_ps(q2, q3);
+            const auto t2 = _mm256_unpackhi_ps(q0, q1);
+            const auto t3 = _mm256_unpackhi_ps(q2, q3);
+            x = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+            y = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+            z = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            w = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        // If Stream is true, out must be 16-byte aligned, and the results
+        // are written with non-temporal stores followed by a fence.
+        template<batch_transform K, bool Stream>
+        TUE_TARGET("avx2,fma")
+        inline void transform_avx2(
+            const mat<float, 4, 4>& m,
+            const vec3<float>* in,
+            vec3<float>* out,
+            std::size_t count) noexcept
+        {
+            const auto w = K == batch_transform::vectors ? 0.0f : 1.0f;
+            const auto m00 = _mm256_set1_ps(m[0][0]);
+            const auto m01 = _mm256_set1_ps(m[0][1]);
+            const auto m02 = _mm256_set1_ps(m[0][2]);
+            const auto m03 = _mm256_set1_ps(w * m[0][3]);
+            const auto m10 = _mm256_set1_ps(m[1][0]);
+            const auto m11 = _mm256_set1_ps(m[1][1]);
+            const auto m12 = _mm256_set1_ps(m[1][2]);
+            const auto m13 = _mm256_set1_ps(w * m[1][3]);
+            const auto m20 = _mm256_set1_ps(m[2][0]);
+            const auto m21 = _mm256_set1_ps(m[2][1]);
+            const auto m22 = _mm256_set1_ps(m[2][2]);
+            const auto m23 = _mm256_set1_ps(w * m[2][3]);
+            const auto m30 = _mm256_set1_ps(m[3][0]);
+            const auto m31 = _mm256_set1_ps(m[3][1]);
+            const auto m32 = _mm256_set1_ps(m[3][2]);
+            const auto m33 = _mm256_set1_ps(m[3][3]);
+            const auto one = _mm256_set1_ps(1.0f);
+
+            const auto src = reinterpret_cast<const float*>(in);
+            const auto dst = reinterpret_cast<float*>(out);
+            const auto n = count - count % 8;
+            for (std::size_t i = 0; i < n; i += 8)
+            {
+                __m256 x, y, z;
+                load_vec3x8_avx2(src + 3*i, x, y, z);
+                auto rx = _mm256_fmadd_ps(x, m00, _mm256_fmadd_ps(
+                    y, m01, _mm256_fmadd_ps(z, m02, m03)));
+                auto ry = _mm256_fmadd_ps(x, m10, _mm256_fmadd_ps(
+                    y, m11, _mm256_fmadd_ps(z, m12, m13)));
+                auto rz = _mm256_fmadd_ps(x, m20, _mm256_fmadd_ps(
+                    y, m21, _mm256_fmadd_ps(z, m22, m23)));
+                if (K == batch_transform::homogeneous)
+                {
+                    const auto rw = _mm256_fmadd_ps(x, m30, _mm256_fmadd_ps(
+                        y, m31, _mm256_fmadd_ps(z, m32, m33)));
+                    const auto rcp = _mm256_div_ps(one, rw);
+                    rx = _mm256_mul_ps(rx, rcp);
+                    ry = _mm256_mul_ps(ry, rcp);
+                    rz = _mm256_mul_ps(rz, rcp);
+                }
+                store_vec3x8_avx2<Stream>(dst + 3*i, rx, ry, rz);
+            }
+
+            transform_generic<K>(m, in + n, out + n, count - n);
+            if (Stream)
+            {
+                _mm_sfence();
+            }
+        }
+
+        template<bool Stream>
+        TUE_TARGET("avx2,fma")
+        inline void normalize_avx2(
+            const vec3<float>* in,
+            vec3<float>* out,
+            std::size_t count) noexcept
+        {
+            const auto one = _mm256_set1_ps(1.0f);
+
+            const auto src = reinterpret_cast<const float*>(in);
+            const auto dst = reinterpret_cast<float*>(out);
+            const auto n = count - count % 8;
+            for (std::size_t i = 0; i < n; i += 8)
+            {
+                __m256 x, y, z;
+                load_vec3x8_avx2(src + 3*i, x, y, z);
+                const auto length2 = _mm256_fmadd_ps(x, x, _mm256_fmadd_ps(
+                    y, y, _mm256_mul_ps(z, z)));
+                const auto rlength = _mm256_div_ps(
+                    one, _mm256_sqrt_ps(length2));
+                store_vec3x8_avx2<Stream>(
+                    dst + 3*i,
+                    _mm256_mul_ps(x, rlength),
+                    _mm256_mul_ps(y, rlength),
+                    _mm256_mul_ps(z, rlength));
+            }
+
+            normalize_generic(in + n, out + n, count - n);
+            if (Stream)
+            {
+                _mm_sfence();
+            }
+        }
+
+        template<bool Stream>
+        TUE_TARGET("avx2,fma")
+        inline void rotate_avx2(
+            const quat<float>* rotations,
+            const vec3<float>* in,
+            vec3<float>* out,
+            std::size_t count) noexcept
+        {
+            const auto two = _mm256_set1_ps(2.0f);
+
+            const auto rot = reinterpret_cast<const float*>(rotations);
+            const auto src = reinterpret_cast<const float*>(in);
+            const auto dst = reinterpret_cast<float*>(out);
+            const auto n = count - count % 8;
+            for (std::size_t i = 0; i < n; i += 8)
+            {
+                __m256 qx, qy, qz, qw, x, y, z;
+                load_quatx8_avx2(rot + 4*i, qx, qy, qz, qw);
+                load_vec3x8_avx2(src + 3*i, x, y, z);
+
+                // t = 2 * cross(v, q.v())
+                const auto tx = _mm256_mul_ps(two, _mm256_fmsub_ps(
+                    y, qz, _mm256_mul_ps(z, qy)));
+                const auto ty = _mm256_mul_ps(two, _mm256_fmsub_ps(
+                    z, qx, _mm256_mul_ps(x, qz)));
+                const auto tz = _mm256_mul_ps(two, _mm256_fmsub_ps(
+                    x, qy, _mm256_mul_ps(y, qx)));
+
+                // v + q.s() * t + cross(t, q.v())
+                const auto rx = _mm256_fmadd_ps(qw, tx, _mm256_add_ps(
+                    x, _mm256_fmsub_ps(ty, qz, _mm256_mul_ps(tz, qy))));
+                const auto ry = _mm256_fmadd_ps(qw, ty, _mm256_add_ps(
+                    y, _mm256_fmsub_ps(tz, qx, _mm256_mul_ps(tx, qz))));
+                const auto rz = _mm256_fmadd_ps(qw, tz, _mm256_add_ps(
+                    z, _mm256_fmsub_ps(tx, qy, _mm256_mul_ps(ty, qx))));
+                store_vec3x8_avx2<Stream>(dst + 3*i, rx, ry, rz);
+            }
+
+            rotate_generic(rotations + n, in + n, out + n, count - n);
+            if (Stream)
+            {
+                _mm_sfence();
+            }
+        }
+    }
+}
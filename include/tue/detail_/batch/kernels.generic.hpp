@@ -0,0 +1,95 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+
+#include "../../mat.hpp"
+#include "../../math.hpp"
+#include "../../quat.hpp"
+#include "../../vec.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        // Which of the batch transform functions a transform kernel
+        // implements.
+        enum class batch_transform
+        {
+            // (vec4<T>(v, 1) * m).xyz()
+            points,
+
+            // (vec4<T>(v, 0) * m).xyz()
+            vectors,
+
+            // (vec4<T>(v, 1) * m).xyz() divided by its w component
+            homogeneous,
+        };
+
+        template<batch_transform K, typename T>
+        inline void transform_generic(
+            const mat<T, 4, 4>& m,
+            const vec3<T>* in,
+            vec3<T>* out,
+            std::size_t count) noexcept
+        {
+            const auto w = K == batch_transform::vectors ? T(0) : T(1);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const auto r = vec4<T>(in[i], w) * m;
+                if (K == batch_transform::homogeneous)
+                {
+                    out[i] = r.xyz() / r[3];
+                }
+                else
+                {
+                    out[i] = r.xyz();
+                }
+            }
+        }
+
+        inline void normalize_generic(
+            const vec3<float>* in,
+            vec3<float>* out,
+            std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                out[i] = tue::math::normalize(in[i]);
+            }
+        }
+
+        template<typename T>
+        inline void rotate_generic(
+            const quat<T>* rotations,
+            const vec3<T>* in,
+            vec3<T>* out,
+            std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                out[i] = tue::math::rotate(in[i], rotations[i]);
+            }
+        }
+
+        template<typename T>
+        inline void compose_generic(
+            const quat<T>* lhs,
+            const quat<T>* rhs,
+            quat<T>* out,
+            std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                out[i] = lhs[i] * rhs[i];
+            }
+        }
+    }
+}
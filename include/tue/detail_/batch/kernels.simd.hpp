@@ -0,0 +1,118 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+
+#include "../../mat.hpp"
+#include "../../quat.hpp"
+#include "../../simd.hpp"
+#include "../../soa.hpp"
+#include "../../vec.hpp"
+#include "kernels.generic.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        // The widest simd<T, N> the compiler accelerates with a single
+        // register, or 4 if there isn't one.
+        template<typename T>
+        inline constexpr int batch_simd_width() noexcept
+        {
+            return simd<T, 16>::is_accelerated ? 16
+                : simd<T, 8>::is_accelerated ? 8
+                : 4;
+        }
+
+        // Unlike the other kernels, these only use the instruction sets
+        // enabled at compile time. They're for component types without
+        // dispatched kernels.
+        template<batch_transform K, typename T, int N>
+        inline void transform_simd(
+            const mat<T, 4, 4>& m,
+            const vec3<T>* in,
+            vec3<T>* out,
+            std::size_t count) noexcept
+        {
+            using simd_type = simd<T, N>;
+
+            const auto w = K == batch_transform::vectors ? T(0) : T(1);
+            const simd_type m00(m[0][0]);
+            const simd_type m01(m[0][1]);
+            const simd_type m02(m[0][2]);
+            const simd_type m03(w * m[0][3]);
+            const simd_type m10(m[1][0]);
+            const simd_type m11(m[1][1]);
+            const simd_type m12(m[1][2]);
+            const simd_type m13(w * m[1][3]);
+            const simd_type m20(m[2][0]);
+            const simd_type m21(m[2][1]);
+            const simd_type m22(m[2][2]);
+            const simd_type m23(w * m[2][3]);
+            const simd_type m30(m[3][0]);
+            const simd_type m31(m[3][1]);
+            const simd_type m32(m[3][2]);
+            const simd_type m33(m[3][3]);
+
+            const auto n = count - count % N;
+            for (std::size_t i = 0; i < n; i += N)
+            {
+                const auto v = tue::soa::load<N>(in + i);
+                vec3<simd_type> r(
+                    v[0]*m00 + v[1]*m01 + v[2]*m02 + m03,
+                    v[0]*m10 + v[1]*m11 + v[2]*m12 + m13,
+                    v[0]*m20 + v[1]*m21 + v[2]*m22 + m23);
+                if (K == batch_transform::homogeneous)
+                {
+                    r /= v[0]*m30 + v[1]*m31 + v[2]*m32 + m33;
+                }
+                tue::soa::store(r, out + i);
+            }
+
+            transform_generic<K>(m, in + n, out + n, count - n);
+        }
+
+        template<typename T, int N>
+        inline void rotate_simd(
+            const quat<T>* rotations,
+            const vec3<T>* in,
+            vec3<T>* out,
+            std::size_t count) noexcept
+        {
+            const auto n = count - count % N;
+            for (std::size_t i = 0; i < n; i += N)
+            {
+                const auto q = tue::soa::load<N>(rotations + i);
+                const auto v = tue::soa::load<N>(in + i);
+                tue::soa::store(tue::math::rotate(v, q), out + i);
+            }
+
+            rotate_generic(rotations + n, in + n, out + n, count - n);
+        }
+
+        template<typename T, int N>
+        inline void compose_simd(
+            const quat<T>* lhs,
+            const quat<T>* rhs,
+            quat<T>* out,
+            std::size_t count) noexcept
+        {
+            const auto n = count - count % N;
+            for (std::size_t i = 0; i < n; i += N)
+            {
+                const auto l = tue::soa::load<N>(lhs + i);
+                const auto r = tue::soa::load<N>(rhs + i);
+                tue::soa::store(l * r, out + i);
+            }
+
+            compose_generic(lhs + n, rhs + n, out + n, count - n);
+        }
+    }
+}
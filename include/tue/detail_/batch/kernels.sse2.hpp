@@ -0,0 +1,250 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+
+#include "../../mat.hpp"
+#include "../../quat.hpp"
+#include "../../vec.hpp"
+#include "../cpu_features.hpp"
+#include "kernels.generic.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        // Loads 4 consecutive vec3<float>'s as 4 x's, 4 y's, and 4 z's.
+        TUE_TARGET("sse2")
+        inline void load_vec3x4_sse2(
+            const float* p, __m128& x, __m128& y, __m128& z) noexcept
+        {
+            const auto m0 = _mm_loadu_ps(p + 0); // x0 y0 z0 x1
+            const auto m1 = _mm_loadu_ps(p + 4); // y1 z1 x2 y2
+            const auto m2 = _mm_loadu_ps(p + 8); // z2 x3 y3 z3
+            x = _mm_shuffle_ps(
+                m0,
+                _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(1, 1, 2, 2)),
+                _MM_SHUFFLE(2, 0, 3, 0));
+            y = _mm_shuffle_ps(
+                _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(0, 0, 1, 1)),
+                _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 2, 3, 3)),
+                _MM_SHUFFLE(2, 0, 2, 0));
+            z = _mm_shuffle_ps(
+                _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 1, 2, 2)),
+                m2,
+                _MM_SHUFFLE(3, 0, 2, 0));
+        }
+
+        // Stores 4 floats. If Stream is true, p must be 16-byte aligned, and
+        // the store bypasses the cache.
+        template<bool Stream>
+        TUE_TARGET("sse2")
+        inline void store_ps_sse2(float* p, const __m128& v) noexcept
+        {
+            if (Stream)
+            {
+                _mm_stream_ps(p, v);
+            }
+            else
+            {
+                _mm_storeu_ps(p, v);
+            }
+        }
+
+        // Stores 4 x's, 4 y's, and 4 z's as 4 consecutive vec3<float>'s.
+        template<bool Stream>
+        TUE_TARGET("sse2")
+        inline void store_vec3x4_sse2(
+            float* p,
+            const __m128& x, const __m128& y, const __m128& z) noexcept
+        {
+            store_ps_sse2<Stream>(p + 0, _mm_shuffle_ps(
+                _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+                _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)),
+                _MM_SHUFFLE(2, 0, 2, 0)));
+            store_ps_sse2<Stream>(p + 4, _mm_shuffle_ps(
+                _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+                _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)),
+                _MM_SHUFFLE(2, 0, 2, 0)));
+            store_ps_sse2<Stream>(p + 8, _mm_shuffle_ps(
+                _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+                _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)),
+                _MM_SHUFFLE(2, 0, 2, 0)));
+        }
+
+        // Loads 4 consecutive quat<float>'s as 4 x's, 4 y's, 4 z's, and 4
+        // w's.
+        TUE_TARGET("sse2")
+        inline void load_quatx4_sse2(
+            const float* p,
+            __m128& x, __m128& y, __m128& z, __m128& w) noexcept
+        {
+            const auto q0 = _mm_loadu_ps(p + 0);
+            const auto q1 = _mm_loadu_ps(p + 4);
+            const auto q2 = _mm_loadu_ps(p + 8);
+            const auto q3 = _mm_loadu_ps(p + 12);
+            const auto t0 = _mm_unpacklo_ps(q0, q1);
+            const auto t1 = _mm_unpacklo_ps(q2, q3);
+            const auto t2 = _mm_unpackhi_ps(q0, q1);
+            const auto t3 = _mm_unpackhi_ps(q2, q3);
+            x = _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+            y = _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+            z = _mm_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            w = _mm_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        // If Stream is true, out must be 16-byte aligned, and the results
+        // are written with non-temporal stores followed by a fence.
+        template<batch_transform K, bool Stream>
+        TUE_TARGET("sse2")
+        inline void transform_sse2(
+            const mat<float, 4, 4>& m,
+            const vec3<float>* in,
+            vec3<float>* out,
+            std::size_t count) noexcept
+        {
+            const auto w = K == batch_transform::vectors ? 0.0f : 1.0f;
+            const auto m00 = _mm_set1_ps(m[0][0]);
+            const auto m01 = _mm_set1_ps(m[0][1]);
+            const auto m02 = _mm_set1_ps(m[0][2]);
+            const auto m03 = _mm_set1_ps(w * m[0][3]);
+            const auto m10 = _mm_set1_ps(m[1][0]);
+            const auto m11 = _mm_set1_ps(m[1][1]);
+            const auto m12 = _mm_set1_ps(m[1][2]);
+            const auto m13 = _mm_set1_ps(w * m[1][3]);
+            const auto m20 = _mm_set1_ps(m[2][0]);
+            const auto m21 = _mm_set1_ps(m[2][1]);
+            const auto m22 = _mm_set1_ps(m[2][2]);
+            const auto m23 = _mm_set1_ps(w * m[2][3]);
+            const auto m30 = _mm_set1_ps(m[3][0]);
+            const auto m31 = _mm_set1_ps(m[3][1]);
+            const auto m32 = _mm_set1_ps(m[3][2]);
+            const auto m33 = _mm_set1_ps(m[3][3]);
+            const auto one = _mm_set1_ps(1.0f);
+
+            const auto src = reinterpret_cast<const float*>(in);
+            const auto dst = reinterpret_cast<float*>(out);
+            const auto n = count - count % 4;
+            for (std::size_t i = 0; i < n; i += 4)
+            {
+                __m128 x, y, z;
+                load_vec3x4_sse2(src + 3*i, x, y, z);
+                auto rx = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m01)),
+                    _mm_add_ps(_mm_mul_ps(z, m02), m03));
+                auto ry = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(x, m10), _mm_mul_ps(y, m11)),
+                    _mm_add_ps(_mm_mul_ps(z, m12), m13));
+                auto rz = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(x, m20), _mm_mul_ps(y, m21)),
+                    _mm_add_ps(_mm_mul_ps(z, m22), m23));
+                if (K == batch_transform::homogeneous)
+                {
+                    const auto rw = _mm_add_ps(
+                        _mm_add_ps(_mm_mul_ps(x, m30), _mm_mul_ps(y, m31)),
+                        _mm_add_ps(_mm_mul_ps(z, m32), m33));
+                    const auto rcp = _mm_div_ps(one, rw);
+                    rx = _mm_mul_ps(rx, rcp);
+                    ry = _mm_mul_ps(ry, rcp);
+                    rz = _mm_mul_ps(rz, rcp);
+                }
+                store_vec3x4_sse2<Stream>(dst + 3*i, rx, ry, rz);
+            }
+
+            transform_generic<K>(m, in + n, out + n, count - n);
+            if (Stream)
+            {
+                _mm_sfence();
+            }
+        }
+
+        template<bool Stream>
+        TUE_TARGET("sse2")
+        inline void normalize_sse2(
+            const vec3<float>* in,
+            vec3<float>* out,
+            std::size_t count) noexcept
+        {
+            const auto one = _mm_set1_ps(1.0f);
+
+            const auto src = reinterpret_cast<const float*>(in);
+            const auto dst = reinterpret_cast<float*>(out);
+            const auto n = count - count % 4;
+            for (std::size_t i = 0; i < n; i += 4)
+            {
+                __m128 x, y, z;
+                load_vec3x4_sse2(src + 3*i, x, y, z);
+                const auto length2 = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)),
+                    _mm_mul_ps(z, z));
+                const auto rlength = _mm_div_ps(one, _mm_sqrt_ps(length2));
+                store_vec3x4_sse2<Stream>(
+                    dst + 3*i,
+                    _mm_mul_ps(x, rlength),
+                    _mm_mul_ps(y, rlength),
+                    _mm_mul_ps(z, rlength));
+            }
+
+            normalize_generic(in + n, out + n, count - n);
+            if (Stream)
+            {
+                _mm_sfence();
+            }
+        }
+
+        template<bool Stream>
+        TUE_TARGET("sse2")
+        inline void rotate_sse2(
+            const quat<float>* rotations,
+            const vec3<float>* in,
+            vec3<float>* out,
+            std::size_t count) noexcept
+        {
+            const auto two = _mm_set1_ps(2.0f);
+
+            const auto rot = reinterpret_cast<const float*>(rotations);
+            const auto src = reinterpret_cast<const float*>(in);
+            const auto dst = reinterpret_cast<float*>(out);
+            const auto n = count - count % 4;
+            for (std::size_t i = 0; i < n; i += 4)
+            {
+                __m128 qx, qy, qz, qw, x, y, z;
+                load_quatx4_sse2(rot + 4*i, qx, qy, qz, qw);
+                load_vec3x4_sse2(src + 3*i, x, y, z);
+
+                // t = 2 * cross(v, q.v())
+                const auto tx = _mm_mul_ps(two, _mm_sub_ps(
+                    _mm_mul_ps(y, qz), _mm_mul_ps(z, qy)));
+                const auto ty = _mm_mul_ps(two, _mm_sub_ps(
+                    _mm_mul_ps(z, qx), _mm_mul_ps(x, qz)));
+                const auto tz = _mm_mul_ps(two, _mm_sub_ps(
+                    _mm_mul_ps(x, qy), _mm_mul_ps(y, qx)));
+
+                // v + q.s() * t + cross(t, q.v())
+                const auto rx = _mm_add_ps(
+                    _mm_add_ps(x, _mm_mul_ps(qw, tx)),
+                    _mm_sub_ps(_mm_mul_ps(ty, qz), _mm_mul_ps(tz, qy)));
+                const auto ry = _mm_add_ps(
+                    _mm_add_ps(y, _mm_mul_ps(qw, ty)),
+                    _mm_sub_ps(_mm_mul_ps(tz, qx), _mm_mul_ps(tx, qz)));
+                const auto rz = _mm_add_ps(
+                    _mm_add_ps(z, _mm_mul_ps(qw, tz)),
+                    _mm_sub_ps(_mm_mul_ps(tx, qy), _mm_mul_ps(ty, qx)));
+                store_vec3x4_sse2<Stream>(dst + 3*i, rx, ry, rz);
+            }
+
+            rotate_generic(rotations + n, in + n, out + n, count - n);
+            if (Stream)
+            {
+                _mm_sfence();
+            }
+        }
+    }
+}
@@ -0,0 +1,84 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#if (defined(__i386__) || defined(__x86_64__) \
+        || defined(_M_IX86) || defined(_M_X64)) \
+    && (defined(__GNUC__) || (defined(_MSC_VER) && _MSC_VER >= 1911))
+#define TUE_CPU_DISPATCH
+#endif
+
+#ifdef TUE_CPU_DISPATCH
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#ifdef __GNUC__
+#define TUE_TARGET(isa) __attribute__((target(isa)))
+#else
+#define TUE_TARGET(isa)
+#endif
+#endif
+
+namespace tue
+{
+    namespace detail_
+    {
+        struct cpu_features
+        {
+            bool sse2;
+            bool avx2;
+            bool avx512;
+        };
+
+        inline cpu_features detect_cpu_features() noexcept
+        {
+            cpu_features result = { false, false, false };
+#if defined(TUE_CPU_DISPATCH) && defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0);
+            const int max_leaf = info[0];
+
+            __cpuid(info, 1);
+            const bool sse2 = (info[3] & (1 << 26)) != 0;
+            const bool fma = (info[2] & (1 << 12)) != 0;
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool avx = (info[2] & (1 << 28)) != 0;
+
+            bool avx2 = false;
+            bool avx512f = false;
+            if (max_leaf >= 7)
+            {
+                __cpuidex(info, 7, 0);
+                avx2 = (info[1] & (1 << 5)) != 0;
+                avx512f = (info[1] & (1 << 16)) != 0;
+            }
+
+            // The OS has to save the YMM and ZMM registers too
+            const auto xcr0 = osxsave ? _xgetbv(0) : 0;
+            const bool ymm = (xcr0 & 0x06) == 0x06;
+            const bool zmm = (xcr0 & 0xE6) == 0xE6;
+
+            result.sse2 = sse2;
+            result.avx2 = avx && avx2 && fma && ymm;
+            result.avx512 = result.avx2 && avx512f && zmm;
+#elif defined(TUE_CPU_DISPATCH)
+            __builtin_cpu_init();
+            result.sse2 = __builtin_cpu_supports("sse2") != 0;
+            result.avx2 = __builtin_cpu_supports("avx2") != 0
+                && __builtin_cpu_supports("fma") != 0;
+            result.avx512 = result.avx2
+                && __builtin_cpu_supports("avx512f") != 0;
+#endif
+            return result;
+        }
+    }
+}
@@ -804,6 +804,52 @@ namespace tue
             tue::math::sincos(m[1], sin_out[1], cos_out[1]);
         }
 
+        template<typename T, int R>
+        inline mat<T, 2, R> tan_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::tan(m[0]),
+                tue::math::tan(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> asin_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::asin(m[0]),
+                tue::math::asin(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> acos_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::acos(m[0]),
+                tue::math::acos(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> atan_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::atan(m[0]),
+                tue::math::atan(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> atan2_mm(
+            const mat<T, 2, R>& y, const mat<T, 2, R>& x) noexcept
+        {
+            return {
+                tue::math::atan2(y[0], x[0]),
+                tue::math::atan2(y[1], x[1]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 2, R> exp_m(const mat<T, 2, R>& m) noexcept
         {
@@ -822,6 +868,24 @@ namespace tue
             };
         }
 
+        template<typename T, int R>
+        inline mat<T, 2, R> exp2_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::exp2(m[0]),
+                tue::math::exp2(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> log2_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::log2(m[0]),
+                tue::math::log2(m[1]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 2, R> abs_m(const mat<T, 2, R>& m) noexcept
         {
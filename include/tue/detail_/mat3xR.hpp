@@ -870,6 +870,57 @@ namespace tue
             tue::math::sincos(m[2], sin_out[2], cos_out[2]);
         }
 
+        template<typename T, int R>
+        inline mat<T, 3, R> tan_m(const mat<T, 3, R>& m) noexcept
+        {
+            return {
+                tue::math::tan(m[0]),
+                tue::math::tan(m[1]),
+                tue::math::tan(m[2]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 3, R> asin_m(const mat<T, 3, R>& m) noexcept
+        {
+            return {
+                tue::math::asin(m[0]),
+                tue::math::asin(m[1]),
+                tue::math::asin(m[2]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 3, R> acos_m(const mat<T, 3, R>& m) noexcept
+        {
+            return {
+                tue::math::acos(m[0]),
+                tue::math::acos(m[1]),
+                tue::math::acos(m[2]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 3, R> atan_m(const mat<T, 3, R>& m) noexcept
+        {
+            return {
+                tue::math::atan(m[0]),
+                tue::math::atan(m[1]),
+                tue::math::atan(m[2]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 3, R> atan2_mm(
+            const mat<T, 3, R>& y, const mat<T, 3, R>& x) noexcept
+        {
+            return {
+                tue::math::atan2(y[0], x[0]),
+                tue::math::atan2(y[1], x[1]),
+                tue::math::atan2(y[2], x[2]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 3, R> exp_m(const mat<T, 3, R>& m) noexcept
         {
@@ -890,6 +941,26 @@ namespace tue
             };
         }
 
+        template<typename T, int R>
+        inline mat<T, 3, R> exp2_m(const mat<T, 3, R>& m) noexcept
+        {
+            return {
+                tue::math::exp2(m[0]),
+                tue::math::exp2(m[1]),
+                tue::math::exp2(m[2]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 3, R> log2_m(const mat<T, 3, R>& m) noexcept
+        {
+            return {
+                tue::math::log2(m[0]),
+                tue::math::log2(m[1]),
+                tue::math::log2(m[2]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 3, R> abs_m(const mat<T, 3, R>& m) noexcept
         {
@@ -0,0 +1,188 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include "../mat.hpp"
+#include "simd_support.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        // Since det(transpose(m)) == det(m) and
+        // inverse(transpose(m)) == transpose(inverse(m)), these don't care
+        // whether the first index is the column or the row.
+
+        template<typename T>
+        inline T determinant_m(const mat<T, 2, 2>& m) noexcept
+        {
+            return m[0][0]*m[1][1] - m[0][1]*m[1][0];
+        }
+
+        template<typename T>
+        inline T determinant_m(const mat<T, 3, 3>& m) noexcept
+        {
+            return m[0][0] * (m[1][1]*m[2][2] - m[1][2]*m[2][1])
+                 + m[0][1] * (m[1][2]*m[2][0] - m[1][0]*m[2][2])
+                 + m[0][2] * (m[1][0]*m[2][1] - m[1][1]*m[2][0]);
+        }
+
+        template<typename T>
+        inline T determinant_m(const mat<T, 4, 4>& m) noexcept
+        {
+            // Laplace expansion along the first two columns, reusing each
+            // 2x2 minor.
+            const auto s0 = m[0][0]*m[1][1] - m[1][0]*m[0][1];
+            const auto s1 = m[0][0]*m[1][2] - m[1][0]*m[0][2];
+            const auto s2 = m[0][0]*m[1][3] - m[1][0]*m[0][3];
+            const auto s3 = m[0][1]*m[1][2] - m[1][1]*m[0][2];
+            const auto s4 = m[0][1]*m[1][3] - m[1][1]*m[0][3];
+            const auto s5 = m[0][2]*m[1][3] - m[1][2]*m[0][3];
+            const auto c0 = m[2][0]*m[3][1] - m[3][0]*m[2][1];
+            const auto c1 = m[2][0]*m[3][2] - m[3][0]*m[2][2];
+            const auto c2 = m[2][0]*m[3][3] - m[3][0]*m[2][3];
+            const auto c3 = m[2][1]*m[3][2] - m[3][1]*m[2][2];
+            const auto c4 = m[2][1]*m[3][3] - m[3][1]*m[2][3];
+            const auto c5 = m[2][2]*m[3][3] - m[3][2]*m[2][3];
+            return s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+        }
+
+        template<typename T, int N>
+        struct mat_inverse_s;
+
+        template<typename T>
+        struct mat_inverse_s<T, 2>
+        {
+            static mat<T, 2, 2> inverse(const mat<T, 2, 2>& m) noexcept
+            {
+                const auto r = T(1) / determinant_m(m);
+                return {
+                    vec2<T>(m[1][1]*r, T(0) - m[0][1]*r),
+                    vec2<T>(T(0) - m[1][0]*r, m[0][0]*r),
+                };
+            }
+        };
+
+        template<typename T>
+        struct mat_inverse_s<T, 3>
+        {
+            static mat<T, 3, 3> inverse(const mat<T, 3, 3>& m) noexcept
+            {
+                const auto b00 = m[1][1]*m[2][2] - m[1][2]*m[2][1];
+                const auto b10 = m[1][2]*m[2][0] - m[1][0]*m[2][2];
+                const auto b20 = m[1][0]*m[2][1] - m[1][1]*m[2][0];
+                const auto r = T(1)
+                    / (m[0][0]*b00 + m[0][1]*b10 + m[0][2]*b20);
+                return {
+                    vec3<T>(
+                        b00 * r,
+                        (m[0][2]*m[2][1] - m[0][1]*m[2][2]) * r,
+                        (m[0][1]*m[1][2] - m[0][2]*m[1][1]) * r),
+                    vec3<T>(
+                        b10 * r,
+                        (m[0][0]*m[2][2] - m[0][2]*m[2][0]) * r,
+                        (m[0][2]*m[1][0] - m[0][0]*m[1][2]) * r),
+                    vec3<T>(
+                        b20 * r,
+                        (m[0][1]*m[2][0] - m[0][0]*m[2][1]) * r,
+                        (m[0][0]*m[1][1] - m[0][1]*m[1][0]) * r),
+                };
+            }
+        };
+
+        template<typename T>
+        struct mat_inverse_s<T, 4>
+        {
+            static mat<T, 4, 4> inverse(const mat<T, 4, 4>& m) noexcept
+            {
+                // The same 2x2 minors as determinant_m(), which double as
+                // the building blocks of every 3x3 cofactor.
+                const auto s0 = m[0][0]*m[1][1] - m[1][0]*m[0][1];
+                const auto s1 = m[0][0]*m[1][2] - m[1][0]*m[0][2];
+                const auto s2 = m[0][0]*m[1][3] - m[1][0]*m[0][3];
+                const auto s3 = m[0][1]*m[1][2] - m[1][1]*m[0][2];
+                const auto s4 = m[0][1]*m[1][3] - m[1][1]*m[0][3];
+                const auto s5 = m[0][2]*m[1][3] - m[1][2]*m[0][3];
+                const auto c0 = m[2][0]*m[3][1] - m[3][0]*m[2][1];
+                const auto c1 = m[2][0]*m[3][2] - m[3][0]*m[2][2];
+                const auto c2 = m[2][0]*m[3][3] - m[3][0]*m[2][3];
+                const auto c3 = m[2][1]*m[3][2] - m[3][1]*m[2][2];
+                const auto c4 = m[2][1]*m[3][3] - m[3][1]*m[2][3];
+                const auto c5 = m[2][2]*m[3][3] - m[3][2]*m[2][3];
+                const auto r = T(1)
+                    / (s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0);
+                return {
+                    vec4<T>(
+                        (m[1][1]*c5 - m[1][2]*c4 + m[1][3]*c3) * r,
+                        (m[0][2]*c4 - m[0][1]*c5 - m[0][3]*c3) * r,
+                        (m[3][1]*s5 - m[3][2]*s4 + m[3][3]*s3) * r,
+                        (m[2][2]*s4 - m[2][1]*s5 - m[2][3]*s3) * r),
+                    vec4<T>(
+                        (m[1][2]*c2 - m[1][0]*c5 - m[1][3]*c1) * r,
+                        (m[0][0]*c5 - m[0][2]*c2 + m[0][3]*c1) * r,
+                        (m[3][2]*s2 - m[3][0]*s5 - m[3][3]*s1) * r,
+                        (m[2][0]*s5 - m[2][2]*s2 + m[2][3]*s1) * r),
+                    vec4<T>(
+                        (m[1][0]*c4 - m[1][1]*c2 + m[1][3]*c0) * r,
+                        (m[0][1]*c2 - m[0][0]*c4 - m[0][3]*c0) * r,
+                        (m[3][0]*s4 - m[3][1]*s2 + m[3][3]*s0) * r,
+                        (m[2][1]*s2 - m[2][0]*s4 - m[2][3]*s0) * r),
+                    vec4<T>(
+                        (m[1][1]*c1 - m[1][0]*c3 - m[1][2]*c0) * r,
+                        (m[0][0]*c3 - m[0][1]*c1 + m[0][2]*c0) * r,
+                        (m[3][1]*s1 - m[3][0]*s3 - m[3][2]*s0) * r,
+                        (m[2][0]*s3 - m[2][1]*s1 + m[2][2]*s0) * r),
+                };
+            }
+        };
+
+        // Inverts the upper-left DxD block as a linear map, then maps the
+        // translation in row D through it and negates it.
+        template<typename T, int C, int R>
+        inline mat<T, C, R> inverse_affine_m(const mat<T, C, R>& m) noexcept
+        {
+            constexpr int D = R - 1;
+
+            mat<T, D, D> linear;
+            for (int i = 0; i < D; ++i)
+            {
+                for (int j = 0; j < D; ++j)
+                {
+                    linear[i][j] = m[i][j];
+                }
+            }
+            const auto inv = mat_inverse_s<T, D>::inverse(linear);
+
+            mat<T, C, R> result;
+            for (int i = 0; i < D; ++i)
+            {
+                auto translation = T(0);
+                for (int j = 0; j < D; ++j)
+                {
+                    result[i][j] = inv[i][j];
+                    translation = translation - m[j][D]*inv[i][j];
+                }
+                result[i][D] = translation;
+            }
+            for (int i = D; i < C; ++i)
+            {
+                for (int j = 0; j < D; ++j)
+                {
+                    result[i][j] = T(0);
+                }
+                result[i][D] = T(1);
+            }
+            return result;
+        }
+    }
+}
+
+#ifdef TUE_SSE
+#include "mat_inverse/float4x4.sse.hpp"
+#endif
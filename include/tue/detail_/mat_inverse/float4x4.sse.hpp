@@ -0,0 +1,114 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <xmmintrin.h>
+
+#include "../../mat.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        // Intel's cofactor method from "Streaming SIMD Extensions - Inverse
+        // of 4x4 Matrix" (AP-928). It works on the transpose, with the
+        // halves of rows 1 and 3 swapped, so each product of two rows below
+        // yields the 2x2 minors of four cofactors at once.
+        template<>
+        struct mat_inverse_s<float, 4>
+        {
+            static mat<float, 4, 4> inverse(const mat<float, 4, 4>& m) noexcept
+            {
+                const auto src = m.data();
+                const auto c0 = _mm_loadu_ps(src + 0);
+                const auto c1 = _mm_loadu_ps(src + 4);
+                const auto c2 = _mm_loadu_ps(src + 8);
+                const auto c3 = _mm_loadu_ps(src + 12);
+
+                auto tmp = _mm_movelh_ps(c0, c1);
+                auto row1 = _mm_movelh_ps(c2, c3);
+                const auto row0 = _mm_shuffle_ps(tmp, row1, 0x88);
+                row1 = _mm_shuffle_ps(row1, tmp, 0xDD);
+                tmp = _mm_movehl_ps(c1, c0);
+                auto row3 = _mm_movehl_ps(c3, c2);
+                auto row2 = _mm_shuffle_ps(tmp, row3, 0x88);
+                row3 = _mm_shuffle_ps(row3, tmp, 0xDD);
+
+                tmp = _mm_mul_ps(row2, row3);
+                tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+                auto minor0 = _mm_mul_ps(row1, tmp);
+                auto minor1 = _mm_mul_ps(row0, tmp);
+                tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+                minor0 = _mm_sub_ps(_mm_mul_ps(row1, tmp), minor0);
+                minor1 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor1);
+                minor1 = _mm_shuffle_ps(minor1, minor1, 0x4E);
+
+                tmp = _mm_mul_ps(row1, row2);
+                tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+                minor0 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor0);
+                auto minor3 = _mm_mul_ps(row0, tmp);
+                tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+                minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row3, tmp));
+                minor3 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor3);
+                minor3 = _mm_shuffle_ps(minor3, minor3, 0x4E);
+
+                tmp = _mm_mul_ps(_mm_shuffle_ps(row1, row1, 0x4E), row3);
+                tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+                row2 = _mm_shuffle_ps(row2, row2, 0x4E);
+                minor0 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor0);
+                auto minor2 = _mm_mul_ps(row0, tmp);
+                tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+                minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row2, tmp));
+                minor2 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor2);
+                minor2 = _mm_shuffle_ps(minor2, minor2, 0x4E);
+
+                tmp = _mm_mul_ps(row0, row1);
+                tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+                minor2 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor2);
+                minor3 = _mm_sub_ps(_mm_mul_ps(row2, tmp), minor3);
+                tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+                minor2 = _mm_sub_ps(_mm_mul_ps(row3, tmp), minor2);
+                minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row2, tmp));
+
+                tmp = _mm_mul_ps(row0, row3);
+                tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+                minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row2, tmp));
+                minor2 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor2);
+                tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+                minor1 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor1);
+                minor2 = _mm_sub_ps(minor2, _mm_mul_ps(row1, tmp));
+
+                tmp = _mm_mul_ps(row0, row2);
+                tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+                minor1 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor1);
+                minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row1, tmp));
+                tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+                minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row3, tmp));
+                minor3 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor3);
+
+                // The paper refines _mm_rcp_ss() with a Newton-Raphson step.
+                // A real division keeps results within an ulp or two of the
+                // generic version for about the same cost.
+                auto det = _mm_mul_ps(row0, minor0);
+                det = _mm_add_ps(_mm_shuffle_ps(det, det, 0x4E), det);
+                det = _mm_add_ss(_mm_shuffle_ps(det, det, 0xB1), det);
+                det = _mm_div_ss(_mm_set_ss(1.0f), det);
+                det = _mm_shuffle_ps(det, det, 0x00);
+
+                mat<float, 4, 4> result;
+                const auto dst = result.data();
+                _mm_storeu_ps(dst + 0, _mm_mul_ps(det, minor0));
+                _mm_storeu_ps(dst + 4, _mm_mul_ps(det, minor1));
+                _mm_storeu_ps(dst + 8, _mm_mul_ps(det, minor2));
+                _mm_storeu_ps(dst + 12, _mm_mul_ps(det, minor3));
+                return result;
+            }
+        };
+    }
+}
@@ -12,6 +12,7 @@
 
 #include "../mat.hpp"
 #include "../vec.hpp"
+#include "simd_support.hpp"
 
 namespace tue
 {
@@ -228,3 +229,27 @@ namespace tue
         }
     }
 }
+
+// The SIMD specializations below stay usable in constant expressions by
+// falling back to the generic versions during constant evaluation, so
+// they're only enabled when the compiler can tell the difference.
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define TUE_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1925
+#define TUE_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+#ifdef TUE_IS_CONSTANT_EVALUATED
+
+#ifdef TUE_SSE
+#include "matmult/float.sse.hpp"
+#endif
+
+#ifdef TUE_SSE2
+#include "matmult/double.sse2.hpp"
+#endif
+
+#undef TUE_IS_CONSTANT_EVALUATED
+#endif
@@ -0,0 +1,154 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <emmintrin.h>
+
+#include "../../mat.hpp"
+#include "../../vec.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        // The same as matmult_mm_sse(), but with each column split into
+        // two halves.
+        template<int C, int N>
+        inline mat<double, C, 4> matmult_mm_sse2(
+            const mat<double, N, 4>& lhs,
+            const mat<double, C, N>& rhs) noexcept
+        {
+            __m128d lo[N];
+            __m128d hi[N];
+            for (int k = 0; k < N; ++k)
+            {
+                lo[k] = _mm_loadu_pd(lhs.data() + 4*k);
+                hi[k] = _mm_loadu_pd(lhs.data() + 4*k + 2);
+            }
+
+            mat<double, C, 4> result;
+            for (int i = 0; i < C; ++i)
+            {
+                auto s = _mm_set1_pd(rhs[i][0]);
+                auto sum_lo = _mm_mul_pd(lo[0], s);
+                auto sum_hi = _mm_mul_pd(hi[0], s);
+                for (int k = 1; k < N; ++k)
+                {
+                    s = _mm_set1_pd(rhs[i][k]);
+                    sum_lo = _mm_add_pd(sum_lo, _mm_mul_pd(lo[k], s));
+                    sum_hi = _mm_add_pd(sum_hi, _mm_mul_pd(hi[k], s));
+                }
+                _mm_storeu_pd(result.data() + 4*i, sum_lo);
+                _mm_storeu_pd(result.data() + 4*i + 2, sum_hi);
+            }
+            return result;
+        }
+
+        inline vec4<double> matmult_mv_sse2(
+            const mat<double, 4, 4>& lhs, const vec4<double>& rhs) noexcept
+        {
+            const auto p = lhs.data();
+            auto s = _mm_set1_pd(rhs[0]);
+            auto sum_lo = _mm_mul_pd(_mm_loadu_pd(p), s);
+            auto sum_hi = _mm_mul_pd(_mm_loadu_pd(p + 2), s);
+            for (int k = 1; k < 4; ++k)
+            {
+                s = _mm_set1_pd(rhs[k]);
+                sum_lo = _mm_add_pd(
+                    sum_lo, _mm_mul_pd(_mm_loadu_pd(p + 4*k), s));
+                sum_hi = _mm_add_pd(
+                    sum_hi, _mm_mul_pd(_mm_loadu_pd(p + 4*k + 2), s));
+            }
+
+            vec4<double> result;
+            _mm_storeu_pd(result.data(), sum_lo);
+            _mm_storeu_pd(result.data() + 2, sum_hi);
+            return result;
+        }
+
+        // Pairs up the partial dot products of neighboring columns so each
+        // pair finishes with one unpack and one add.
+        inline vec4<double> matmult_vm_sse2(
+            const vec4<double>& lhs, const mat<double, 4, 4>& rhs) noexcept
+        {
+            const auto v_lo = _mm_loadu_pd(lhs.data());
+            const auto v_hi = _mm_loadu_pd(lhs.data() + 2);
+            const auto p = rhs.data();
+
+            __m128d partial[4];
+            for (int i = 0; i < 4; ++i)
+            {
+                partial[i] = _mm_add_pd(
+                    _mm_mul_pd(v_lo, _mm_loadu_pd(p + 4*i)),
+                    _mm_mul_pd(v_hi, _mm_loadu_pd(p + 4*i + 2)));
+            }
+
+            vec4<double> result;
+            _mm_storeu_pd(result.data(), _mm_add_pd(
+                _mm_unpacklo_pd(partial[0], partial[1]),
+                _mm_unpackhi_pd(partial[0], partial[1])));
+            _mm_storeu_pd(result.data() + 2, _mm_add_pd(
+                _mm_unpacklo_pd(partial[2], partial[3]),
+                _mm_unpackhi_pd(partial[2], partial[3])));
+            return result;
+        }
+
+        inline constexpr mat<double, 4, 4> multiplication_operator_mm(
+            const mat<double, 4, 4>& lhs,
+            const mat<double, 4, 4>& rhs) noexcept
+        {
+            return TUE_IS_CONSTANT_EVALUATED()
+                ? multiplication_operator_mm<double, double, 4, 4>(lhs, rhs)
+                : matmult_mm_sse2(lhs, rhs);
+        }
+
+        inline constexpr mat<double, 3, 4> multiplication_operator_mm(
+            const mat<double, 4, 4>& lhs,
+            const mat<double, 3, 4>& rhs) noexcept
+        {
+            return TUE_IS_CONSTANT_EVALUATED()
+                ? multiplication_operator_mm<double, double, 4, 4>(lhs, rhs)
+                : matmult_mm_sse2(lhs, rhs);
+        }
+
+        inline constexpr mat<double, 4, 4> multiplication_operator_mm(
+            const mat<double, 3, 4>& lhs,
+            const mat<double, 4, 3>& rhs) noexcept
+        {
+            return TUE_IS_CONSTANT_EVALUATED()
+                ? multiplication_operator_mm<double, double, 3, 4>(lhs, rhs)
+                : matmult_mm_sse2(lhs, rhs);
+        }
+
+        inline constexpr mat<double, 3, 4> multiplication_operator_mm(
+            const mat<double, 3, 4>& lhs,
+            const mat<double, 3, 3>& rhs) noexcept
+        {
+            return TUE_IS_CONSTANT_EVALUATED()
+                ? multiplication_operator_mm<double, double, 3, 4>(lhs, rhs)
+                : matmult_mm_sse2(lhs, rhs);
+        }
+
+        inline constexpr vec4<double> multiplication_operator_mv(
+            const mat<double, 4, 4>& lhs, const vec4<double>& rhs) noexcept
+        {
+            return TUE_IS_CONSTANT_EVALUATED()
+                ? multiplication_operator_mv<double, double, 4>(lhs, rhs)
+                : matmult_mv_sse2(lhs, rhs);
+        }
+
+        inline constexpr vec4<double> multiplication_operator_vm(
+            const vec4<double>& lhs, const mat<double, 4, 4>& rhs) noexcept
+        {
+            return TUE_IS_CONSTANT_EVALUATED()
+                ? multiplication_operator_vm<double, double, 4>(lhs, rhs)
+                : matmult_vm_sse2(lhs, rhs);
+        }
+    }
+}
@@ -0,0 +1,130 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <xmmintrin.h>
+
+#include "../../mat.hpp"
+#include "../../vec.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        // Each column of the result is a sum of the columns of lhs, each
+        // scaled by a broadcast component of the matching column of rhs.
+        template<int C, int N>
+        inline mat<float, C, 4> matmult_mm_sse(
+            const mat<float, N, 4>& lhs, const mat<float, C, N>& rhs) noexcept
+        {
+            __m128 columns[N];
+            for (int k = 0; k < N; ++k)
+            {
+                columns[k] = _mm_loadu_ps(lhs.data() + 4*k);
+            }
+
+            mat<float, C, 4> result;
+            for (int i = 0; i < C; ++i)
+            {
+                auto sum = _mm_mul_ps(columns[0], _mm_set1_ps(rhs[i][0]));
+                for (int k = 1; k < N; ++k)
+                {
+                    sum = _mm_add_ps(sum, _mm_mul_ps(
+                        columns[k], _mm_set1_ps(rhs[i][k])));
+                }
+                _mm_storeu_ps(result.data() + 4*i, sum);
+            }
+            return result;
+        }
+
+        inline vec4<float> matmult_mv_sse(
+            const mat<float, 4, 4>& lhs, const vec4<float>& rhs) noexcept
+        {
+            const auto p = lhs.data();
+            auto sum = _mm_mul_ps(_mm_loadu_ps(p), _mm_set1_ps(rhs[0]));
+            sum = _mm_add_ps(sum, _mm_mul_ps(
+                _mm_loadu_ps(p + 4), _mm_set1_ps(rhs[1])));
+            sum = _mm_add_ps(sum, _mm_mul_ps(
+                _mm_loadu_ps(p + 8), _mm_set1_ps(rhs[2])));
+            sum = _mm_add_ps(sum, _mm_mul_ps(
+                _mm_loadu_ps(p + 12), _mm_set1_ps(rhs[3])));
+
+            vec4<float> result;
+            _mm_storeu_ps(result.data(), sum);
+            return result;
+        }
+
+        // Multiplies lhs by every column, then transposes the products so
+        // the four dot products finish with vertical adds.
+        inline vec4<float> matmult_vm_sse(
+            const vec4<float>& lhs, const mat<float, 4, 4>& rhs) noexcept
+        {
+            const auto v = _mm_loadu_ps(lhs.data());
+            const auto p = rhs.data();
+            auto p0 = _mm_mul_ps(v, _mm_loadu_ps(p));
+            auto p1 = _mm_mul_ps(v, _mm_loadu_ps(p + 4));
+            auto p2 = _mm_mul_ps(v, _mm_loadu_ps(p + 8));
+            auto p3 = _mm_mul_ps(v, _mm_loadu_ps(p + 12));
+            _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+            vec4<float> result;
+            _mm_storeu_ps(result.data(), _mm_add_ps(
+                _mm_add_ps(p0, p1), _mm_add_ps(p2, p3)));
+            return result;
+        }
+
+        inline constexpr mat<float, 4, 4> multiplication_operator_mm(
+            const mat<float, 4, 4>& lhs, const mat<float, 4, 4>& rhs) noexcept
+        {
+            return TUE_IS_CONSTANT_EVALUATED()
+                ? multiplication_operator_mm<float, float, 4, 4>(lhs, rhs)
+                : matmult_mm_sse(lhs, rhs);
+        }
+
+        inline constexpr mat<float, 3, 4> multiplication_operator_mm(
+            const mat<float, 4, 4>& lhs, const mat<float, 3, 4>& rhs) noexcept
+        {
+            return TUE_IS_CONSTANT_EVALUATED()
+                ? multiplication_operator_mm<float, float, 4, 4>(lhs, rhs)
+                : matmult_mm_sse(lhs, rhs);
+        }
+
+        inline constexpr mat<float, 4, 4> multiplication_operator_mm(
+            const mat<float, 3, 4>& lhs, const mat<float, 4, 3>& rhs) noexcept
+        {
+            return TUE_IS_CONSTANT_EVALUATED()
+                ? multiplication_operator_mm<float, float, 3, 4>(lhs, rhs)
+                : matmult_mm_sse(lhs, rhs);
+        }
+
+        inline constexpr mat<float, 3, 4> multiplication_operator_mm(
+            const mat<float, 3, 4>& lhs, const mat<float, 3, 3>& rhs) noexcept
+        {
+            return TUE_IS_CONSTANT_EVALUATED()
+                ? multiplication_operator_mm<float, float, 3, 4>(lhs, rhs)
+                : matmult_mm_sse(lhs, rhs);
+        }
+
+        inline constexpr vec4<float> multiplication_operator_mv(
+            const mat<float, 4, 4>& lhs, const vec4<float>& rhs) noexcept
+        {
+            return TUE_IS_CONSTANT_EVALUATED()
+                ? multiplication_operator_mv<float, float, 4>(lhs, rhs)
+                : matmult_mv_sse(lhs, rhs);
+        }
+
+        inline constexpr vec4<float> multiplication_operator_vm(
+            const vec4<float>& lhs, const mat<float, 4, 4>& rhs) noexcept
+        {
+            return TUE_IS_CONSTANT_EVALUATED()
+                ? multiplication_operator_vm<float, float, 4>(lhs, rhs)
+                : matmult_vm_sse(lhs, rhs);
+        }
+    }
+}
@@ -0,0 +1,288 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <type_traits>
+
+#include "../../../simd.hpp"
+#include "../../../sized_bool.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<bool32, 8>())
+    simd<bool32, 8>
+    {
+        __m256 underlying_;
+
+    private:
+        template<typename U>
+        static bool32x8 explicit_cast(const simd<U, 8>& s) noexcept
+        {
+            return {
+                bool32(s.data()[0]),
+                bool32(s.data()[1]),
+                bool32(s.data()[2]),
+                bool32(s.data()[3]),
+                bool32(s.data()[4]),
+                bool32(s.data()[5]),
+                bool32(s.data()[6]),
+                bool32(s.data()[7]),
+            };
+        }
+
+    public:
+        using component_type = bool32;
+
+        static constexpr int component_count = 8;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(bool32 x) noexcept
+        :
+            underlying_(_mm256_set1_ps(tue::detail_::binary_float(x)))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            bool32 x, bool32 y) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            bool32 x, bool32 y, bool32 z, bool32 w) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            bool32 s0, bool32 s1, bool32 s2, bool32 s3,
+            bool32 s4, bool32 s5, bool32 s6, bool32 s7) noexcept
+        :
+            underlying_(_mm256_setr_ps(
+                tue::detail_::binary_float(s0),
+                tue::detail_::binary_float(s1),
+                tue::detail_::binary_float(s2),
+                tue::detail_::binary_float(s3),
+                tue::detail_::binary_float(s4),
+                tue::detail_::binary_float(s5),
+                tue::detail_::binary_float(s6),
+                tue::detail_::binary_float(s7)))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            bool32  s0, bool32  s1, bool32  s2, bool32  s3,
+            bool32  s4, bool32  s5, bool32  s6, bool32  s7,
+            bool32  s8, bool32  s9, bool32 s10, bool32 s11,
+            bool32 s12, bool32 s13, bool32 s14, bool32 s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 8>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256 underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256() const noexcept
+        {
+            return underlying_;
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(_mm256_castsi256_ps(underlying))
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return _mm256_castps_si256(underlying_);
+        }
+
+        static bool32x8 zero() noexcept
+        {
+            return _mm256_setzero_ps();
+        }
+
+        static bool32x8 load(const bool32* data) noexcept
+        {
+            return _mm256_load_ps(reinterpret_cast<const float*>(data));
+        }
+
+        static bool32x8 loadu(const bool32* data) noexcept
+        {
+            return _mm256_loadu_ps(reinterpret_cast<const float*>(data));
+        }
+
+        static bool32x8 load_partial(const bool32* data, int count) noexcept
+        {
+            const auto mask = tue::detail_::partial_mask_s<bool32, 8>(count);
+            const auto vmask = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(mask));
+            return _mm256_maskload_ps(
+                reinterpret_cast<const float*>(data), vmask);
+        }
+
+        static bool32x8 maskload(
+            const bool32* data, const bool32x8& conditions) noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            return _mm256_maskload_ps(
+                reinterpret_cast<const float*>(data), vmask);
+        }
+
+        void store(bool32* data) const noexcept
+        {
+            _mm256_store_ps(reinterpret_cast<float*>(data), underlying_);
+        }
+
+        void storeu(bool32* data) const noexcept
+        {
+            _mm256_storeu_ps(reinterpret_cast<float*>(data), underlying_);
+        }
+
+        void store_stream(bool32* data) const noexcept
+        {
+            _mm256_stream_ps(reinterpret_cast<float*>(data), underlying_);
+        }
+
+        void store_partial(bool32* data, int count) const noexcept
+        {
+            const auto mask = tue::detail_::partial_mask_s<bool32, 8>(count);
+            const auto vmask = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(mask));
+            _mm256_maskstore_ps(
+                reinterpret_cast<float*>(data), vmask, underlying_);
+        }
+
+        void maskstore(
+            bool32* data, const bool32x8& conditions) const noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            _mm256_maskstore_ps(
+                reinterpret_cast<float*>(data), vmask, underlying_);
+        }
+
+        const bool32* data() const noexcept
+        {
+            return reinterpret_cast<const bool32*>(&underlying_);
+        }
+
+        bool32* data() noexcept
+        {
+            return reinterpret_cast<bool32*>(&underlying_);
+        }
+    };
+}
+
+namespace tue
+{
+    namespace detail_
+    {
+        inline bool32x8 bitwise_not_operator_s(
+            const bool32x8& s) noexcept
+        {
+            return _mm256_xor_ps(s, bool32x8(true32));
+        }
+
+        inline bool32x8 bitwise_and_operator_ss(
+            const bool32x8& lhs, const bool32x8& rhs) noexcept
+        {
+            return _mm256_and_ps(lhs, rhs);
+        }
+
+        inline bool32x8 bitwise_or_operator_ss(
+            const bool32x8& lhs, const bool32x8& rhs) noexcept
+        {
+            return _mm256_or_ps(lhs, rhs);
+        }
+
+        inline bool32x8 bitwise_xor_operator_ss(
+            const bool32x8& lhs, const bool32x8& rhs) noexcept
+        {
+            return _mm256_xor_ps(lhs, rhs);
+        }
+
+        inline bool32x8& bitwise_and_assignment_operator_ss(
+            bool32x8& lhs, const bool32x8& rhs) noexcept
+        {
+            return lhs = _mm256_and_ps(lhs, rhs);
+        }
+
+        inline bool32x8& bitwise_or_assignment_operator_ss(
+            bool32x8& lhs, const bool32x8& rhs) noexcept
+        {
+            return lhs = _mm256_or_ps(lhs, rhs);
+        }
+
+        inline bool32x8& bitwise_xor_assignment_operator_ss(
+            bool32x8& lhs, const bool32x8& rhs) noexcept
+        {
+            return lhs = _mm256_xor_ps(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const bool32x8& lhs, const bool32x8& rhs) noexcept
+        {
+            const __m256i diff = bool32x8(_mm256_xor_ps(lhs, rhs));
+            return _mm256_testz_si256(diff, diff) != 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const bool32x8& lhs, const bool32x8& rhs) noexcept
+        {
+            const __m256i diff = bool32x8(_mm256_xor_ps(lhs, rhs));
+            return _mm256_testz_si256(diff, diff) == 0;
+        }
+
+        inline bool32x8 mask_ss(
+            const bool32x8& conditions,
+            const bool32x8& values) noexcept
+        {
+            return _mm256_and_ps(conditions, values);
+        }
+
+        inline bool32x8 select_sss(
+            const bool32x8& conditions,
+            const bool32x8& values,
+            const bool32x8& otherwise) noexcept
+        {
+            return _mm256_blendv_ps(otherwise, values, conditions);
+        }
+
+#ifdef TUE_AVX2
+        inline bool32x8 equal_ss(
+            const bool32x8& lhs, const bool32x8& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi32(lhs, rhs);
+        }
+
+        inline bool32x8 not_equal_ss(
+            const bool32x8& lhs, const bool32x8& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi32(lhs, rhs), bool32x8(true32));
+        }
+#endif
+
+        inline std::uint64_t movemask_s(const bool32x8& s) noexcept
+        {
+            return static_cast<std::uint64_t>(_mm256_movemask_ps(s));
+        }
+    }
+}
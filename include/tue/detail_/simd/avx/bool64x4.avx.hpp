@@ -0,0 +1,280 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <type_traits>
+
+#include "../../../simd.hpp"
+#include "../../../sized_bool.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<bool64, 4>())
+    simd<bool64, 4>
+    {
+        __m256d underlying_;
+
+    private:
+        template<typename U>
+        static bool64x4 explicit_cast(const simd<U, 4>& s) noexcept
+        {
+            return {
+                bool64(s.data()[0]),
+                bool64(s.data()[1]),
+                bool64(s.data()[2]),
+                bool64(s.data()[3]),
+            };
+        }
+
+    public:
+        using component_type = bool64;
+
+        static constexpr int component_count = 4;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(bool64 x) noexcept
+        :
+            underlying_(_mm256_set1_pd(tue::detail_::binary_double(x)))
+        {
+        }
+
+        template<int M = 4, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            bool64 x, bool64 y) noexcept;
+
+        template<int M = 4, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            bool64 x, bool64 y, bool64 z, bool64 w) noexcept
+        :
+            underlying_(_mm256_setr_pd(
+                tue::detail_::binary_double(x),
+                tue::detail_::binary_double(y),
+                tue::detail_::binary_double(z),
+                tue::detail_::binary_double(w)))
+        {
+        }
+
+        template<int M = 4, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            bool64 s0, bool64 s1, bool64 s2, bool64 s3,
+            bool64 s4, bool64 s5, bool64 s6, bool64 s7) noexcept;
+
+        template<int M = 4, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            bool64  s0, bool64  s1, bool64  s2, bool64  s3,
+            bool64  s4, bool64  s5, bool64  s6, bool64  s7,
+            bool64  s8, bool64  s9, bool64 s10, bool64 s11,
+            bool64 s12, bool64 s13, bool64 s14, bool64 s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 4>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256d underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256d() const noexcept
+        {
+            return underlying_;
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(_mm256_castsi256_pd(underlying))
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return _mm256_castpd_si256(underlying_);
+        }
+
+        static bool64x4 zero() noexcept
+        {
+            return _mm256_setzero_pd();
+        }
+
+        static bool64x4 load(const bool64* data) noexcept
+        {
+            return _mm256_load_pd(reinterpret_cast<const double*>(data));
+        }
+
+        static bool64x4 loadu(const bool64* data) noexcept
+        {
+            return _mm256_loadu_pd(reinterpret_cast<const double*>(data));
+        }
+
+        static bool64x4 load_partial(const bool64* data, int count) noexcept
+        {
+            const auto mask = tue::detail_::partial_mask_s<bool64, 4>(count);
+            const auto vmask = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(mask));
+            return _mm256_maskload_pd(
+                reinterpret_cast<const double*>(data), vmask);
+        }
+
+        static bool64x4 maskload(
+            const bool64* data, const bool64x4& conditions) noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            return _mm256_maskload_pd(
+                reinterpret_cast<const double*>(data), vmask);
+        }
+
+        void store(bool64* data) const noexcept
+        {
+            _mm256_store_pd(reinterpret_cast<double*>(data), underlying_);
+        }
+
+        void storeu(bool64* data) const noexcept
+        {
+            _mm256_storeu_pd(reinterpret_cast<double*>(data), underlying_);
+        }
+
+        void store_stream(bool64* data) const noexcept
+        {
+            _mm256_stream_pd(reinterpret_cast<double*>(data), underlying_);
+        }
+
+        void store_partial(bool64* data, int count) const noexcept
+        {
+            const auto mask = tue::detail_::partial_mask_s<bool64, 4>(count);
+            const auto vmask = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(mask));
+            _mm256_maskstore_pd(
+                reinterpret_cast<double*>(data), vmask, underlying_);
+        }
+
+        void maskstore(
+            bool64* data, const bool64x4& conditions) const noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            _mm256_maskstore_pd(
+                reinterpret_cast<double*>(data), vmask, underlying_);
+        }
+
+        const bool64* data() const noexcept
+        {
+            return reinterpret_cast<const bool64*>(&underlying_);
+        }
+
+        bool64* data() noexcept
+        {
+            return reinterpret_cast<bool64*>(&underlying_);
+        }
+    };
+}
+
+namespace tue
+{
+    namespace detail_
+    {
+        inline bool64x4 bitwise_not_operator_s(
+            const bool64x4& s) noexcept
+        {
+            return _mm256_xor_pd(s, bool64x4(true64));
+        }
+
+        inline bool64x4 bitwise_and_operator_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return _mm256_and_pd(lhs, rhs);
+        }
+
+        inline bool64x4 bitwise_or_operator_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return _mm256_or_pd(lhs, rhs);
+        }
+
+        inline bool64x4 bitwise_xor_operator_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return _mm256_xor_pd(lhs, rhs);
+        }
+
+        inline bool64x4& bitwise_and_assignment_operator_ss(
+            bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return lhs = _mm256_and_pd(lhs, rhs);
+        }
+
+        inline bool64x4& bitwise_or_assignment_operator_ss(
+            bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return lhs = _mm256_or_pd(lhs, rhs);
+        }
+
+        inline bool64x4& bitwise_xor_assignment_operator_ss(
+            bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return lhs = _mm256_xor_pd(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            const __m256i diff = bool64x4(_mm256_xor_pd(lhs, rhs));
+            return _mm256_testz_si256(diff, diff) != 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            const __m256i diff = bool64x4(_mm256_xor_pd(lhs, rhs));
+            return _mm256_testz_si256(diff, diff) == 0;
+        }
+
+        inline bool64x4 mask_ss(
+            const bool64x4& conditions,
+            const bool64x4& values) noexcept
+        {
+            return _mm256_and_pd(conditions, values);
+        }
+
+        inline bool64x4 select_sss(
+            const bool64x4& conditions,
+            const bool64x4& values,
+            const bool64x4& otherwise) noexcept
+        {
+            return _mm256_blendv_pd(otherwise, values, conditions);
+        }
+
+#ifdef TUE_AVX2
+        inline bool64x4 equal_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi64(lhs, rhs);
+        }
+
+        inline bool64x4 not_equal_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi64(lhs, rhs), bool64x4(true64));
+        }
+#endif
+
+        inline std::uint64_t movemask_s(const bool64x4& s) noexcept
+        {
+            return static_cast<std::uint64_t>(_mm256_movemask_pd(s));
+        }
+    }
+}
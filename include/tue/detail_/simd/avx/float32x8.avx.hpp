@@ -0,0 +1,846 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+// This file contains code based on Julien Pommier's sse_mathfun.h originally
+// published at http://gruntthepeon.free.fr/ssemath/ under the following
+// license:
+//
+// Copyright (C) 2007 Julien Pommier
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from
+// the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software in
+//    a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// (this is the zlib license)
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<float, 8>())
+    simd<float, 8>
+    {
+        __m256 underlying_;
+
+    private:
+        template<typename U>
+        static float32x8 explicit_cast(const simd<U, 8>& s) noexcept
+        {
+            return {
+                float(s.data()[0]),
+                float(s.data()[1]),
+                float(s.data()[2]),
+                float(s.data()[3]),
+                float(s.data()[4]),
+                float(s.data()[5]),
+                float(s.data()[6]),
+                float(s.data()[7]),
+            };
+        }
+
+    public:
+        using component_type = float;
+
+        static constexpr int component_count = 8;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(float x) noexcept
+        :
+            underlying_(_mm256_set1_ps(x))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            float x, float y) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            float x, float y, float z, float w) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            float s0, float s1, float s2, float s3,
+            float s4, float s5, float s6, float s7) noexcept
+        :
+            underlying_(_mm256_setr_ps(s0, s1, s2, s3, s4, s5, s6, s7))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            float  s0, float  s1, float  s2, float  s3,
+            float  s4, float  s5, float  s6, float  s7,
+            float  s8, float  s9, float s10, float s11,
+            float s12, float s13, float s14, float s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 8>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256 underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256() const noexcept
+        {
+            return underlying_;
+        }
+
+        static float32x8 zero() noexcept
+        {
+            return _mm256_setzero_ps();
+        }
+
+        static float32x8 load(const float* data) noexcept
+        {
+            return _mm256_load_ps(data);
+        }
+
+        static float32x8 loadu(const float* data) noexcept
+        {
+            return _mm256_loadu_ps(data);
+        }
+
+        static float32x8 gather(
+            const float* base, const int32x8& indices) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = reinterpret_cast<const __m256i&>(indices);
+            return _mm256_i32gather_ps(base, vindex, 4);
+#else
+            return tue::detail_::gather_s<float, 8>(base, indices);
+#endif
+        }
+
+        static float32x8 gather(
+            const float* base,
+            const int32x8& indices,
+            const bool32x8& conditions) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = reinterpret_cast<const __m256i&>(indices);
+            const auto vmask = reinterpret_cast<const __m256&>(conditions);
+            return _mm256_mask_i32gather_ps(
+                _mm256_setzero_ps(), base, vindex, vmask, 4);
+#else
+            return tue::detail_::gather_s<float, 8>(base, indices, conditions);
+#endif
+        }
+
+        static float32x8 load_partial(const float* data, int count) noexcept
+        {
+            const auto mask = tue::detail_::partial_mask_s<bool32, 8>(count);
+            const auto vmask = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(mask));
+            return _mm256_maskload_ps(data, vmask);
+        }
+
+        static float32x8 maskload(
+            const float* data, const bool32x8& conditions) noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            return _mm256_maskload_ps(data, vmask);
+        }
+
+        void store(float* data) const noexcept
+        {
+            _mm256_store_ps(data, underlying_);
+        }
+
+        void storeu(float* data) const noexcept
+        {
+            _mm256_storeu_ps(data, underlying_);
+        }
+
+        void store_stream(float* data) const noexcept
+        {
+            _mm256_stream_ps(data, underlying_);
+        }
+
+        void scatter(float* base, const int32x8& indices) const noexcept
+        {
+            tue::detail_::scatter_s<8>(this->data(), base, indices);
+        }
+
+        void scatter(
+            float* base,
+            const int32x8& indices,
+            const bool32x8& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<8>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(float* data, int count) const noexcept
+        {
+            const auto mask = tue::detail_::partial_mask_s<bool32, 8>(count);
+            const auto vmask = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(mask));
+            _mm256_maskstore_ps(data, vmask, underlying_);
+        }
+
+        void maskstore(
+            float* data, const bool32x8& conditions) const noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            _mm256_maskstore_ps(data, vmask, underlying_);
+        }
+
+        const float* data() const noexcept
+        {
+            return reinterpret_cast<const float*>(&underlying_);
+        }
+
+        float* data() noexcept
+        {
+            return reinterpret_cast<float*>(&underlying_);
+        }
+    };
+}
+
+#include "bool32x8.avx.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        inline float32x8 unary_plus_operator_s(const float32x8& s) noexcept
+        {
+            return s;
+        }
+
+        inline float32x8& pre_increment_operator_s(float32x8& s) noexcept
+        {
+            return s = _mm256_add_ps(s, float32x8(1.0f));
+        }
+
+        inline float32x8 post_increment_operator_s(float32x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_ps(s, float32x8(1.0f));
+            return result;
+        }
+
+        inline float32x8 unary_minus_operator_s(const float32x8& s) noexcept
+        {
+            return _mm256_xor_ps(s, float32x8(binary_float(0x80000000u)));
+        }
+
+        inline float32x8& pre_decrement_operator_s(float32x8& s) noexcept
+        {
+            return s = _mm256_sub_ps(s, float32x8(1.0f));
+        }
+
+        inline float32x8 post_decrement_operator_s(float32x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_ps(s, float32x8(1.0f));
+            return result;
+        }
+
+        inline float32x8 addition_operator_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_add_ps(lhs, rhs);
+        }
+
+        inline float32x8 subtraction_operator_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_sub_ps(lhs, rhs);
+        }
+
+        inline float32x8 multiplication_operator_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_mul_ps(lhs, rhs);
+        }
+
+        inline float32x8 division_operator_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_div_ps(lhs, rhs);
+        }
+
+        inline float32x8& addition_assignment_operator_ss(
+            float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return lhs = _mm256_add_ps(lhs, rhs);
+        }
+
+        inline float32x8& subtraction_assignment_operator_ss(
+            float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return lhs = _mm256_sub_ps(lhs, rhs);
+        }
+
+        inline float32x8& multiplication_assignment_operator_ss(
+            float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return lhs = _mm256_mul_ps(lhs, rhs);
+        }
+
+        inline float32x8& division_assignment_operator_ss(
+            float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return lhs = _mm256_div_ps(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_movemask_ps(
+                _mm256_cmp_ps(lhs, rhs, _CMP_NEQ_UQ)) == 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_movemask_ps(
+                _mm256_cmp_ps(lhs, rhs, _CMP_NEQ_UQ)) != 0;
+        }
+
+#ifdef TUE_AVX2
+        inline void sincos_s(
+            const float32x8& s,
+            float32x8& sin_out,
+            float32x8& cos_out) noexcept
+        {
+            // This function's implementation is based on Julien Pommier's
+            // sincos_ps(). See the top of this file for details.
+            __m256 x = s;
+
+            __m256 xmm1, xmm2, xmm3, sign_bit_sin, y;
+            __m256i emm0, emm2, emm4;
+
+            sign_bit_sin = x;
+
+            /* take the absolute value */
+            x = _mm256_and_ps(x, _mm256_set1_ps(binary_float(~0x80000000)));
+
+            /* extract the sign bit (upper one) */
+            sign_bit_sin = _mm256_and_ps(
+                sign_bit_sin, _mm256_set1_ps(binary_float(0x80000000)));
+
+            /* scale by 4/Pi */
+            y = _mm256_mul_ps(x, _mm256_set1_ps(1.27323954473516f));
+
+            /* store the integer part of y in emm2 */
+            emm2 = _mm256_cvttps_epi32(y);
+
+            /* j=(j+1) & (~1) (see the cephes sources) */
+            emm2 = _mm256_add_epi32(emm2, _mm256_set1_epi32(1));
+            emm2 = _mm256_and_si256(emm2, _mm256_set1_epi32(~1));
+            y = _mm256_cvtepi32_ps(emm2);
+
+            emm4 = emm2;
+
+            /* get the swap sign flag for the sine */
+            emm0 = _mm256_and_si256(emm2, _mm256_set1_epi32(4));
+            emm0 = _mm256_slli_epi32(emm0, 29);
+            __m256 swap_sign_bit_sin = _mm256_castsi256_ps(emm0);
+
+            /* get the polynom selection mask for the sine*/
+            emm2 = _mm256_and_si256(emm2, _mm256_set1_epi32(2));
+            emm2 = _mm256_cmpeq_epi32(emm2, _mm256_setzero_si256());
+            __m256 poly_mask = _mm256_castsi256_ps(emm2);
+
+            /* get the sign flag for the cosine */
+            emm4 = _mm256_sub_epi32(emm4, _mm256_set1_epi32(2));
+            emm4 = _mm256_andnot_si256(emm4, _mm256_set1_epi32(4));
+            emm4 = _mm256_slli_epi32(emm4, 29);
+            __m256 sign_bit_cos = _mm256_castsi256_ps(emm4);
+
+            sign_bit_sin = _mm256_xor_ps(sign_bit_sin, swap_sign_bit_sin);
+
+            /* The magic pass: "Extended precision modular arithmetic"
+               x = ((x - y * DP1) - y * DP2) - y * DP3; */
+            xmm1 = _mm256_set1_ps(-0.78515625f);
+            xmm2 = _mm256_set1_ps(-2.4187564849853515625e-4f);
+            xmm3 = _mm256_set1_ps(-3.77489497744594108e-8f);
+            xmm1 = _mm256_mul_ps(y, xmm1);
+            xmm2 = _mm256_mul_ps(y, xmm2);
+            xmm3 = _mm256_mul_ps(y, xmm3);
+            x = _mm256_add_ps(x, xmm1);
+            x = _mm256_add_ps(x, xmm2);
+            x = _mm256_add_ps(x, xmm3);
+
+            /* Evaluate the first polynom  (0 <= x <= Pi/4) */
+            __m256 z = _mm256_mul_ps(x,x);
+            y = _mm256_set1_ps(2.443315711809948e-5f);
+
+            y = _mm256_mul_ps(y, z);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-1.388731625493765e-3f));
+            y = _mm256_mul_ps(y, z);
+            y = _mm256_add_ps(y, _mm256_set1_ps(4.166664568298827e-2f));
+            y = _mm256_mul_ps(y, z);
+            y = _mm256_mul_ps(y, z);
+            __m256 tmp = _mm256_mul_ps(z, _mm256_set1_ps(0.5f));
+            y = _mm256_sub_ps(y, tmp);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.0f));
+
+            /* Evaluate the second polynom  (Pi/4 <= x <= 0) */
+            __m256 y2 = _mm256_set1_ps(-1.9515295891e-4f);
+            y2 = _mm256_mul_ps(y2, z);
+            y2 = _mm256_add_ps(y2, _mm256_set1_ps(8.3321608736e-3f));
+            y2 = _mm256_mul_ps(y2, z);
+            y2 = _mm256_add_ps(y2, _mm256_set1_ps(-1.6666654611e-1f));
+            y2 = _mm256_mul_ps(y2, z);
+            y2 = _mm256_mul_ps(y2, x);
+            y2 = _mm256_add_ps(y2, x);
+
+            /* select the correct result from the two polynoms */
+            xmm3 = poly_mask;
+            __m256 ysin2 = _mm256_and_ps(xmm3, y2);
+            __m256 ysin1 = _mm256_andnot_ps(xmm3, y);
+            y2 = _mm256_sub_ps(y2,ysin2);
+            y = _mm256_sub_ps(y, ysin1);
+
+            xmm1 = _mm256_add_ps(ysin1,ysin2);
+            xmm2 = _mm256_add_ps(y,y2);
+
+            /* update the sign */
+            sin_out = _mm256_xor_ps(xmm1, sign_bit_sin);
+            cos_out = _mm256_xor_ps(xmm2, sign_bit_cos);
+        }
+
+        inline float32x8 sin_s(const float32x8& s) noexcept
+        {
+            float32x8 sin, cos;
+            sincos_s(s, sin, cos);
+            return sin;
+        }
+
+        inline float32x8 cos_s(const float32x8& s) noexcept
+        {
+            float32x8 sin, cos;
+            sincos_s(s, sin, cos);
+            return cos;
+        }
+
+        inline float32x8 exp_s(const float32x8& s) noexcept
+        {
+            // This function's implementation is based on Julien Pommier's
+            // exp_ps(). See the top of this file for details.
+            __m256 x = s;
+
+            __m256 tmp, fx;
+            __m256i emm0;
+
+            __m256 one = _mm256_set1_ps(1.0f);
+
+            x = _mm256_min_ps(x, _mm256_set1_ps(88.3762626647949f));
+            x = _mm256_max_ps(x, _mm256_set1_ps(-88.3762626647949f));
+
+            /* express exp(x) as exp(g + n*log(2)) */
+            fx = _mm256_mul_ps(x, _mm256_set1_ps(1.44269504088896341f));
+            fx = _mm256_add_ps(fx, _mm256_set1_ps(0.5f));
+            fx = _mm256_floor_ps(fx);
+
+            tmp = _mm256_mul_ps(fx, _mm256_set1_ps(0.693359375f));
+            __m256 z = _mm256_mul_ps(fx, _mm256_set1_ps(-2.12194440e-4f));
+            x = _mm256_sub_ps(x, tmp);
+            x = _mm256_sub_ps(x, z);
+
+            z = _mm256_mul_ps(x, x);
+
+            __m256 y = _mm256_set1_ps(1.9875691500e-4f);
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.3981999507e-3f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(8.3334519073e-3f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(4.1665795894e-2f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.6666665459e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(5.0000001201e-1f));
+            y = _mm256_mul_ps(y, z);
+            y = _mm256_add_ps(y, x);
+            y = _mm256_add_ps(y, one);
+
+            /* build 2^n */
+            emm0 = _mm256_cvttps_epi32(fx);
+            emm0 = _mm256_add_epi32(emm0, _mm256_set1_epi32(0x7F));
+            emm0 = _mm256_slli_epi32(emm0, 23);
+            __m256 pow2n = _mm256_castsi256_ps(emm0);
+
+            y = _mm256_mul_ps(y, pow2n);
+            return y;
+        }
+
+        inline float32x8 log_s(const float32x8& s) noexcept
+        {
+            // This function's implementation is based on Julien Pommier's
+            // log_ps(). See the top of this file for details.
+            __m256 x = s;
+
+            __m256i emm0;
+
+            __m256 one = _mm256_set1_ps(1.0f);
+
+            __m256 invalid_mask = _mm256_cmp_ps(
+                x, _mm256_setzero_ps(), _CMP_LE_OQ);
+
+            /* cut off denormalized stuff */
+            x = _mm256_max_ps(x, _mm256_set1_ps(binary_float(0x00800000)));
+
+            /* part 1: x = frexpf(x, &e); */
+            emm0 = _mm256_srli_epi32(_mm256_castps_si256(x), 23);
+
+            emm0 = _mm256_sub_epi32(emm0, _mm256_set1_epi32(0x7F));
+            __m256 e = _mm256_cvtepi32_ps(emm0);
+
+            e = _mm256_add_ps(e, one);
+
+            /* keep only the fractional part */
+            x = _mm256_and_ps(x, _mm256_set1_ps(binary_float(~0x7f800000)));
+            x = _mm256_or_ps(x, _mm256_set1_ps(0.5f));
+
+            /* part2:
+            if( x < SQRTHF ) {
+            e -= 1;
+            x = x + x - 1.0;
+            } else { x = x - 1.0; }
+            */
+            __m256 mask = _mm256_cmp_ps(
+                x, _mm256_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+            __m256 tmp = _mm256_and_ps(x, mask);
+            x = _mm256_sub_ps(x, one);
+            e = _mm256_sub_ps(e, _mm256_and_ps(one, mask));
+            x = _mm256_add_ps(x, tmp);
+
+            __m256 z = _mm256_mul_ps(x, x);
+
+            __m256 y = _mm256_set1_ps(7.0376836292e-2f);
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-1.1514610310e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.1676998740e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-1.2420140846e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.4249322787e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-1.6668057665e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(2.0000714765e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-2.4999993993e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(3.3333331174e-1f));
+            y = _mm256_mul_ps(y, x);
+
+            y = _mm256_mul_ps(y, z);
+
+            tmp = _mm256_mul_ps(e, _mm256_set1_ps(-2.12194440e-4f));
+            y = _mm256_add_ps(y, tmp);
+
+            tmp = _mm256_mul_ps(z, _mm256_set1_ps(0.5f));
+            y = _mm256_sub_ps(y, tmp);
+
+            tmp = _mm256_mul_ps(e, _mm256_set1_ps(0.693359375f));
+            x = _mm256_add_ps(x, y);
+            x = _mm256_add_ps(x, tmp);
+            x = _mm256_or_ps(x, invalid_mask); // negative arg will be NAN
+            return x;
+        }
+
+        inline float32x8 exp2_s(const float32x8& s) noexcept
+        {
+            // This function's implementation is based on Cephes' exp2f().
+            // See exp2_s(const float32x4&) for details.
+            __m256 x = s;
+            x = _mm256_min_ps(_mm256_set1_ps(129.0f), x);
+            x = _mm256_max_ps(_mm256_set1_ps(-150.0f), x);
+
+            const __m256i n = _mm256_cvtps_epi32(x);
+            x = _mm256_sub_ps(x, _mm256_cvtepi32_ps(n));
+
+            __m256 y = _mm256_set1_ps(1.535336188319500e-4f);
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.339887440266574e-3f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(9.618437357674640e-3f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(5.550332471162809e-2f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(2.402264791363012e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(6.931472028550421e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.0f));
+
+            const __m256i n1 = _mm256_srai_epi32(n, 1);
+            const __m256i n2 = _mm256_sub_epi32(n, n1);
+            const __m256i bias = _mm256_set1_epi32(0x7F);
+            y = _mm256_mul_ps(y, _mm256_castsi256_ps(
+                _mm256_slli_epi32(_mm256_add_epi32(n1, bias), 23)));
+            y = _mm256_mul_ps(y, _mm256_castsi256_ps(
+                _mm256_slli_epi32(_mm256_add_epi32(n2, bias), 23)));
+            return y;
+        }
+
+        inline float32x8 log2_s(const float32x8& s) noexcept
+        {
+            // This function's implementation is based on Cephes' log2f().
+            // See log2_s(const float32x4&) for details.
+            __m256 x = s;
+
+            const __m256 one = _mm256_set1_ps(1.0f);
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 invalid_mask = _mm256_cmp_ps(x, zero, _CMP_NGE_UQ);
+            const __m256 zero_mask = _mm256_cmp_ps(x, zero, _CMP_EQ_OQ);
+            const __m256 inf = _mm256_set1_ps(binary_float(0x7F800000));
+            const __m256 inf_mask = _mm256_cmp_ps(x, inf, _CMP_EQ_OQ);
+
+            /* cut off denormalized stuff */
+            x = _mm256_max_ps(x, _mm256_set1_ps(binary_float(0x00800000)));
+
+            /* x = frexpf(x, &e); */
+            __m256i emm0 = _mm256_srli_epi32(_mm256_castps_si256(x), 23);
+            emm0 = _mm256_sub_epi32(emm0, _mm256_set1_epi32(0x7E));
+            __m256 e = _mm256_cvtepi32_ps(emm0);
+            x = _mm256_and_ps(x, _mm256_set1_ps(binary_float(~0x7f800000)));
+            x = _mm256_or_ps(x, _mm256_set1_ps(0.5f));
+
+            /* if (x < SQRTHF) { e -= 1; x = x + x - 1; } else { x -= 1; } */
+            const __m256 mask = _mm256_cmp_ps(
+                x, _mm256_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+            const __m256 tmp = _mm256_and_ps(x, mask);
+            x = _mm256_sub_ps(x, one);
+            e = _mm256_sub_ps(e, _mm256_and_ps(one, mask));
+            x = _mm256_add_ps(x, tmp);
+
+            const __m256 z = _mm256_mul_ps(x, x);
+
+            __m256 y = _mm256_set1_ps(7.0376836292e-2f);
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-1.1514610310e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.1676998740e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-1.2420140846e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.4249322787e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-1.6668057665e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(2.0000714765e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-2.4999993993e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(3.3333331174e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_mul_ps(y, z);
+            y = _mm256_sub_ps(y, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+
+            /* y * log2(e) + x * log2(e) + y + x + e, with log2(e) - 1 */
+            const __m256 log2ea = _mm256_set1_ps(0.44269504088896340736f);
+            __m256 r = _mm256_mul_ps(y, log2ea);
+            r = _mm256_add_ps(r, _mm256_mul_ps(x, log2ea));
+            r = _mm256_add_ps(r, y);
+            r = _mm256_add_ps(r, x);
+            r = _mm256_add_ps(r, e);
+            r = _mm256_blendv_ps(r, inf, inf_mask);
+            r = _mm256_blendv_ps(r, _mm256_sub_ps(zero, inf), zero_mask);
+            return _mm256_or_ps(r, invalid_mask); // negative arg will be NAN
+        }
+
+        inline float32x8 pow_ss(
+            const float32x8& bases, const float32x8& exponents) noexcept
+        {
+            return exp_s(float32x8(_mm256_mul_ps(log_s(bases), exponents)));
+        }
+#endif
+
+        inline float32x8 abs_s(const float32x8& s) noexcept
+        {
+            return _mm256_and_ps(s, float32x8(binary_float(0x7FFFFFFF)));
+        }
+
+        inline float32x8 recip_fast_s(const float32x8& s) noexcept
+        {
+            return _mm256_rcp_ps(s);
+        }
+
+        // Lanes where a recip/rsqrt estimate is 0 or inf. The refinement
+        // step would compute 0*inf = NAN there, so these keep the estimate.
+        inline __m256 special_estimate_mask(const __m256& r) noexcept
+        {
+            const auto inf = _mm256_set1_ps(binary_float(0x7F800000));
+            return _mm256_or_ps(
+                _mm256_cmp_ps(r, _mm256_setzero_ps(), _CMP_EQ_OQ),
+                _mm256_cmp_ps(abs_s(r), inf, _CMP_EQ_OQ));
+        }
+
+        inline float32x8 recip_s(const float32x8& s) noexcept
+        {
+            // One Newton-Raphson step: r * (2 - s*r)
+            const auto r = _mm256_rcp_ps(s);
+            const auto refined = _mm256_sub_ps(
+                _mm256_add_ps(r, r), _mm256_mul_ps(_mm256_mul_ps(s, r), r));
+            return _mm256_blendv_ps(refined, r, special_estimate_mask(r));
+        }
+
+        inline float32x8 recip_exact_s(const float32x8& s) noexcept
+        {
+            return _mm256_div_ps(_mm256_set1_ps(1.0f), s);
+        }
+
+        inline float32x8 sqrt_s(const float32x8& s) noexcept
+        {
+            return _mm256_sqrt_ps(s);
+        }
+
+        inline float32x8 rsqrt_fast_s(const float32x8& s) noexcept
+        {
+            return _mm256_rsqrt_ps(s);
+        }
+
+        inline float32x8 rsqrt_s(const float32x8& s) noexcept
+        {
+            // One Newton-Raphson step: r/2 * (3 - s*r*r)
+            const auto r = _mm256_rsqrt_ps(s);
+            const auto srr = _mm256_mul_ps(_mm256_mul_ps(s, r), r);
+            const auto refined = _mm256_mul_ps(
+                _mm256_mul_ps(_mm256_set1_ps(0.5f), r),
+                _mm256_sub_ps(_mm256_set1_ps(3.0f), srr));
+            return _mm256_blendv_ps(refined, r, special_estimate_mask(r));
+        }
+
+        inline float32x8 rsqrt_exact_s(const float32x8& s) noexcept
+        {
+            return _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(s));
+        }
+
+        inline float32x8 min_ss(
+            const float32x8& s1, const float32x8& s2) noexcept
+        {
+            return _mm256_min_ps(s1, s2);
+        }
+
+        inline float32x8 max_ss(
+            const float32x8& s1, const float32x8& s2) noexcept
+        {
+            return _mm256_max_ps(s1, s2);
+        }
+
+        inline float32x8 mask_ss(
+            const bool32x8& conditions,
+            const float32x8& values) noexcept
+        {
+            return _mm256_and_ps(conditions, values);
+        }
+
+        inline float32x8 select_sss(
+            const bool32x8& conditions,
+            const float32x8& values,
+            const float32x8& otherwise) noexcept
+        {
+            return _mm256_blendv_ps(otherwise, values, conditions);
+        }
+
+        inline bool32x8 less_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ);
+        }
+
+        inline bool32x8 less_equal_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OQ);
+        }
+
+        inline bool32x8 greater_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_cmp_ps(lhs, rhs, _CMP_GT_OQ);
+        }
+
+        inline bool32x8 greater_equal_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_cmp_ps(lhs, rhs, _CMP_GE_OQ);
+        }
+
+        inline bool32x8 equal_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ);
+        }
+
+        inline bool32x8 not_equal_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_cmp_ps(lhs, rhs, _CMP_NEQ_UQ);
+        }
+
+        inline float hsum_s(const float32x8& s) noexcept
+        {
+            return tue::detail_::hsum_s(float32x4(_mm_add_ps(
+                _mm256_castps256_ps128(s), _mm256_extractf128_ps(s, 1))));
+        }
+
+        inline float hprod_s(const float32x8& s) noexcept
+        {
+            return tue::detail_::hprod_s(float32x4(_mm_mul_ps(
+                _mm256_castps256_ps128(s), _mm256_extractf128_ps(s, 1))));
+        }
+
+        inline float hmin_s(const float32x8& s) noexcept
+        {
+            return tue::detail_::hmin_s(float32x4(_mm_min_ps(
+                _mm256_castps256_ps128(s), _mm256_extractf128_ps(s, 1))));
+        }
+
+        inline float hmax_s(const float32x8& s) noexcept
+        {
+            return tue::detail_::hmax_s(float32x4(_mm_max_ps(
+                _mm256_castps256_ps128(s), _mm256_extractf128_ps(s, 1))));
+        }
+
+#ifdef TUE_AVX2
+        template<int... I>
+        inline float32x8 shuffle_s(const float32x8& s) noexcept
+        {
+            return _mm256_permutevar8x32_ps(s, _mm256_setr_epi32(I...));
+        }
+#endif
+    }
+}
@@ -0,0 +1,447 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<double, 4>())
+    simd<double, 4>
+    {
+        __m256d underlying_;
+
+    private:
+        template<typename U>
+        static float64x4 explicit_cast(const simd<U, 4>& s) noexcept
+        {
+            return {
+                double(s.data()[0]),
+                double(s.data()[1]),
+                double(s.data()[2]),
+                double(s.data()[3]),
+            };
+        }
+
+    public:
+        using component_type = double;
+
+        static constexpr int component_count = 4;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(double x) noexcept
+        :
+            underlying_(_mm256_set1_pd(x))
+        {
+        }
+
+        template<int M = 4, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            double x, double y) noexcept;
+
+        template<int M = 4, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            double x, double y, double z, double w) noexcept
+        :
+            underlying_(_mm256_setr_pd(x, y, z, w))
+        {
+        }
+
+        template<int M = 4, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            double s0, double s1, double s2, double s3,
+            double s4, double s5, double s6, double s7) noexcept;
+
+        template<int M = 4, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            double  s0, double  s1, double  s2, double  s3,
+            double  s4, double  s5, double  s6, double  s7,
+            double  s8, double  s9, double s10, double s11,
+            double s12, double s13, double s14, double s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 4>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256d underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256d() const noexcept
+        {
+            return underlying_;
+        }
+
+        static float64x4 zero() noexcept
+        {
+            return _mm256_setzero_pd();
+        }
+
+        static float64x4 load(const double* data) noexcept
+        {
+            return _mm256_load_pd(data);
+        }
+
+        static float64x4 loadu(const double* data) noexcept
+        {
+            return _mm256_loadu_pd(data);
+        }
+
+        static float64x4 gather(
+            const double* base, const int32x4& indices) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = reinterpret_cast<const __m128i&>(indices);
+            return _mm256_i32gather_pd(base, vindex, 8);
+#else
+            return tue::detail_::gather_s<double, 4>(base, indices);
+#endif
+        }
+
+        static float64x4 gather(
+            const double* base,
+            const int32x4& indices,
+            const bool64x4& conditions) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = reinterpret_cast<const __m128i&>(indices);
+            const auto vmask = reinterpret_cast<const __m256d&>(conditions);
+            return _mm256_mask_i32gather_pd(
+                _mm256_setzero_pd(), base, vindex, vmask, 8);
+#else
+            return tue::detail_::gather_s<double, 4>(
+                base, indices, conditions);
+#endif
+        }
+
+        static float64x4 load_partial(const double* data, int count) noexcept
+        {
+            const auto mask = tue::detail_::partial_mask_s<bool64, 4>(count);
+            const auto vmask = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(mask));
+            return _mm256_maskload_pd(data, vmask);
+        }
+
+        static float64x4 maskload(
+            const double* data, const bool64x4& conditions) noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            return _mm256_maskload_pd(data, vmask);
+        }
+
+        void store(double* data) const noexcept
+        {
+            _mm256_store_pd(data, underlying_);
+        }
+
+        void storeu(double* data) const noexcept
+        {
+            _mm256_storeu_pd(data, underlying_);
+        }
+
+        void store_stream(double* data) const noexcept
+        {
+            _mm256_stream_pd(data, underlying_);
+        }
+
+        void scatter(double* base, const int32x4& indices) const noexcept
+        {
+            tue::detail_::scatter_s<4>(this->data(), base, indices);
+        }
+
+        void scatter(
+            double* base,
+            const int32x4& indices,
+            const bool64x4& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<4>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(double* data, int count) const noexcept
+        {
+            const auto mask = tue::detail_::partial_mask_s<bool64, 4>(count);
+            const auto vmask = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(mask));
+            _mm256_maskstore_pd(data, vmask, underlying_);
+        }
+
+        void maskstore(
+            double* data, const bool64x4& conditions) const noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            _mm256_maskstore_pd(data, vmask, underlying_);
+        }
+
+        const double* data() const noexcept
+        {
+            return reinterpret_cast<const double*>(&underlying_);
+        }
+
+        double* data() noexcept
+        {
+            return reinterpret_cast<double*>(&underlying_);
+        }
+    };
+}
+
+#include "bool64x4.avx.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        inline float64x4 unary_plus_operator_s(const float64x4& s) noexcept
+        {
+            return s;
+        }
+
+        inline float64x4& pre_increment_operator_s(float64x4& s) noexcept
+        {
+            return s = _mm256_add_pd(s, float64x4(1.0));
+        }
+
+        inline float64x4 post_increment_operator_s(float64x4& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_pd(s, float64x4(1.0));
+            return result;
+        }
+
+        inline float64x4 unary_minus_operator_s(const float64x4& s) noexcept
+        {
+            return _mm256_xor_pd(
+                s, float64x4(binary_double(0x8000000000000000ull)));
+        }
+
+        inline float64x4& pre_decrement_operator_s(float64x4& s) noexcept
+        {
+            return s = _mm256_sub_pd(s, float64x4(1.0));
+        }
+
+        inline float64x4 post_decrement_operator_s(float64x4& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_pd(s, float64x4(1.0));
+            return result;
+        }
+
+        inline float64x4 addition_operator_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_add_pd(lhs, rhs);
+        }
+
+        inline float64x4 subtraction_operator_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_sub_pd(lhs, rhs);
+        }
+
+        inline float64x4 multiplication_operator_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_mul_pd(lhs, rhs);
+        }
+
+        inline float64x4 division_operator_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_div_pd(lhs, rhs);
+        }
+
+        inline float64x4& addition_assignment_operator_ss(
+            float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return lhs = _mm256_add_pd(lhs, rhs);
+        }
+
+        inline float64x4& subtraction_assignment_operator_ss(
+            float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return lhs = _mm256_sub_pd(lhs, rhs);
+        }
+
+        inline float64x4& multiplication_assignment_operator_ss(
+            float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return lhs = _mm256_mul_pd(lhs, rhs);
+        }
+
+        inline float64x4& division_assignment_operator_ss(
+            float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return lhs = _mm256_div_pd(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_movemask_pd(
+                _mm256_cmp_pd(lhs, rhs, _CMP_NEQ_UQ)) == 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_movemask_pd(
+                _mm256_cmp_pd(lhs, rhs, _CMP_NEQ_UQ)) != 0;
+        }
+
+        inline float64x4 abs_s(const float64x4& s) noexcept
+        {
+            return _mm256_and_pd(
+                s, float64x4(binary_double(0x7FFFFFFFFFFFFFFFull)));
+        }
+
+        inline float64x4 recip_fast_s(const float64x4& s) noexcept
+        {
+            return _mm256_div_pd(_mm256_set1_pd(1.0), s);
+        }
+
+        inline float64x4 recip_s(const float64x4& s) noexcept
+        {
+            return _mm256_div_pd(_mm256_set1_pd(1.0), s);
+        }
+
+        inline float64x4 recip_exact_s(const float64x4& s) noexcept
+        {
+            return _mm256_div_pd(_mm256_set1_pd(1.0), s);
+        }
+
+        inline float64x4 sqrt_s(const float64x4& s) noexcept
+        {
+            return _mm256_sqrt_pd(s);
+        }
+
+        inline float64x4 rsqrt_fast_s(const float64x4& s) noexcept
+        {
+            return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(s));
+        }
+
+        inline float64x4 rsqrt_s(const float64x4& s) noexcept
+        {
+            return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(s));
+        }
+
+        inline float64x4 rsqrt_exact_s(const float64x4& s) noexcept
+        {
+            return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(s));
+        }
+
+        inline float64x4 min_ss(
+            const float64x4& s1, const float64x4& s2) noexcept
+        {
+            return _mm256_min_pd(s1, s2);
+        }
+
+        inline float64x4 max_ss(
+            const float64x4& s1, const float64x4& s2) noexcept
+        {
+            return _mm256_max_pd(s1, s2);
+        }
+
+        inline float64x4 mask_ss(
+            const bool64x4& conditions,
+            const float64x4& values) noexcept
+        {
+            return _mm256_and_pd(conditions, values);
+        }
+
+        inline float64x4 select_sss(
+            const bool64x4& conditions,
+            const float64x4& values,
+            const float64x4& otherwise) noexcept
+        {
+            return _mm256_blendv_pd(otherwise, values, conditions);
+        }
+
+        inline bool64x4 less_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ);
+        }
+
+        inline bool64x4 less_equal_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ);
+        }
+
+        inline bool64x4 greater_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ);
+        }
+
+        inline bool64x4 greater_equal_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ);
+        }
+
+        inline bool64x4 equal_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ);
+        }
+
+        inline bool64x4 not_equal_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_cmp_pd(lhs, rhs, _CMP_NEQ_UQ);
+        }
+
+        inline double hsum_s(const float64x4& s) noexcept
+        {
+            return tue::detail_::hsum_s(float64x2(_mm_add_pd(
+                _mm256_castpd256_pd128(s), _mm256_extractf128_pd(s, 1))));
+        }
+
+        inline double hprod_s(const float64x4& s) noexcept
+        {
+            return tue::detail_::hprod_s(float64x2(_mm_mul_pd(
+                _mm256_castpd256_pd128(s), _mm256_extractf128_pd(s, 1))));
+        }
+
+        inline double hmin_s(const float64x4& s) noexcept
+        {
+            return tue::detail_::hmin_s(float64x2(_mm_min_pd(
+                _mm256_castpd256_pd128(s), _mm256_extractf128_pd(s, 1))));
+        }
+
+        inline double hmax_s(const float64x4& s) noexcept
+        {
+            return tue::detail_::hmax_s(float64x2(_mm_max_pd(
+                _mm256_castpd256_pd128(s), _mm256_extractf128_pd(s, 1))));
+        }
+
+#ifdef TUE_AVX2
+        template<int I0, int I1, int I2, int I3>
+        inline float64x4 shuffle_s(const float64x4& s) noexcept
+        {
+            return _mm256_permute4x64_pd(s, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+#endif
+    }
+}
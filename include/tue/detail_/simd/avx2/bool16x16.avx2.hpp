@@ -0,0 +1,286 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <type_traits>
+
+#include "../../../simd.hpp"
+#include "../../../sized_bool.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<bool16, 16>())
+    simd<bool16, 16>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static bool16x16 explicit_cast(const simd<U, 16>& s) noexcept
+        {
+            return {
+                bool16(s.data()[0]),
+                bool16(s.data()[1]),
+                bool16(s.data()[2]),
+                bool16(s.data()[3]),
+                bool16(s.data()[4]),
+                bool16(s.data()[5]),
+                bool16(s.data()[6]),
+                bool16(s.data()[7]),
+                bool16(s.data()[8]),
+                bool16(s.data()[9]),
+                bool16(s.data()[10]),
+                bool16(s.data()[11]),
+                bool16(s.data()[12]),
+                bool16(s.data()[13]),
+                bool16(s.data()[14]),
+                bool16(s.data()[15]),
+            };
+        }
+
+        inline static bool16x16 explicit_cast(const int16x16& s) noexcept;
+
+        inline static bool16x16 explicit_cast(const uint16x16& s) noexcept;
+
+    public:
+        using component_type = bool16;
+
+        static constexpr int component_count = 16;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(bool16 x) noexcept
+        :
+            underlying_(_mm256_set1_epi16(x))
+        {
+        }
+
+        template<int M = 16, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            bool16 x, bool16 y) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            bool16 x, bool16 y, bool16 z, bool16 w) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            bool16 s0, bool16 s1, bool16 s2, bool16 s3,
+            bool16 s4, bool16 s5, bool16 s6, bool16 s7) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            bool16  s0, bool16  s1, bool16  s2, bool16  s3,
+            bool16  s4, bool16  s5, bool16  s6, bool16  s7,
+            bool16  s8, bool16  s9, bool16 s10, bool16 s11,
+            bool16 s12, bool16 s13, bool16 s14, bool16 s15) noexcept
+        :
+            underlying_(_mm256_setr_epi16(
+                s0, s1,  s2,  s3,  s4,  s5,  s6,  s7,
+                s8, s9, s10, s11, s12, s13, s14, s15))
+        {
+        }
+
+        template<typename U>
+        explicit simd(const simd<U, 16>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static bool16x16 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static bool16x16 load(const bool16* data) noexcept
+        {
+            return _mm256_load_si256(
+                reinterpret_cast<const __m256i*>(data));
+        }
+
+        static bool16x16 loadu(const bool16* data) noexcept
+        {
+            return _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(data));
+        }
+
+        static bool16x16 load_partial(const bool16* data, int count) noexcept
+        {
+            return tue::detail_::load_partial_s<bool16, 16>(data, count);
+        }
+
+        static bool16x16 maskload(
+            const bool16* data, const bool16x16& conditions) noexcept
+        {
+            return tue::detail_::maskload_s<bool16, 16>(data, conditions);
+        }
+
+        void store(bool16* data) const noexcept
+        {
+            _mm256_store_si256(
+                reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(bool16* data) const noexcept
+        {
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void store_stream(bool16* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void store_partial(bool16* data, int count) const noexcept
+        {
+            tue::detail_::store_partial_s<16>(this->data(), data, count);
+        }
+
+        void maskstore(
+            bool16* data, const bool16x16& conditions) const noexcept
+        {
+            tue::detail_::maskstore_s<16>(this->data(), data, conditions);
+        }
+
+        const bool16* data() const noexcept
+        {
+            return reinterpret_cast<const bool16*>(&underlying_);
+        }
+
+        bool16* data() noexcept
+        {
+            return reinterpret_cast<bool16*>(&underlying_);
+        }
+    };
+}
+
+#include "int16x16.avx2.hpp"
+#include "uint16x16.avx2.hpp"
+
+namespace tue
+{
+    inline bool16x16 bool16x16::explicit_cast(const int16x16& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline bool16x16 bool16x16::explicit_cast(const uint16x16& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    namespace detail_
+    {
+        inline bool16x16 bitwise_not_operator_s(
+            const bool16x16& s) noexcept
+        {
+            return _mm256_xor_si256(s, bool16x16(true16));
+        }
+
+        inline bool16x16 bitwise_and_operator_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline bool16x16 bitwise_or_operator_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline bool16x16 bitwise_xor_operator_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline bool16x16& bitwise_and_assignment_operator_ss(
+            bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline bool16x16& bitwise_or_assignment_operator_ss(
+            bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline bool16x16& bitwise_xor_assignment_operator_ss(
+            bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline bool16x16 mask_ss(
+            const bool16x16& conditions,
+            const bool16x16& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline bool16x16 select_sss(
+            const bool16x16& conditions,
+            const bool16x16& values,
+            const bool16x16& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool16x16 equal_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi16(lhs, rhs);
+        }
+
+        inline bool16x16 not_equal_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi16(lhs, rhs), bool16x16(true16));
+        }
+
+        inline std::uint64_t movemask_s(const bool16x16& s) noexcept
+        {
+            const auto packed = _mm_packs_epi16(
+                _mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1));
+            return static_cast<std::uint64_t>(_mm_movemask_epi8(packed));
+        }
+    }
+}
@@ -0,0 +1,266 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <type_traits>
+
+#include "../../../simd.hpp"
+#include "../../../sized_bool.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<bool8, 32>())
+    simd<bool8, 32>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static bool8x32 explicit_cast(const simd<U, 32>& s) noexcept
+        {
+            bool8x32 result;
+            for (int i = 0; i < 32; ++i)
+            {
+                result.data()[i] = bool8(s.data()[i]);
+            }
+            return result;
+        }
+
+        inline static bool8x32 explicit_cast(const int8x32& s) noexcept;
+
+        inline static bool8x32 explicit_cast(const uint8x32& s) noexcept;
+
+    public:
+        using component_type = bool8;
+
+        static constexpr int component_count = 32;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(bool8 x) noexcept
+        :
+            underlying_(_mm256_set1_epi8(x))
+        {
+        }
+
+        template<int M = 32, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            bool8 x, bool8 y) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            bool8 x, bool8 y, bool8 z, bool8 w) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            bool8 s0, bool8 s1, bool8 s2, bool8 s3,
+            bool8 s4, bool8 s5, bool8 s6, bool8 s7) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            bool8  s0, bool8  s1, bool8  s2, bool8  s3,
+            bool8  s4, bool8  s5, bool8  s6, bool8  s7,
+            bool8  s8, bool8  s9, bool8 s10, bool8 s11,
+            bool8 s12, bool8 s13, bool8 s14, bool8 s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 32>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static bool8x32 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static bool8x32 load(const bool8* data) noexcept
+        {
+            return _mm256_load_si256(
+                reinterpret_cast<const __m256i*>(data));
+        }
+
+        static bool8x32 loadu(const bool8* data) noexcept
+        {
+            return _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(data));
+        }
+
+        static bool8x32 load_partial(const bool8* data, int count) noexcept
+        {
+            return tue::detail_::load_partial_s<bool8, 32>(data, count);
+        }
+
+        static bool8x32 maskload(
+            const bool8* data, const bool8x32& conditions) noexcept
+        {
+            return tue::detail_::maskload_s<bool8, 32>(data, conditions);
+        }
+
+        void store(bool8* data) const noexcept
+        {
+            _mm256_store_si256(
+                reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(bool8* data) const noexcept
+        {
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void store_stream(bool8* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void store_partial(bool8* data, int count) const noexcept
+        {
+            tue::detail_::store_partial_s<32>(this->data(), data, count);
+        }
+
+        void maskstore(
+            bool8* data, const bool8x32& conditions) const noexcept
+        {
+            tue::detail_::maskstore_s<32>(this->data(), data, conditions);
+        }
+
+        const bool8* data() const noexcept
+        {
+            return reinterpret_cast<const bool8*>(&underlying_);
+        }
+
+        bool8* data() noexcept
+        {
+            return reinterpret_cast<bool8*>(&underlying_);
+        }
+    };
+}
+
+#include "int8x32.avx2.hpp"
+#include "uint8x32.avx2.hpp"
+
+namespace tue
+{
+    inline bool8x32 bool8x32::explicit_cast(const int8x32& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline bool8x32 bool8x32::explicit_cast(const uint8x32& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    namespace detail_
+    {
+        inline bool8x32 bitwise_not_operator_s(
+            const bool8x32& s) noexcept
+        {
+            return _mm256_xor_si256(s, bool8x32(true8));
+        }
+
+        inline bool8x32 bitwise_and_operator_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline bool8x32 bitwise_or_operator_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline bool8x32 bitwise_xor_operator_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline bool8x32& bitwise_and_assignment_operator_ss(
+            bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline bool8x32& bitwise_or_assignment_operator_ss(
+            bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline bool8x32& bitwise_xor_assignment_operator_ss(
+            bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline bool8x32 mask_ss(
+            const bool8x32& conditions,
+            const bool8x32& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline bool8x32 select_sss(
+            const bool8x32& conditions,
+            const bool8x32& values,
+            const bool8x32& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool8x32 equal_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi8(lhs, rhs);
+        }
+
+        inline bool8x32 not_equal_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi8(lhs, rhs), bool8x32(true8));
+        }
+
+        inline std::uint64_t movemask_s(const bool8x32& s) noexcept
+        {
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(s));
+        }
+    }
+}
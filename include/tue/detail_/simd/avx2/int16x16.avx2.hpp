@@ -0,0 +1,487 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<std::int16_t, 16>())
+    simd<std::int16_t, 16>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static int16x16 explicit_cast(const simd<U, 16>& s) noexcept
+        {
+            return {
+                std::int16_t(s.data()[0]),
+                std::int16_t(s.data()[1]),
+                std::int16_t(s.data()[2]),
+                std::int16_t(s.data()[3]),
+                std::int16_t(s.data()[4]),
+                std::int16_t(s.data()[5]),
+                std::int16_t(s.data()[6]),
+                std::int16_t(s.data()[7]),
+                std::int16_t(s.data()[8]),
+                std::int16_t(s.data()[9]),
+                std::int16_t(s.data()[10]),
+                std::int16_t(s.data()[11]),
+                std::int16_t(s.data()[12]),
+                std::int16_t(s.data()[13]),
+                std::int16_t(s.data()[14]),
+                std::int16_t(s.data()[15]),
+            };
+        }
+
+        inline static int16x16 explicit_cast(const bool16x16& s) noexcept;
+
+        inline static int16x16 explicit_cast(const uint16x16& s) noexcept;
+
+    public:
+        using component_type = std::int16_t;
+
+        static constexpr int component_count = 16;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(std::int16_t x) noexcept
+        :
+            underlying_(_mm256_set1_epi16(x))
+        {
+        }
+
+        template<int M = 16, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            std::int16_t x, std::int16_t y) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            std::int16_t x, std::int16_t y,
+            std::int16_t z, std::int16_t w) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            std::int16_t s0, std::int16_t s1,
+            std::int16_t s2, std::int16_t s3,
+            std::int16_t s4, std::int16_t s5,
+            std::int16_t s6, std::int16_t s7) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            std::int16_t  s0, std::int16_t  s1,
+            std::int16_t  s2, std::int16_t  s3,
+            std::int16_t  s4, std::int16_t  s5,
+            std::int16_t  s6, std::int16_t  s7,
+            std::int16_t  s8, std::int16_t  s9,
+            std::int16_t s10, std::int16_t s11,
+            std::int16_t s12, std::int16_t s13,
+            std::int16_t s14, std::int16_t s15) noexcept
+        :
+            underlying_(_mm256_setr_epi16(
+                s0, s1,  s2,  s3,  s4,  s5,  s6,  s7,
+                s8, s9, s10, s11, s12, s13, s14, s15))
+        {
+        }
+
+        template<typename U>
+        explicit simd(const simd<U, 16>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static int16x16 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static int16x16 load(const std::int16_t* data) noexcept
+        {
+            return _mm256_load_si256(
+                reinterpret_cast<const __m256i*>(data));
+        }
+
+        static int16x16 loadu(const std::int16_t* data) noexcept
+        {
+            return _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(data));
+        }
+
+        static int16x16 gather(
+            const std::int16_t* base, const int32x16& indices) noexcept
+        {
+            return tue::detail_::gather_s<std::int16_t, 16>(base, indices);
+        }
+
+        static int16x16 gather(
+            const std::int16_t* base,
+            const int32x16& indices,
+            const bool16x16& conditions) noexcept
+        {
+            return tue::detail_::gather_s<std::int16_t, 16>(
+                base, indices, conditions);
+        }
+
+        static int16x16 load_partial(
+            const std::int16_t* data, int count) noexcept
+        {
+            return tue::detail_::load_partial_s<std::int16_t, 16>(data, count);
+        }
+
+        static int16x16 maskload(
+            const std::int16_t* data, const bool16x16& conditions) noexcept
+        {
+            return tue::detail_::maskload_s<std::int16_t, 16>(
+                data, conditions);
+        }
+
+        void store(std::int16_t* data) const noexcept
+        {
+            _mm256_store_si256(
+                reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(std::int16_t* data) const noexcept
+        {
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void store_stream(std::int16_t* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void scatter(
+            std::int16_t* base, const int32x16& indices) const noexcept
+        {
+            tue::detail_::scatter_s<16>(this->data(), base, indices);
+        }
+
+        void scatter(
+            std::int16_t* base,
+            const int32x16& indices,
+            const bool16x16& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<16>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(std::int16_t* data, int count) const noexcept
+        {
+            tue::detail_::store_partial_s<16>(this->data(), data, count);
+        }
+
+        void maskstore(
+            std::int16_t* data, const bool16x16& conditions) const noexcept
+        {
+            tue::detail_::maskstore_s<16>(this->data(), data, conditions);
+        }
+
+        const std::int16_t* data() const noexcept
+        {
+            return reinterpret_cast<const std::int16_t*>(&underlying_);
+        }
+
+        std::int16_t* data() noexcept
+        {
+            return reinterpret_cast<std::int16_t*>(&underlying_);
+        }
+    };
+}
+
+#include "bool16x16.avx2.hpp"
+#include "uint16x16.avx2.hpp"
+
+namespace tue
+{
+    inline int16x16 int16x16::explicit_cast(const bool16x16& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline int16x16 int16x16::explicit_cast(const uint16x16& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    namespace detail_
+    {
+        inline int16x16 unary_plus_operator_s(const int16x16& s) noexcept
+        {
+            return s;
+        }
+
+        inline int16x16& pre_increment_operator_s(int16x16& s) noexcept
+        {
+            return s = _mm256_add_epi16(s, int16x16(1));
+        }
+
+        inline int16x16 post_increment_operator_s(int16x16& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_epi16(s, int16x16(1));
+            return result;
+        }
+
+        inline int16x16 unary_minus_operator_s(const int16x16& s) noexcept
+        {
+            return _mm256_sub_epi16(_mm256_setzero_si256(), s);
+        }
+
+        inline int16x16& pre_decrement_operator_s(int16x16& s) noexcept
+        {
+            return s = _mm256_sub_epi16(s, int16x16(1));
+        }
+
+        inline int16x16 post_decrement_operator_s(int16x16& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_epi16(s, int16x16(1));
+            return result;
+        }
+
+        inline int16x16 bitwise_not_operator_s(const int16x16& s) noexcept
+        {
+            return _mm256_xor_si256(s, int16x16(0xFFFFu));
+        }
+
+        inline int16x16 addition_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_add_epi16(lhs, rhs);
+        }
+
+        inline int16x16 subtraction_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_sub_epi16(lhs, rhs);
+        }
+
+        inline int16x16 multiplication_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_mullo_epi16(lhs, rhs);
+        }
+
+        inline int16x16 bitwise_and_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline int16x16 bitwise_or_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline int16x16 bitwise_xor_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline int16x16 bitwise_shift_left_operator_si(
+            const int16x16& lhs, int rhs) noexcept
+        {
+            return _mm256_slli_epi16(lhs, rhs);
+        }
+
+        inline int16x16 bitwise_shift_right_operator_si(
+            const int16x16& lhs, int rhs) noexcept
+        {
+            return _mm256_srai_epi16(lhs, rhs);
+        }
+
+        inline int16x16& addition_assignment_operator_ss(
+            int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return lhs = addition_operator_ss(lhs, rhs);
+        }
+
+        inline int16x16& subtraction_assignment_operator_ss(
+            int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return lhs = subtraction_operator_ss(lhs, rhs);
+        }
+
+        inline int16x16& multiplication_assignment_operator_ss(
+            int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return lhs = multiplication_operator_ss(lhs, rhs);
+        }
+
+        inline int16x16& bitwise_and_assignment_operator_ss(
+            int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline int16x16& bitwise_or_assignment_operator_ss(
+            int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline int16x16& bitwise_xor_assignment_operator_ss(
+            int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline int16x16& bitwise_shift_left_assignment_operator_si(
+            int16x16& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        inline int16x16& bitwise_shift_right_assignment_operator_si(
+            int16x16& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline int16x16 abs_s(const int16x16& s) noexcept
+        {
+            return _mm256_abs_epi16(s);
+        }
+
+        inline int16x16 min_ss(
+            const int16x16& s1, const int16x16& s2) noexcept
+        {
+            return _mm256_min_epi16(s1, s2);
+        }
+
+        inline int16x16 max_ss(
+            const int16x16& s1, const int16x16& s2) noexcept
+        {
+            return _mm256_max_epi16(s1, s2);
+        }
+
+        inline int16x16 mask_ss(
+            const bool16x16& conditions,
+            const int16x16& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline int16x16 select_sss(
+            const bool16x16& conditions,
+            const int16x16& values,
+            const int16x16& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool16x16 less_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_cmpgt_epi16(rhs, lhs);
+        }
+
+        inline bool16x16 less_equal_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi16(lhs, rhs), int16x16(0xFFFFu));
+        }
+
+        inline bool16x16 greater_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_cmpgt_epi16(lhs, rhs);
+        }
+
+        inline bool16x16 greater_equal_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi16(rhs, lhs), int16x16(0xFFFFu));
+        }
+
+        inline bool16x16 equal_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi16(lhs, rhs);
+        }
+
+        inline bool16x16 not_equal_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi16(lhs, rhs), int16x16(0xFFFFu));
+        }
+
+        inline std::int16_t hsum_s(const int16x16& s) noexcept
+        {
+            const int16x8 lo = _mm256_castsi256_si128(s);
+            const int16x8 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hsum_s(
+                tue::detail_::addition_operator_ss(lo, hi));
+        }
+
+        inline std::int16_t hprod_s(const int16x16& s) noexcept
+        {
+            const int16x8 lo = _mm256_castsi256_si128(s);
+            const int16x8 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hprod_s(
+                tue::detail_::multiplication_operator_ss(lo, hi));
+        }
+
+        inline std::int16_t hmin_s(const int16x16& s) noexcept
+        {
+            const int16x8 lo = _mm256_castsi256_si128(s);
+            const int16x8 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hmin_s(
+                tue::detail_::min_ss(lo, hi));
+        }
+
+        inline std::int16_t hmax_s(const int16x16& s) noexcept
+        {
+            const int16x8 lo = _mm256_castsi256_si128(s);
+            const int16x8 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hmax_s(
+                tue::detail_::max_ss(lo, hi));
+        }
+    }
+}
@@ -0,0 +1,482 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<std::int8_t, 32>())
+    simd<std::int8_t, 32>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static int8x32 explicit_cast(const simd<U, 32>& s) noexcept
+        {
+            int8x32 result;
+            for (int i = 0; i < 32; ++i)
+            {
+                result.data()[i] = std::int8_t(s.data()[i]);
+            }
+            return result;
+        }
+
+        inline static int8x32 explicit_cast(const bool8x32& s) noexcept;
+
+        inline static int8x32 explicit_cast(const uint8x32& s) noexcept;
+
+    public:
+        using component_type = std::int8_t;
+
+        static constexpr int component_count = 32;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(std::int8_t x) noexcept
+        :
+            underlying_(_mm256_set1_epi8(x))
+        {
+        }
+
+        template<int M = 32, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            std::int8_t x, std::int8_t y) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            std::int8_t x, std::int8_t y,
+            std::int8_t z, std::int8_t w) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            std::int8_t s0, std::int8_t s1,
+            std::int8_t s2, std::int8_t s3,
+            std::int8_t s4, std::int8_t s5,
+            std::int8_t s6, std::int8_t s7) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            std::int8_t  s0, std::int8_t  s1,
+            std::int8_t  s2, std::int8_t  s3,
+            std::int8_t  s4, std::int8_t  s5,
+            std::int8_t  s6, std::int8_t  s7,
+            std::int8_t  s8, std::int8_t  s9,
+            std::int8_t s10, std::int8_t s11,
+            std::int8_t s12, std::int8_t s13,
+            std::int8_t s14, std::int8_t s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 32>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static int8x32 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static int8x32 load(const std::int8_t* data) noexcept
+        {
+            return _mm256_load_si256(
+                reinterpret_cast<const __m256i*>(data));
+        }
+
+        static int8x32 loadu(const std::int8_t* data) noexcept
+        {
+            return _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(data));
+        }
+
+        static int8x32 gather(
+            const std::int8_t* base,
+            const simd<std::int32_t, 32>& indices) noexcept
+        {
+            return tue::detail_::gather_s<std::int8_t, 32>(base, indices);
+        }
+
+        static int8x32 gather(
+            const std::int8_t* base,
+            const simd<std::int32_t, 32>& indices,
+            const bool8x32& conditions) noexcept
+        {
+            return tue::detail_::gather_s<std::int8_t, 32>(
+                base, indices, conditions);
+        }
+
+        static int8x32 load_partial(
+            const std::int8_t* data, int count) noexcept
+        {
+            return tue::detail_::load_partial_s<std::int8_t, 32>(data, count);
+        }
+
+        static int8x32 maskload(
+            const std::int8_t* data, const bool8x32& conditions) noexcept
+        {
+            return tue::detail_::maskload_s<std::int8_t, 32>(data, conditions);
+        }
+
+        void store(std::int8_t* data) const noexcept
+        {
+            _mm256_store_si256(
+                reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(std::int8_t* data) const noexcept
+        {
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void store_stream(std::int8_t* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void scatter(
+            std::int8_t* base,
+            const simd<std::int32_t, 32>& indices) const noexcept
+        {
+            tue::detail_::scatter_s<32>(this->data(), base, indices);
+        }
+
+        void scatter(
+            std::int8_t* base,
+            const simd<std::int32_t, 32>& indices,
+            const bool8x32& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<32>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(std::int8_t* data, int count) const noexcept
+        {
+            tue::detail_::store_partial_s<32>(this->data(), data, count);
+        }
+
+        void maskstore(
+            std::int8_t* data, const bool8x32& conditions) const noexcept
+        {
+            tue::detail_::maskstore_s<32>(this->data(), data, conditions);
+        }
+
+        const std::int8_t* data() const noexcept
+        {
+            return reinterpret_cast<const std::int8_t*>(&underlying_);
+        }
+
+        std::int8_t* data() noexcept
+        {
+            return reinterpret_cast<std::int8_t*>(&underlying_);
+        }
+    };
+}
+
+#include "bool8x32.avx2.hpp"
+#include "uint8x32.avx2.hpp"
+
+namespace tue
+{
+    inline int8x32 int8x32::explicit_cast(const bool8x32& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline int8x32 int8x32::explicit_cast(const uint8x32& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    namespace detail_
+    {
+        inline int8x32 unary_plus_operator_s(const int8x32& s) noexcept
+        {
+            return s;
+        }
+
+        inline int8x32& pre_increment_operator_s(int8x32& s) noexcept
+        {
+            return s = _mm256_add_epi8(s, int8x32(1));
+        }
+
+        inline int8x32 post_increment_operator_s(int8x32& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_epi8(s, int8x32(1));
+            return result;
+        }
+
+        inline int8x32 unary_minus_operator_s(const int8x32& s) noexcept
+        {
+            return _mm256_sub_epi8(_mm256_setzero_si256(), s);
+        }
+
+        inline int8x32& pre_decrement_operator_s(int8x32& s) noexcept
+        {
+            return s = _mm256_sub_epi8(s, int8x32(1));
+        }
+
+        inline int8x32 post_decrement_operator_s(int8x32& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_epi8(s, int8x32(1));
+            return result;
+        }
+
+        inline int8x32 bitwise_not_operator_s(const int8x32& s) noexcept
+        {
+            return _mm256_xor_si256(s, int8x32(0xFFu));
+        }
+
+        inline int8x32 addition_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_add_epi8(lhs, rhs);
+        }
+
+        inline int8x32 subtraction_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_sub_epi8(lhs, rhs);
+        }
+
+        inline int8x32 multiplication_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            const auto even = _mm256_mullo_epi16(lhs, rhs);
+            const auto odd = _mm256_mullo_epi16(
+                _mm256_srli_epi16(lhs, 8), _mm256_srli_epi16(rhs, 8));
+            return _mm256_or_si256(
+                _mm256_and_si256(even, _mm256_set1_epi16(0x00FF)),
+                _mm256_slli_epi16(odd, 8));
+        }
+
+        inline int8x32 bitwise_and_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline int8x32 bitwise_or_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline int8x32 bitwise_xor_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline int8x32 bitwise_shift_left_operator_si(
+            const int8x32& lhs, int rhs) noexcept
+        {
+            return _mm256_and_si256(
+                _mm256_slli_epi16(lhs, rhs),
+                _mm256_set1_epi8(std::int8_t(0xFF << rhs)));
+        }
+
+        inline int8x32 bitwise_shift_right_operator_si(
+            const int8x32& lhs, int rhs) noexcept
+        {
+            const auto sign = _mm256_set1_epi8(std::int8_t(0x80 >> rhs));
+            const auto logical = _mm256_and_si256(
+                _mm256_srli_epi16(lhs, rhs),
+                _mm256_set1_epi8(std::int8_t(0xFF >> rhs)));
+            return _mm256_sub_epi8(
+                _mm256_xor_si256(logical, sign), sign);
+        }
+
+        inline int8x32& addition_assignment_operator_ss(
+            int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return lhs = addition_operator_ss(lhs, rhs);
+        }
+
+        inline int8x32& subtraction_assignment_operator_ss(
+            int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return lhs = subtraction_operator_ss(lhs, rhs);
+        }
+
+        inline int8x32& multiplication_assignment_operator_ss(
+            int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return lhs = multiplication_operator_ss(lhs, rhs);
+        }
+
+        inline int8x32& bitwise_and_assignment_operator_ss(
+            int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline int8x32& bitwise_or_assignment_operator_ss(
+            int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline int8x32& bitwise_xor_assignment_operator_ss(
+            int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline int8x32& bitwise_shift_left_assignment_operator_si(
+            int8x32& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        inline int8x32& bitwise_shift_right_assignment_operator_si(
+            int8x32& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline int8x32 abs_s(const int8x32& s) noexcept
+        {
+            return _mm256_abs_epi8(s);
+        }
+
+        inline int8x32 min_ss(
+            const int8x32& s1, const int8x32& s2) noexcept
+        {
+            return _mm256_min_epi8(s1, s2);
+        }
+
+        inline int8x32 max_ss(
+            const int8x32& s1, const int8x32& s2) noexcept
+        {
+            return _mm256_max_epi8(s1, s2);
+        }
+
+        inline int8x32 mask_ss(
+            const bool8x32& conditions,
+            const int8x32& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline int8x32 select_sss(
+            const bool8x32& conditions,
+            const int8x32& values,
+            const int8x32& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool8x32 less_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_cmpgt_epi8(rhs, lhs);
+        }
+
+        inline bool8x32 less_equal_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi8(lhs, rhs), int8x32(0xFFu));
+        }
+
+        inline bool8x32 greater_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_cmpgt_epi8(lhs, rhs);
+        }
+
+        inline bool8x32 greater_equal_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi8(rhs, lhs), int8x32(0xFFu));
+        }
+
+        inline bool8x32 equal_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi8(lhs, rhs);
+        }
+
+        inline bool8x32 not_equal_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi8(lhs, rhs), int8x32(0xFFu));
+        }
+
+        inline std::int8_t hsum_s(const int8x32& s) noexcept
+        {
+            const int8x16 lo = _mm256_castsi256_si128(s);
+            const int8x16 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hsum_s(
+                tue::detail_::addition_operator_ss(lo, hi));
+        }
+
+        inline std::int8_t hprod_s(const int8x32& s) noexcept
+        {
+            const int8x16 lo = _mm256_castsi256_si128(s);
+            const int8x16 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hprod_s(
+                tue::detail_::multiplication_operator_ss(lo, hi));
+        }
+
+        inline std::int8_t hmin_s(const int8x32& s) noexcept
+        {
+            const int8x16 lo = _mm256_castsi256_si128(s);
+            const int8x16 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hmin_s(
+                tue::detail_::min_ss(lo, hi));
+        }
+
+        inline std::int8_t hmax_s(const int8x32& s) noexcept
+        {
+            const int8x16 lo = _mm256_castsi256_si128(s);
+            const int8x16 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hmax_s(
+                tue::detail_::max_ss(lo, hi));
+        }
+    }
+}
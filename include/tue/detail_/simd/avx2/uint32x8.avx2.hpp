@@ -0,0 +1,525 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<std::uint32_t, 8>())
+    simd<std::uint32_t, 8>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static uint32x8 explicit_cast(const simd<U, 8>& s) noexcept
+        {
+            return {
+                std::uint32_t(s.data()[0]),
+                std::uint32_t(s.data()[1]),
+                std::uint32_t(s.data()[2]),
+                std::uint32_t(s.data()[3]),
+                std::uint32_t(s.data()[4]),
+                std::uint32_t(s.data()[5]),
+                std::uint32_t(s.data()[6]),
+                std::uint32_t(s.data()[7]),
+            };
+        }
+
+        inline static uint32x8 explicit_cast(const bool32x8& s) noexcept;
+
+        inline static uint32x8 explicit_cast(const float32x8& s) noexcept;
+
+        inline static uint32x8 explicit_cast(const int32x8& s) noexcept;
+
+    public:
+        using component_type = std::uint32_t;
+
+        static constexpr int component_count = 8;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(std::uint32_t x) noexcept
+        :
+            underlying_(_mm256_set1_epi32(x))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            std::uint32_t x, std::uint32_t y) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            std::uint32_t x, std::uint32_t y,
+            std::uint32_t z, std::uint32_t w) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            std::uint32_t s0, std::uint32_t s1,
+            std::uint32_t s2, std::uint32_t s3,
+            std::uint32_t s4, std::uint32_t s5,
+            std::uint32_t s6, std::uint32_t s7) noexcept
+        :
+            underlying_(_mm256_setr_epi32(
+                s0, s1, s2, s3, s4, s5, s6, s7))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            std::uint32_t  s0, std::uint32_t  s1,
+            std::uint32_t  s2, std::uint32_t  s3,
+            std::uint32_t  s4, std::uint32_t  s5,
+            std::uint32_t  s6, std::uint32_t  s7,
+            std::uint32_t  s8, std::uint32_t  s9,
+            std::uint32_t s10, std::uint32_t s11,
+            std::uint32_t s12, std::uint32_t s13,
+            std::uint32_t s14, std::uint32_t s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 8>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static uint32x8 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static uint32x8 load(const std::uint32_t* data) noexcept
+        {
+            return _mm256_load_si256(
+                reinterpret_cast<const __m256i*>(data));
+        }
+
+        static uint32x8 loadu(const std::uint32_t* data) noexcept
+        {
+            return _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(data));
+        }
+
+        static uint32x8 gather(
+            const std::uint32_t* base, const int32x8& indices) noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m256i&>(indices);
+            return _mm256_i32gather_epi32(
+                reinterpret_cast<const int*>(base), vindex, 4);
+        }
+
+        static uint32x8 gather(
+            const std::uint32_t* base,
+            const int32x8& indices,
+            const bool32x8& conditions) noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m256i&>(indices);
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            return _mm256_mask_i32gather_epi32(
+                _mm256_setzero_si256(),
+                reinterpret_cast<const int*>(base),
+                vindex,
+                vmask,
+                4);
+        }
+
+        static uint32x8 load_partial(
+            const std::uint32_t* data, int count) noexcept
+        {
+            const auto mask = tue::detail_::partial_mask_s<bool32, 8>(count);
+            const auto vmask = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(mask));
+            return _mm256_maskload_epi32(
+                reinterpret_cast<const int*>(data), vmask);
+        }
+
+        static uint32x8 maskload(
+            const std::uint32_t* data, const bool32x8& conditions) noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            return _mm256_maskload_epi32(
+                reinterpret_cast<const int*>(data), vmask);
+        }
+
+        void store(std::uint32_t* data) const noexcept
+        {
+            _mm256_store_si256(
+                reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(std::uint32_t* data) const noexcept
+        {
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void store_stream(std::uint32_t* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void scatter(
+            std::uint32_t* base, const int32x8& indices) const noexcept
+        {
+            tue::detail_::scatter_s<8>(this->data(), base, indices);
+        }
+
+        void scatter(
+            std::uint32_t* base,
+            const int32x8& indices,
+            const bool32x8& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<8>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(std::uint32_t* data, int count) const noexcept
+        {
+            const auto mask = tue::detail_::partial_mask_s<bool32, 8>(count);
+            const auto vmask = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(mask));
+            _mm256_maskstore_epi32(
+                reinterpret_cast<int*>(data), vmask, underlying_);
+        }
+
+        void maskstore(
+            std::uint32_t* data, const bool32x8& conditions) const noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            _mm256_maskstore_epi32(
+                reinterpret_cast<int*>(data), vmask, underlying_);
+        }
+
+        const std::uint32_t* data() const noexcept
+        {
+            return reinterpret_cast<const std::uint32_t*>(&underlying_);
+        }
+
+        std::uint32_t* data() noexcept
+        {
+            return reinterpret_cast<std::uint32_t*>(&underlying_);
+        }
+    };
+}
+
+#include "../avx/bool32x8.avx.hpp"
+#include "../avx/float32x8.avx.hpp"
+#include "int32x8.avx2.hpp"
+
+namespace tue
+{
+    inline uint32x8 uint32x8::explicit_cast(const bool32x8& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline uint32x8 uint32x8::explicit_cast(const float32x8& s) noexcept
+    {
+        return _mm256_cvttps_epi32(s);
+    }
+
+    inline uint32x8 uint32x8::explicit_cast(const int32x8& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    namespace detail_
+    {
+        inline uint32x8 unary_plus_operator_s(const uint32x8& s) noexcept
+        {
+            return s;
+        }
+
+        inline uint32x8& pre_increment_operator_s(uint32x8& s) noexcept
+        {
+            return s = _mm256_add_epi32(s, uint32x8(1));
+        }
+
+        inline uint32x8 post_increment_operator_s(uint32x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_epi32(s, uint32x8(1));
+            return result;
+        }
+
+        inline uint32x8 unary_minus_operator_s(const uint32x8& s) noexcept
+        {
+            return _mm256_sub_epi32(_mm256_setzero_si256(), s);
+        }
+
+        inline uint32x8& pre_decrement_operator_s(uint32x8& s) noexcept
+        {
+            return s = _mm256_sub_epi32(s, uint32x8(1));
+        }
+
+        inline uint32x8 post_decrement_operator_s(uint32x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_epi32(s, uint32x8(1));
+            return result;
+        }
+
+        inline uint32x8 bitwise_not_operator_s(const uint32x8& s) noexcept
+        {
+            return _mm256_xor_si256(s, uint32x8(0xFFFFFFFF));
+        }
+
+        inline uint32x8 addition_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_add_epi32(lhs, rhs);
+        }
+
+        inline uint32x8 subtraction_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_sub_epi32(lhs, rhs);
+        }
+
+        inline uint32x8 multiplication_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_mullo_epi32(lhs, rhs);
+        }
+
+        inline uint32x8 bitwise_and_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline uint32x8 bitwise_or_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline uint32x8 bitwise_xor_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline uint32x8 bitwise_shift_left_operator_si(
+            const uint32x8& lhs, int rhs) noexcept
+        {
+            return _mm256_slli_epi32(lhs, rhs);
+        }
+
+        inline uint32x8 bitwise_shift_right_operator_si(
+            const uint32x8& lhs, int rhs) noexcept
+        {
+            return _mm256_srli_epi32(lhs, rhs);
+        }
+
+        inline uint32x8& addition_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = addition_operator_ss(lhs, rhs);
+        }
+
+        inline uint32x8& subtraction_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = subtraction_operator_ss(lhs, rhs);
+        }
+
+        inline uint32x8& multiplication_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = multiplication_operator_ss(lhs, rhs);
+        }
+
+        inline uint32x8& bitwise_and_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline uint32x8& bitwise_or_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline uint32x8& bitwise_xor_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline uint32x8& bitwise_shift_left_assignment_operator_si(
+            uint32x8& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        inline uint32x8& bitwise_shift_right_assignment_operator_si(
+            uint32x8& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline uint32x8 abs_s(const uint32x8& s) noexcept
+        {
+            return s;
+        }
+
+        inline uint32x8 min_ss(
+            const uint32x8& s1, const uint32x8& s2) noexcept
+        {
+            return _mm256_min_epu32(s1, s2);
+        }
+
+        inline uint32x8 max_ss(
+            const uint32x8& s1, const uint32x8& s2) noexcept
+        {
+            return _mm256_max_epu32(s1, s2);
+        }
+
+        inline uint32x8 mask_ss(
+            const bool32x8& conditions,
+            const uint32x8& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline uint32x8 select_sss(
+            const bool32x8& conditions,
+            const uint32x8& values,
+            const uint32x8& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool32x8 less_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            const auto bias = _mm256_set1_epi32(std::int32_t(0x80000000));
+            return _mm256_cmpgt_epi32(
+                _mm256_xor_si256(rhs, bias),
+                _mm256_xor_si256(lhs, bias));
+        }
+
+        inline bool32x8 less_equal_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            const auto bias = _mm256_set1_epi32(std::int32_t(0x80000000));
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi32(
+                    _mm256_xor_si256(lhs, bias),
+                    _mm256_xor_si256(rhs, bias)),
+                uint32x8(0xFFFFFFFF));
+        }
+
+        inline bool32x8 greater_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            const auto bias = _mm256_set1_epi32(std::int32_t(0x80000000));
+            return _mm256_cmpgt_epi32(
+                _mm256_xor_si256(lhs, bias),
+                _mm256_xor_si256(rhs, bias));
+        }
+
+        inline bool32x8 greater_equal_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            const auto bias = _mm256_set1_epi32(std::int32_t(0x80000000));
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi32(
+                    _mm256_xor_si256(rhs, bias),
+                    _mm256_xor_si256(lhs, bias)),
+                uint32x8(0xFFFFFFFF));
+        }
+
+        inline bool32x8 equal_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi32(lhs, rhs);
+        }
+
+        inline bool32x8 not_equal_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi32(lhs, rhs), uint32x8(0xFFFFFFFF));
+        }
+
+        inline std::uint32_t hsum_s(const uint32x8& s) noexcept
+        {
+            const uint32x4 lo = _mm256_castsi256_si128(s);
+            const uint32x4 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hsum_s(
+                tue::detail_::addition_operator_ss(lo, hi));
+        }
+
+        inline std::uint32_t hprod_s(const uint32x8& s) noexcept
+        {
+            const uint32x4 lo = _mm256_castsi256_si128(s);
+            const uint32x4 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hprod_s(
+                tue::detail_::multiplication_operator_ss(lo, hi));
+        }
+
+        inline std::uint32_t hmin_s(const uint32x8& s) noexcept
+        {
+            const uint32x4 lo = _mm256_castsi256_si128(s);
+            const uint32x4 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hmin_s(
+                tue::detail_::min_ss(lo, hi));
+        }
+
+        inline std::uint32_t hmax_s(const uint32x8& s) noexcept
+        {
+            const uint32x4 lo = _mm256_castsi256_si128(s);
+            const uint32x4 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hmax_s(
+                tue::detail_::max_ss(lo, hi));
+        }
+
+        template<int... I>
+        inline uint32x8 shuffle_s(const uint32x8& s) noexcept
+        {
+            return _mm256_permutevar8x32_epi32(s, _mm256_setr_epi32(I...));
+        }
+    }
+}
@@ -0,0 +1,520 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<std::uint64_t, 4>())
+    simd<std::uint64_t, 4>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static uint64x4 explicit_cast(const simd<U, 4>& s) noexcept
+        {
+            return {
+                std::uint64_t(s.data()[0]),
+                std::uint64_t(s.data()[1]),
+                std::uint64_t(s.data()[2]),
+                std::uint64_t(s.data()[3]),
+            };
+        }
+
+        inline static uint64x4 explicit_cast(const bool64x4& s) noexcept;
+
+        inline static uint64x4 explicit_cast(const int64x4& s) noexcept;
+
+    public:
+        using component_type = std::uint64_t;
+
+        static constexpr int component_count = 4;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(std::uint64_t x) noexcept
+        :
+            underlying_(_mm256_set1_epi64x(x))
+        {
+        }
+
+        template<int M = 4, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            std::uint64_t x, std::uint64_t y) noexcept;
+
+        template<int M = 4, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            std::uint64_t x, std::uint64_t y,
+            std::uint64_t z, std::uint64_t w) noexcept
+        :
+            underlying_(_mm256_setr_epi64x(x, y, z, w))
+        {
+        }
+
+        template<int M = 4, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            std::uint64_t s0, std::uint64_t s1,
+            std::uint64_t s2, std::uint64_t s3,
+            std::uint64_t s4, std::uint64_t s5,
+            std::uint64_t s6, std::uint64_t s7) noexcept;
+
+        template<int M = 4, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            std::uint64_t  s0, std::uint64_t  s1,
+            std::uint64_t  s2, std::uint64_t  s3,
+            std::uint64_t  s4, std::uint64_t  s5,
+            std::uint64_t  s6, std::uint64_t  s7,
+            std::uint64_t  s8, std::uint64_t  s9,
+            std::uint64_t s10, std::uint64_t s11,
+            std::uint64_t s12, std::uint64_t s13,
+            std::uint64_t s14, std::uint64_t s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 4>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static uint64x4 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static uint64x4 load(const std::uint64_t* data) noexcept
+        {
+            return _mm256_load_si256(
+                reinterpret_cast<const __m256i*>(data));
+        }
+
+        static uint64x4 loadu(const std::uint64_t* data) noexcept
+        {
+            return _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(data));
+        }
+
+        static uint64x4 gather(
+            const std::uint64_t* base, const int32x4& indices) noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m128i&>(indices);
+            return _mm256_i32gather_epi64(
+                reinterpret_cast<const long long*>(base), vindex, 8);
+        }
+
+        static uint64x4 gather(
+            const std::uint64_t* base,
+            const int32x4& indices,
+            const bool64x4& conditions) noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m128i&>(indices);
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            return _mm256_mask_i32gather_epi64(
+                _mm256_setzero_si256(),
+                reinterpret_cast<const long long*>(base),
+                vindex,
+                vmask,
+                8);
+        }
+
+        static uint64x4 load_partial(
+            const std::uint64_t* data, int count) noexcept
+        {
+            const auto mask = tue::detail_::partial_mask_s<bool64, 4>(count);
+            const auto vmask = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(mask));
+            return _mm256_maskload_epi64(
+                reinterpret_cast<const long long*>(data), vmask);
+        }
+
+        static uint64x4 maskload(
+            const std::uint64_t* data, const bool64x4& conditions) noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            return _mm256_maskload_epi64(
+                reinterpret_cast<const long long*>(data), vmask);
+        }
+
+        void store(std::uint64_t* data) const noexcept
+        {
+            _mm256_store_si256(
+                reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(std::uint64_t* data) const noexcept
+        {
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void store_stream(std::uint64_t* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void scatter(
+            std::uint64_t* base, const int32x4& indices) const noexcept
+        {
+            tue::detail_::scatter_s<4>(this->data(), base, indices);
+        }
+
+        void scatter(
+            std::uint64_t* base,
+            const int32x4& indices,
+            const bool64x4& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<4>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(std::uint64_t* data, int count) const noexcept
+        {
+            const auto mask = tue::detail_::partial_mask_s<bool64, 4>(count);
+            const auto vmask = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(mask));
+            _mm256_maskstore_epi64(
+                reinterpret_cast<long long*>(data), vmask, underlying_);
+        }
+
+        void maskstore(
+            std::uint64_t* data, const bool64x4& conditions) const noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m256i&>(conditions);
+            _mm256_maskstore_epi64(
+                reinterpret_cast<long long*>(data), vmask, underlying_);
+        }
+
+        const std::uint64_t* data() const noexcept
+        {
+            return reinterpret_cast<const std::uint64_t*>(&underlying_);
+        }
+
+        std::uint64_t* data() noexcept
+        {
+            return reinterpret_cast<std::uint64_t*>(&underlying_);
+        }
+    };
+}
+
+#include "../avx/bool64x4.avx.hpp"
+#include "int64x4.avx2.hpp"
+
+namespace tue
+{
+    inline uint64x4 uint64x4::explicit_cast(const bool64x4& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline uint64x4 uint64x4::explicit_cast(const int64x4& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    namespace detail_
+    {
+        inline uint64x4 unary_plus_operator_s(const uint64x4& s) noexcept
+        {
+            return s;
+        }
+
+        inline uint64x4& pre_increment_operator_s(uint64x4& s) noexcept
+        {
+            return s = _mm256_add_epi64(s, uint64x4(1));
+        }
+
+        inline uint64x4 post_increment_operator_s(uint64x4& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_epi64(s, uint64x4(1));
+            return result;
+        }
+
+        inline uint64x4 unary_minus_operator_s(const uint64x4& s) noexcept
+        {
+            return _mm256_sub_epi64(_mm256_setzero_si256(), s);
+        }
+
+        inline uint64x4& pre_decrement_operator_s(uint64x4& s) noexcept
+        {
+            return s = _mm256_sub_epi64(s, uint64x4(1));
+        }
+
+        inline uint64x4 post_decrement_operator_s(uint64x4& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_epi64(s, uint64x4(1));
+            return result;
+        }
+
+        inline uint64x4 bitwise_not_operator_s(const uint64x4& s) noexcept
+        {
+            return _mm256_xor_si256(s, uint64x4(~0ull));
+        }
+
+        inline uint64x4 addition_operator_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return _mm256_add_epi64(lhs, rhs);
+        }
+
+        inline uint64x4 subtraction_operator_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return _mm256_sub_epi64(lhs, rhs);
+        }
+
+        inline uint64x4 multiplication_operator_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            const auto lo = _mm256_mul_epu32(lhs, rhs);
+            const auto hi = _mm256_add_epi64(
+                _mm256_mul_epu32(_mm256_srli_epi64(lhs, 32), rhs),
+                _mm256_mul_epu32(lhs, _mm256_srli_epi64(rhs, 32)));
+            return _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 32));
+        }
+
+        inline uint64x4 bitwise_and_operator_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline uint64x4 bitwise_or_operator_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline uint64x4 bitwise_xor_operator_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline uint64x4 bitwise_shift_left_operator_si(
+            const uint64x4& lhs, int rhs) noexcept
+        {
+            return _mm256_slli_epi64(lhs, rhs);
+        }
+
+        inline uint64x4 bitwise_shift_right_operator_si(
+            const uint64x4& lhs, int rhs) noexcept
+        {
+            return _mm256_srli_epi64(lhs, rhs);
+        }
+
+        inline uint64x4& addition_assignment_operator_ss(
+            uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return lhs = addition_operator_ss(lhs, rhs);
+        }
+
+        inline uint64x4& subtraction_assignment_operator_ss(
+            uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return lhs = subtraction_operator_ss(lhs, rhs);
+        }
+
+        inline uint64x4& multiplication_assignment_operator_ss(
+            uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return lhs = multiplication_operator_ss(lhs, rhs);
+        }
+
+        inline uint64x4& bitwise_and_assignment_operator_ss(
+            uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline uint64x4& bitwise_or_assignment_operator_ss(
+            uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline uint64x4& bitwise_xor_assignment_operator_ss(
+            uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline uint64x4& bitwise_shift_left_assignment_operator_si(
+            uint64x4& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        inline uint64x4& bitwise_shift_right_assignment_operator_si(
+            uint64x4& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline uint64x4 abs_s(const uint64x4& s) noexcept
+        {
+            return s;
+        }
+
+        inline uint64x4 mask_ss(
+            const bool64x4& conditions,
+            const uint64x4& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline uint64x4 select_sss(
+            const bool64x4& conditions,
+            const uint64x4& values,
+            const uint64x4& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool64x4 less_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            const auto bias = _mm256_set1_epi64x(
+                std::int64_t(0x8000000000000000ull));
+            return _mm256_cmpgt_epi64(
+                _mm256_xor_si256(rhs, bias),
+                _mm256_xor_si256(lhs, bias));
+        }
+
+        inline bool64x4 less_equal_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            const auto bias = _mm256_set1_epi64x(
+                std::int64_t(0x8000000000000000ull));
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi64(
+                    _mm256_xor_si256(lhs, bias),
+                    _mm256_xor_si256(rhs, bias)),
+                uint64x4(~0ull));
+        }
+
+        inline bool64x4 greater_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            const auto bias = _mm256_set1_epi64x(
+                std::int64_t(0x8000000000000000ull));
+            return _mm256_cmpgt_epi64(
+                _mm256_xor_si256(lhs, bias),
+                _mm256_xor_si256(rhs, bias));
+        }
+
+        inline bool64x4 greater_equal_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            const auto bias = _mm256_set1_epi64x(
+                std::int64_t(0x8000000000000000ull));
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi64(
+                    _mm256_xor_si256(rhs, bias),
+                    _mm256_xor_si256(lhs, bias)),
+                uint64x4(~0ull));
+        }
+
+        inline bool64x4 equal_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi64(lhs, rhs);
+        }
+
+        inline bool64x4 not_equal_ss(
+            const uint64x4& lhs, const uint64x4& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi64(lhs, rhs), uint64x4(~0ull));
+        }
+
+        inline uint64x4 min_ss(
+            const uint64x4& s1, const uint64x4& s2) noexcept
+        {
+            return select_sss(greater_ss(s1, s2), s2, s1);
+        }
+
+        inline uint64x4 max_ss(
+            const uint64x4& s1, const uint64x4& s2) noexcept
+        {
+            return select_sss(greater_ss(s1, s2), s1, s2);
+        }
+
+        inline std::uint64_t hsum_s(const uint64x4& s) noexcept
+        {
+            const uint64x2 lo = _mm256_castsi256_si128(s);
+            const uint64x2 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hsum_s(
+                tue::detail_::addition_operator_ss(lo, hi));
+        }
+
+        inline std::uint64_t hprod_s(const uint64x4& s) noexcept
+        {
+            const uint64x2 lo = _mm256_castsi256_si128(s);
+            const uint64x2 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hprod_s(
+                tue::detail_::multiplication_operator_ss(lo, hi));
+        }
+
+        inline std::uint64_t hmin_s(const uint64x4& s) noexcept
+        {
+            const uint64x2 lo = _mm256_castsi256_si128(s);
+            const uint64x2 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hmin_s(
+                tue::detail_::min_ss(lo, hi));
+        }
+
+        inline std::uint64_t hmax_s(const uint64x4& s) noexcept
+        {
+            const uint64x2 lo = _mm256_castsi256_si128(s);
+            const uint64x2 hi = _mm256_extracti128_si256(s, 1);
+            return tue::detail_::hmax_s(
+                tue::detail_::max_ss(lo, hi));
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline uint64x4 shuffle_s(const uint64x4& s) noexcept
+        {
+            return _mm256_permute4x64_epi64(s, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+    }
+}
@@ -0,0 +1,292 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <type_traits>
+
+#include "../../../simd.hpp"
+#include "../../../sized_bool.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<bool32, 16>())
+    simd<bool32, 16>
+    {
+        __m512i underlying_;
+
+    private:
+        template<typename U>
+        static bool32x16 explicit_cast(const simd<U, 16>& s) noexcept
+        {
+            return {
+                bool32(s.data()[0]),
+                bool32(s.data()[1]),
+                bool32(s.data()[2]),
+                bool32(s.data()[3]),
+                bool32(s.data()[4]),
+                bool32(s.data()[5]),
+                bool32(s.data()[6]),
+                bool32(s.data()[7]),
+                bool32(s.data()[8]),
+                bool32(s.data()[9]),
+                bool32(s.data()[10]),
+                bool32(s.data()[11]),
+                bool32(s.data()[12]),
+                bool32(s.data()[13]),
+                bool32(s.data()[14]),
+                bool32(s.data()[15]),
+            };
+        }
+
+    public:
+        using component_type = bool32;
+
+        static constexpr int component_count = 16;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(bool32 x) noexcept
+        :
+            underlying_(_mm512_set1_epi32(x))
+        {
+        }
+
+        template<int M = 16, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            bool32 x, bool32 y) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            bool32 x, bool32 y, bool32 z, bool32 w) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            bool32 s0, bool32 s1, bool32 s2, bool32 s3,
+            bool32 s4, bool32 s5, bool32 s6, bool32 s7) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            bool32  s0, bool32  s1, bool32  s2, bool32  s3,
+            bool32  s4, bool32  s5, bool32  s6, bool32  s7,
+            bool32  s8, bool32  s9, bool32 s10, bool32 s11,
+            bool32 s12, bool32 s13, bool32 s14, bool32 s15) noexcept
+        :
+            underlying_(_mm512_setr_epi32(
+                s0, s1,  s2,  s3,  s4,  s5,  s6,  s7,
+                s8, s9, s10, s11, s12, s13, s14, s15))
+        {
+        }
+
+        template<typename U>
+        explicit simd(const simd<U, 16>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m512i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m512i() const noexcept
+        {
+            return underlying_;
+        }
+
+        simd(__m512 underlying) noexcept
+        :
+            underlying_(_mm512_castps_si512(underlying))
+        {
+        }
+
+        operator __m512() const noexcept
+        {
+            return _mm512_castsi512_ps(underlying_);
+        }
+
+        static bool32x16 from_mask(__mmask16 mask) noexcept
+        {
+            return _mm512_maskz_set1_epi32(mask, -1);
+        }
+
+        __mmask16 to_mask() const noexcept
+        {
+            return _mm512_test_epi32_mask(underlying_, underlying_);
+        }
+
+        static bool32x16 zero() noexcept
+        {
+            return _mm512_setzero_si512();
+        }
+
+        static bool32x16 load(const bool32* data) noexcept
+        {
+            return _mm512_load_si512(data);
+        }
+
+        static bool32x16 loadu(const bool32* data) noexcept
+        {
+            return _mm512_loadu_si512(data);
+        }
+
+        static bool32x16 load_partial(const bool32* data, int count) noexcept
+        {
+            const auto k = static_cast<__mmask16>(
+                (1u << tue::detail_::partial_count_s<16>(count)) - 1);
+            return _mm512_maskz_loadu_epi32(k, data);
+        }
+
+        static bool32x16 maskload(
+            const bool32* data, const bool32x16& conditions) noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi32_mask(vmask, vmask);
+            return _mm512_maskz_loadu_epi32(k, data);
+        }
+
+        void store(bool32* data) const noexcept
+        {
+            _mm512_store_si512(data, underlying_);
+        }
+
+        void storeu(bool32* data) const noexcept
+        {
+            _mm512_storeu_si512(data, underlying_);
+        }
+
+        void store_stream(bool32* data) const noexcept
+        {
+            _mm512_stream_si512(reinterpret_cast<__m512i*>(data), underlying_);
+        }
+
+        void store_partial(bool32* data, int count) const noexcept
+        {
+            const auto k = static_cast<__mmask16>(
+                (1u << tue::detail_::partial_count_s<16>(count)) - 1);
+            _mm512_mask_storeu_epi32(data, k, underlying_);
+        }
+
+        void maskstore(
+            bool32* data, const bool32x16& conditions) const noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi32_mask(vmask, vmask);
+            _mm512_mask_storeu_epi32(data, k, underlying_);
+        }
+
+        const bool32* data() const noexcept
+        {
+            return reinterpret_cast<const bool32*>(&underlying_);
+        }
+
+        bool32* data() noexcept
+        {
+            return reinterpret_cast<bool32*>(&underlying_);
+        }
+    };
+}
+
+namespace tue
+{
+    namespace detail_
+    {
+        inline bool32x16 bitwise_not_operator_s(
+            const bool32x16& s) noexcept
+        {
+            return _mm512_xor_si512(s, bool32x16(true32));
+        }
+
+        inline bool32x16 bitwise_and_operator_ss(
+            const bool32x16& lhs, const bool32x16& rhs) noexcept
+        {
+            return _mm512_and_si512(lhs, rhs);
+        }
+
+        inline bool32x16 bitwise_or_operator_ss(
+            const bool32x16& lhs, const bool32x16& rhs) noexcept
+        {
+            return _mm512_or_si512(lhs, rhs);
+        }
+
+        inline bool32x16 bitwise_xor_operator_ss(
+            const bool32x16& lhs, const bool32x16& rhs) noexcept
+        {
+            return _mm512_xor_si512(lhs, rhs);
+        }
+
+        inline bool32x16& bitwise_and_assignment_operator_ss(
+            bool32x16& lhs, const bool32x16& rhs) noexcept
+        {
+            return lhs = _mm512_and_si512(lhs, rhs);
+        }
+
+        inline bool32x16& bitwise_or_assignment_operator_ss(
+            bool32x16& lhs, const bool32x16& rhs) noexcept
+        {
+            return lhs = _mm512_or_si512(lhs, rhs);
+        }
+
+        inline bool32x16& bitwise_xor_assignment_operator_ss(
+            bool32x16& lhs, const bool32x16& rhs) noexcept
+        {
+            return lhs = _mm512_xor_si512(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const bool32x16& lhs, const bool32x16& rhs) noexcept
+        {
+            return _mm512_cmpneq_epi32_mask(lhs, rhs) == 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const bool32x16& lhs, const bool32x16& rhs) noexcept
+        {
+            return _mm512_cmpneq_epi32_mask(lhs, rhs) != 0;
+        }
+
+        inline bool32x16 mask_ss(
+            const bool32x16& conditions,
+            const bool32x16& values) noexcept
+        {
+            return _mm512_maskz_mov_epi32(conditions.to_mask(), values);
+        }
+
+        inline bool32x16 select_sss(
+            const bool32x16& conditions,
+            const bool32x16& values,
+            const bool32x16& otherwise) noexcept
+        {
+            return _mm512_mask_blend_epi32(
+                conditions.to_mask(), otherwise, values);
+        }
+
+        inline bool32x16 equal_ss(
+            const bool32x16& lhs, const bool32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(_mm512_cmpeq_epi32_mask(lhs, rhs));
+        }
+
+        inline bool32x16 not_equal_ss(
+            const bool32x16& lhs, const bool32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(_mm512_cmpneq_epi32_mask(lhs, rhs));
+        }
+
+        inline std::uint64_t movemask_s(const bool32x16& s) noexcept
+        {
+            return _mm512_test_epi32_mask(s, s);
+        }
+    }
+}
@@ -0,0 +1,282 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <type_traits>
+
+#include "../../../simd.hpp"
+#include "../../../sized_bool.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<bool64, 8>())
+    simd<bool64, 8>
+    {
+        __m512i underlying_;
+
+    private:
+        template<typename U>
+        static bool64x8 explicit_cast(const simd<U, 8>& s) noexcept
+        {
+            return {
+                bool64(s.data()[0]),
+                bool64(s.data()[1]),
+                bool64(s.data()[2]),
+                bool64(s.data()[3]),
+                bool64(s.data()[4]),
+                bool64(s.data()[5]),
+                bool64(s.data()[6]),
+                bool64(s.data()[7]),
+            };
+        }
+
+    public:
+        using component_type = bool64;
+
+        static constexpr int component_count = 8;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(bool64 x) noexcept
+        :
+            underlying_(_mm512_set1_epi64(x))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            bool64 x, bool64 y) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            bool64 x, bool64 y, bool64 z, bool64 w) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            bool64 s0, bool64 s1, bool64 s2, bool64 s3,
+            bool64 s4, bool64 s5, bool64 s6, bool64 s7) noexcept
+        :
+            underlying_(_mm512_setr_epi64(s0, s1, s2, s3, s4, s5, s6, s7))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            bool64  s0, bool64  s1, bool64  s2, bool64  s3,
+            bool64  s4, bool64  s5, bool64  s6, bool64  s7,
+            bool64  s8, bool64  s9, bool64 s10, bool64 s11,
+            bool64 s12, bool64 s13, bool64 s14, bool64 s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 8>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m512i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m512i() const noexcept
+        {
+            return underlying_;
+        }
+
+        simd(__m512d underlying) noexcept
+        :
+            underlying_(_mm512_castpd_si512(underlying))
+        {
+        }
+
+        operator __m512d() const noexcept
+        {
+            return _mm512_castsi512_pd(underlying_);
+        }
+
+        static bool64x8 from_mask(__mmask8 mask) noexcept
+        {
+            return _mm512_maskz_set1_epi64(mask, -1);
+        }
+
+        __mmask8 to_mask() const noexcept
+        {
+            return _mm512_test_epi64_mask(underlying_, underlying_);
+        }
+
+        static bool64x8 zero() noexcept
+        {
+            return _mm512_setzero_si512();
+        }
+
+        static bool64x8 load(const bool64* data) noexcept
+        {
+            return _mm512_load_si512(data);
+        }
+
+        static bool64x8 loadu(const bool64* data) noexcept
+        {
+            return _mm512_loadu_si512(data);
+        }
+
+        static bool64x8 load_partial(const bool64* data, int count) noexcept
+        {
+            const auto k = static_cast<__mmask8>(
+                (1u << tue::detail_::partial_count_s<8>(count)) - 1);
+            return _mm512_maskz_loadu_epi64(k, data);
+        }
+
+        static bool64x8 maskload(
+            const bool64* data, const bool64x8& conditions) noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi64_mask(vmask, vmask);
+            return _mm512_maskz_loadu_epi64(k, data);
+        }
+
+        void store(bool64* data) const noexcept
+        {
+            _mm512_store_si512(data, underlying_);
+        }
+
+        void storeu(bool64* data) const noexcept
+        {
+            _mm512_storeu_si512(data, underlying_);
+        }
+
+        void store_stream(bool64* data) const noexcept
+        {
+            _mm512_stream_si512(reinterpret_cast<__m512i*>(data), underlying_);
+        }
+
+        void store_partial(bool64* data, int count) const noexcept
+        {
+            const auto k = static_cast<__mmask8>(
+                (1u << tue::detail_::partial_count_s<8>(count)) - 1);
+            _mm512_mask_storeu_epi64(data, k, underlying_);
+        }
+
+        void maskstore(
+            bool64* data, const bool64x8& conditions) const noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi64_mask(vmask, vmask);
+            _mm512_mask_storeu_epi64(data, k, underlying_);
+        }
+
+        const bool64* data() const noexcept
+        {
+            return reinterpret_cast<const bool64*>(&underlying_);
+        }
+
+        bool64* data() noexcept
+        {
+            return reinterpret_cast<bool64*>(&underlying_);
+        }
+    };
+}
+
+namespace tue
+{
+    namespace detail_
+    {
+        inline bool64x8 bitwise_not_operator_s(
+            const bool64x8& s) noexcept
+        {
+            return _mm512_xor_si512(s, bool64x8(true64));
+        }
+
+        inline bool64x8 bitwise_and_operator_ss(
+            const bool64x8& lhs, const bool64x8& rhs) noexcept
+        {
+            return _mm512_and_si512(lhs, rhs);
+        }
+
+        inline bool64x8 bitwise_or_operator_ss(
+            const bool64x8& lhs, const bool64x8& rhs) noexcept
+        {
+            return _mm512_or_si512(lhs, rhs);
+        }
+
+        inline bool64x8 bitwise_xor_operator_ss(
+            const bool64x8& lhs, const bool64x8& rhs) noexcept
+        {
+            return _mm512_xor_si512(lhs, rhs);
+        }
+
+        inline bool64x8& bitwise_and_assignment_operator_ss(
+            bool64x8& lhs, const bool64x8& rhs) noexcept
+        {
+            return lhs = _mm512_and_si512(lhs, rhs);
+        }
+
+        inline bool64x8& bitwise_or_assignment_operator_ss(
+            bool64x8& lhs, const bool64x8& rhs) noexcept
+        {
+            return lhs = _mm512_or_si512(lhs, rhs);
+        }
+
+        inline bool64x8& bitwise_xor_assignment_operator_ss(
+            bool64x8& lhs, const bool64x8& rhs) noexcept
+        {
+            return lhs = _mm512_xor_si512(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const bool64x8& lhs, const bool64x8& rhs) noexcept
+        {
+            return _mm512_cmpneq_epi64_mask(lhs, rhs) == 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const bool64x8& lhs, const bool64x8& rhs) noexcept
+        {
+            return _mm512_cmpneq_epi64_mask(lhs, rhs) != 0;
+        }
+
+        inline bool64x8 mask_ss(
+            const bool64x8& conditions,
+            const bool64x8& values) noexcept
+        {
+            return _mm512_maskz_mov_epi64(conditions.to_mask(), values);
+        }
+
+        inline bool64x8 select_sss(
+            const bool64x8& conditions,
+            const bool64x8& values,
+            const bool64x8& otherwise) noexcept
+        {
+            return _mm512_mask_blend_epi64(
+                conditions.to_mask(), otherwise, values);
+        }
+
+        inline bool64x8 equal_ss(
+            const bool64x8& lhs, const bool64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(_mm512_cmpeq_epi64_mask(lhs, rhs));
+        }
+
+        inline bool64x8 not_equal_ss(
+            const bool64x8& lhs, const bool64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(_mm512_cmpneq_epi64_mask(lhs, rhs));
+        }
+
+        inline std::uint64_t movemask_s(const bool64x8& s) noexcept
+        {
+            return _mm512_test_epi64_mask(s, s);
+        }
+    }
+}
@@ -0,0 +1,817 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+// This file contains code based on Julien Pommier's sse_mathfun.h originally
+// published at http://gruntthepeon.free.fr/ssemath/ under the following
+// license:
+//
+// Copyright (C) 2007 Julien Pommier
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from
+// the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software in
+//    a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// (this is the zlib license)
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<float, 16>())
+    simd<float, 16>
+    {
+        __m512 underlying_;
+
+    private:
+        template<typename U>
+        static float32x16 explicit_cast(const simd<U, 16>& s) noexcept
+        {
+            return {
+                float(s.data()[0]),
+                float(s.data()[1]),
+                float(s.data()[2]),
+                float(s.data()[3]),
+                float(s.data()[4]),
+                float(s.data()[5]),
+                float(s.data()[6]),
+                float(s.data()[7]),
+                float(s.data()[8]),
+                float(s.data()[9]),
+                float(s.data()[10]),
+                float(s.data()[11]),
+                float(s.data()[12]),
+                float(s.data()[13]),
+                float(s.data()[14]),
+                float(s.data()[15]),
+            };
+        }
+
+    public:
+        using component_type = float;
+
+        static constexpr int component_count = 16;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(float x) noexcept
+        :
+            underlying_(_mm512_set1_ps(x))
+        {
+        }
+
+        template<int M = 16, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            float x, float y) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            float x, float y, float z, float w) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            float s0, float s1, float s2, float s3,
+            float s4, float s5, float s6, float s7) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            float  s0, float  s1, float  s2, float  s3,
+            float  s4, float  s5, float  s6, float  s7,
+            float  s8, float  s9, float s10, float s11,
+            float s12, float s13, float s14, float s15) noexcept
+        :
+            underlying_(_mm512_setr_ps(
+                s0, s1,  s2,  s3,  s4,  s5,  s6,  s7,
+                s8, s9, s10, s11, s12, s13, s14, s15))
+        {
+        }
+
+        template<typename U>
+        explicit simd(const simd<U, 16>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m512 underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m512() const noexcept
+        {
+            return underlying_;
+        }
+
+        static float32x16 zero() noexcept
+        {
+            return _mm512_setzero_ps();
+        }
+
+        static float32x16 load(const float* data) noexcept
+        {
+            return _mm512_load_ps(data);
+        }
+
+        static float32x16 loadu(const float* data) noexcept
+        {
+            return _mm512_loadu_ps(data);
+        }
+
+        static float32x16 gather(
+            const float* base, const int32x16& indices) noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m512i&>(indices);
+            return _mm512_i32gather_ps(vindex, base, 4);
+        }
+
+        static float32x16 gather(
+            const float* base,
+            const int32x16& indices,
+            const bool32x16& conditions) noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m512i&>(indices);
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi32_mask(vmask, vmask);
+            return _mm512_mask_i32gather_ps(
+                _mm512_setzero_ps(), k, vindex, base, 4);
+        }
+
+        static float32x16 load_partial(const float* data, int count) noexcept
+        {
+            const auto k = static_cast<__mmask16>(
+                (1u << tue::detail_::partial_count_s<16>(count)) - 1);
+            return _mm512_maskz_loadu_ps(k, data);
+        }
+
+        static float32x16 maskload(
+            const float* data, const bool32x16& conditions) noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi32_mask(vmask, vmask);
+            return _mm512_maskz_loadu_ps(k, data);
+        }
+
+        void store(float* data) const noexcept
+        {
+            _mm512_store_ps(data, underlying_);
+        }
+
+        void storeu(float* data) const noexcept
+        {
+            _mm512_storeu_ps(data, underlying_);
+        }
+
+        void store_stream(float* data) const noexcept
+        {
+            _mm512_stream_ps(data, underlying_);
+        }
+
+        void scatter(float* base, const int32x16& indices) const noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m512i&>(indices);
+            _mm512_i32scatter_ps(base, vindex, underlying_, 4);
+        }
+
+        void scatter(
+            float* base,
+            const int32x16& indices,
+            const bool32x16& conditions) const noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m512i&>(indices);
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi32_mask(vmask, vmask);
+            _mm512_mask_i32scatter_ps(base, k, vindex, underlying_, 4);
+        }
+
+        void store_partial(float* data, int count) const noexcept
+        {
+            const auto k = static_cast<__mmask16>(
+                (1u << tue::detail_::partial_count_s<16>(count)) - 1);
+            _mm512_mask_storeu_ps(data, k, underlying_);
+        }
+
+        void maskstore(
+            float* data, const bool32x16& conditions) const noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi32_mask(vmask, vmask);
+            _mm512_mask_storeu_ps(data, k, underlying_);
+        }
+
+        const float* data() const noexcept
+        {
+            return reinterpret_cast<const float*>(&underlying_);
+        }
+
+        float* data() noexcept
+        {
+            return reinterpret_cast<float*>(&underlying_);
+        }
+    };
+}
+
+#include "bool32x16.avx512.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        inline float32x16 unary_plus_operator_s(const float32x16& s) noexcept
+        {
+            return s;
+        }
+
+        inline float32x16& pre_increment_operator_s(float32x16& s) noexcept
+        {
+            return s = _mm512_add_ps(s, float32x16(1.0f));
+        }
+
+        inline float32x16 post_increment_operator_s(float32x16& s) noexcept
+        {
+            const auto result = s;
+            s = _mm512_add_ps(s, float32x16(1.0f));
+            return result;
+        }
+
+        inline float32x16 unary_minus_operator_s(const float32x16& s) noexcept
+        {
+            return _mm512_castsi512_ps(_mm512_xor_si512(
+                _mm512_castps_si512(s), _mm512_set1_epi32(0x80000000)));
+        }
+
+        inline float32x16& pre_decrement_operator_s(float32x16& s) noexcept
+        {
+            return s = _mm512_sub_ps(s, float32x16(1.0f));
+        }
+
+        inline float32x16 post_decrement_operator_s(float32x16& s) noexcept
+        {
+            const auto result = s;
+            s = _mm512_sub_ps(s, float32x16(1.0f));
+            return result;
+        }
+
+        inline float32x16 addition_operator_ss(
+            const float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return _mm512_add_ps(lhs, rhs);
+        }
+
+        inline float32x16 subtraction_operator_ss(
+            const float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return _mm512_sub_ps(lhs, rhs);
+        }
+
+        inline float32x16 multiplication_operator_ss(
+            const float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return _mm512_mul_ps(lhs, rhs);
+        }
+
+        inline float32x16 division_operator_ss(
+            const float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return _mm512_div_ps(lhs, rhs);
+        }
+
+        inline float32x16& addition_assignment_operator_ss(
+            float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return lhs = _mm512_add_ps(lhs, rhs);
+        }
+
+        inline float32x16& subtraction_assignment_operator_ss(
+            float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return lhs = _mm512_sub_ps(lhs, rhs);
+        }
+
+        inline float32x16& multiplication_assignment_operator_ss(
+            float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return lhs = _mm512_mul_ps(lhs, rhs);
+        }
+
+        inline float32x16& division_assignment_operator_ss(
+            float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return lhs = _mm512_div_ps(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return _mm512_cmp_ps_mask(lhs, rhs, _CMP_NEQ_UQ) == 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return _mm512_cmp_ps_mask(lhs, rhs, _CMP_NEQ_UQ) != 0;
+        }
+
+        inline void sincos_s(
+            const float32x16& s,
+            float32x16& sin_out,
+            float32x16& cos_out) noexcept
+        {
+            // This function's implementation is based on Julien Pommier's
+            // sincos_ps(). See the top of this file for details. The
+            // polynom selection uses a mask register instead of and/andnot.
+            __m512 x = s;
+
+            /* extract the sign bit (upper one) */
+            __m512i sign_bit_sin = _mm512_and_si512(
+                _mm512_castps_si512(x), _mm512_set1_epi32(0x80000000));
+
+            /* take the absolute value */
+            x = _mm512_abs_ps(x);
+
+            /* scale by 4/Pi */
+            __m512 y = _mm512_mul_ps(x, _mm512_set1_ps(1.27323954473516f));
+
+            /* store the integer part of y in emm2 */
+            __m512i emm2 = _mm512_cvttps_epi32(y);
+
+            /* j=(j+1) & (~1) (see the cephes sources) */
+            emm2 = _mm512_add_epi32(emm2, _mm512_set1_epi32(1));
+            emm2 = _mm512_and_si512(emm2, _mm512_set1_epi32(~1));
+            y = _mm512_cvtepi32_ps(emm2);
+
+            /* get the swap sign flag for the sine */
+            __m512i swap_sign_bit_sin = _mm512_slli_epi32(
+                _mm512_and_si512(emm2, _mm512_set1_epi32(4)), 29);
+
+            /* get the polynom selection mask */
+            __mmask16 poly_mask = _mm512_test_epi32_mask(
+                emm2, _mm512_set1_epi32(2));
+
+            /* get the sign flag for the cosine */
+            __m512i sign_bit_cos = _mm512_slli_epi32(_mm512_andnot_si512(
+                _mm512_sub_epi32(emm2, _mm512_set1_epi32(2)),
+                _mm512_set1_epi32(4)), 29);
+
+            sign_bit_sin = _mm512_xor_si512(sign_bit_sin, swap_sign_bit_sin);
+
+            /* The magic pass: "Extended precision modular arithmetic"
+               x = ((x - y * DP1) - y * DP2) - y * DP3; */
+            x = _mm512_add_ps(
+                x, _mm512_mul_ps(y, _mm512_set1_ps(-0.78515625f)));
+            x = _mm512_add_ps(
+                x, _mm512_mul_ps(y, _mm512_set1_ps(
+                    -2.4187564849853515625e-4f)));
+            x = _mm512_add_ps(
+                x, _mm512_mul_ps(y, _mm512_set1_ps(
+                    -3.77489497744594108e-8f)));
+
+            /* Evaluate the first polynom  (0 <= x <= Pi/4) */
+            __m512 z = _mm512_mul_ps(x,x);
+            y = _mm512_set1_ps(2.443315711809948e-5f);
+
+            y = _mm512_mul_ps(y, z);
+            y = _mm512_add_ps(y, _mm512_set1_ps(-1.388731625493765e-3f));
+            y = _mm512_mul_ps(y, z);
+            y = _mm512_add_ps(y, _mm512_set1_ps(4.166664568298827e-2f));
+            y = _mm512_mul_ps(y, z);
+            y = _mm512_mul_ps(y, z);
+            __m512 tmp = _mm512_mul_ps(z, _mm512_set1_ps(0.5f));
+            y = _mm512_sub_ps(y, tmp);
+            y = _mm512_add_ps(y, _mm512_set1_ps(1.0f));
+
+            /* Evaluate the second polynom  (Pi/4 <= x <= 0) */
+            __m512 y2 = _mm512_set1_ps(-1.9515295891e-4f);
+            y2 = _mm512_mul_ps(y2, z);
+            y2 = _mm512_add_ps(y2, _mm512_set1_ps(8.3321608736e-3f));
+            y2 = _mm512_mul_ps(y2, z);
+            y2 = _mm512_add_ps(y2, _mm512_set1_ps(-1.6666654611e-1f));
+            y2 = _mm512_mul_ps(y2, z);
+            y2 = _mm512_mul_ps(y2, x);
+            y2 = _mm512_add_ps(y2, x);
+
+            /* select the correct result from the two polynoms */
+            __m512 ysin = _mm512_mask_blend_ps(poly_mask, y2, y);
+            __m512 ycos = _mm512_mask_blend_ps(poly_mask, y, y2);
+
+            /* update the sign */
+            sin_out = _mm512_castsi512_ps(_mm512_xor_si512(
+                _mm512_castps_si512(ysin), sign_bit_sin));
+            cos_out = _mm512_castsi512_ps(_mm512_xor_si512(
+                _mm512_castps_si512(ycos), sign_bit_cos));
+        }
+
+        inline float32x16 sin_s(const float32x16& s) noexcept
+        {
+            float32x16 sin, cos;
+            sincos_s(s, sin, cos);
+            return sin;
+        }
+
+        inline float32x16 cos_s(const float32x16& s) noexcept
+        {
+            float32x16 sin, cos;
+            sincos_s(s, sin, cos);
+            return cos;
+        }
+
+        inline float32x16 exp_s(const float32x16& s) noexcept
+        {
+            // This function's implementation is based on Julien Pommier's
+            // exp_ps(). See the top of this file for details. 2^n is
+            // applied with vscalefps instead of building it bitwise.
+            __m512 x = s;
+
+            x = _mm512_min_ps(x, _mm512_set1_ps(88.3762626647949f));
+            x = _mm512_max_ps(x, _mm512_set1_ps(-88.3762626647949f));
+
+            /* express exp(x) as exp(g + n*log(2)) */
+            __m512 fx = _mm512_mul_ps(x, _mm512_set1_ps(1.44269504088896341f));
+            fx = _mm512_add_ps(fx, _mm512_set1_ps(0.5f));
+            fx = _mm512_roundscale_ps(
+                fx, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+
+            __m512 tmp = _mm512_mul_ps(fx, _mm512_set1_ps(0.693359375f));
+            __m512 z = _mm512_mul_ps(fx, _mm512_set1_ps(-2.12194440e-4f));
+            x = _mm512_sub_ps(x, tmp);
+            x = _mm512_sub_ps(x, z);
+
+            z = _mm512_mul_ps(x, x);
+
+            __m512 y = _mm512_set1_ps(1.9875691500e-4f);
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(1.3981999507e-3f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(8.3334519073e-3f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(4.1665795894e-2f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(1.6666665459e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(5.0000001201e-1f));
+            y = _mm512_mul_ps(y, z);
+            y = _mm512_add_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(1.0f));
+
+            /* multiply by 2^n */
+            return _mm512_scalef_ps(y, fx);
+        }
+
+        inline float32x16 log_s(const float32x16& s) noexcept
+        {
+            // This function's implementation is based on Julien Pommier's
+            // log_ps(). See the top of this file for details. frexpf() is
+            // done with vgetexpps/vgetmantps.
+            __m512 x = s;
+
+            __m512 one = _mm512_set1_ps(1.0f);
+
+            __mmask16 invalid_mask = _mm512_cmp_ps_mask(
+                x, _mm512_setzero_ps(), _CMP_LE_OQ);
+
+            /* cut off denormalized stuff */
+            x = _mm512_max_ps(x, _mm512_set1_ps(binary_float(0x00800000)));
+
+            /* part 1: x = frexpf(x, &e); */
+            __m512 e = _mm512_add_ps(_mm512_getexp_ps(x), one);
+            x = _mm512_getmant_ps(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero);
+
+            /* part2:
+            if( x < SQRTHF ) {
+            e -= 1;
+            x = x + x - 1.0;
+            } else { x = x - 1.0; }
+            */
+            __mmask16 mask = _mm512_cmp_ps_mask(
+                x, _mm512_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+            e = _mm512_mask_sub_ps(e, mask, e, one);
+            x = _mm512_mask_add_ps(x, mask, x, x);
+            x = _mm512_sub_ps(x, one);
+
+            __m512 z = _mm512_mul_ps(x, x);
+
+            __m512 y = _mm512_set1_ps(7.0376836292e-2f);
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(-1.1514610310e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(1.1676998740e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(-1.2420140846e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(1.4249322787e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(-1.6668057665e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(2.0000714765e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(-2.4999993993e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(3.3333331174e-1f));
+            y = _mm512_mul_ps(y, x);
+
+            y = _mm512_mul_ps(y, z);
+
+            __m512 tmp = _mm512_mul_ps(e, _mm512_set1_ps(-2.12194440e-4f));
+            y = _mm512_add_ps(y, tmp);
+
+            tmp = _mm512_mul_ps(z, _mm512_set1_ps(0.5f));
+            y = _mm512_sub_ps(y, tmp);
+
+            tmp = _mm512_mul_ps(e, _mm512_set1_ps(0.693359375f));
+            x = _mm512_add_ps(x, y);
+            x = _mm512_add_ps(x, tmp);
+
+            // negative arg will be NAN
+            return _mm512_mask_mov_ps(
+                x, invalid_mask, _mm512_set1_ps(binary_float(0xFFFFFFFF)));
+        }
+
+        inline float32x16 exp2_s(const float32x16& s) noexcept
+        {
+            // This function's implementation is based on Cephes' exp2f().
+            // See exp2_s(const float32x4&) for details. 2^n is applied
+            // with vscalefps instead of building it bitwise.
+            __m512 x = s;
+            x = _mm512_min_ps(_mm512_set1_ps(129.0f), x);
+            x = _mm512_max_ps(_mm512_set1_ps(-150.0f), x);
+
+            const __m512 n = _mm512_roundscale_ps(
+                x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            x = _mm512_sub_ps(x, n);
+
+            __m512 y = _mm512_set1_ps(1.535336188319500e-4f);
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(1.339887440266574e-3f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(9.618437357674640e-3f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(5.550332471162809e-2f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(2.402264791363012e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(6.931472028550421e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(1.0f));
+
+            /* multiply by 2^n */
+            return _mm512_scalef_ps(y, n);
+        }
+
+        inline float32x16 log2_s(const float32x16& s) noexcept
+        {
+            // This function's implementation is based on Cephes' log2f().
+            // See log2_s(const float32x4&) for details. frexpf() is done
+            // with vgetexpps/vgetmantps.
+            __m512 x = s;
+
+            __m512 one = _mm512_set1_ps(1.0f);
+
+            __mmask16 invalid_mask = _mm512_cmp_ps_mask(
+                x, _mm512_setzero_ps(), _CMP_NGE_UQ);
+            __mmask16 zero_mask = _mm512_cmp_ps_mask(
+                x, _mm512_setzero_ps(), _CMP_EQ_OQ);
+
+            /* cut off denormalized stuff */
+            x = _mm512_max_ps(x, _mm512_set1_ps(binary_float(0x00800000)));
+
+            /* x = frexpf(x, &e); */
+            __m512 e = _mm512_add_ps(_mm512_getexp_ps(x), one);
+            x = _mm512_getmant_ps(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero);
+
+            /* if (x < SQRTHF) { e -= 1; x = x + x - 1; } else { x -= 1; } */
+            __mmask16 mask = _mm512_cmp_ps_mask(
+                x, _mm512_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+            e = _mm512_mask_sub_ps(e, mask, e, one);
+            x = _mm512_mask_add_ps(x, mask, x, x);
+            x = _mm512_sub_ps(x, one);
+
+            __m512 z = _mm512_mul_ps(x, x);
+
+            __m512 y = _mm512_set1_ps(7.0376836292e-2f);
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(-1.1514610310e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(1.1676998740e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(-1.2420140846e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(1.4249322787e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(-1.6668057665e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(2.0000714765e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(-2.4999993993e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(3.3333331174e-1f));
+            y = _mm512_mul_ps(y, x);
+            y = _mm512_mul_ps(y, z);
+            y = _mm512_sub_ps(y, _mm512_mul_ps(z, _mm512_set1_ps(0.5f)));
+
+            /* y * log2(e) + x * log2(e) + y + x + e, with log2(e) - 1 */
+            const __m512 log2ea = _mm512_set1_ps(0.44269504088896340736f);
+            __m512 r = _mm512_mul_ps(y, log2ea);
+            r = _mm512_add_ps(r, _mm512_mul_ps(x, log2ea));
+            r = _mm512_add_ps(r, y);
+            r = _mm512_add_ps(r, x);
+            r = _mm512_add_ps(r, e);
+            r = _mm512_mask_mov_ps(
+                r, zero_mask, _mm512_set1_ps(binary_float(0xFF800000)));
+
+            // negative arg will be NAN
+            return _mm512_mask_mov_ps(
+                r, invalid_mask, _mm512_set1_ps(binary_float(0xFFFFFFFF)));
+        }
+
+        inline float32x16 abs_s(const float32x16& s) noexcept
+        {
+            return _mm512_abs_ps(s);
+        }
+
+        inline float32x16 pow_ss(
+            const float32x16& bases, const float32x16& exponents) noexcept
+        {
+            return exp_s(float32x16(_mm512_mul_ps(log_s(bases), exponents)));
+        }
+
+        inline float32x16 recip_fast_s(const float32x16& s) noexcept
+        {
+            return _mm512_rcp14_ps(s);
+        }
+
+        // Lanes where a recip/rsqrt estimate is 0 or inf. The refinement
+        // step would compute 0*inf = NAN there, so these keep the estimate.
+        inline __mmask16 special_estimate_mask(const __m512& r) noexcept
+        {
+            const auto inf = _mm512_set1_ps(binary_float(0x7F800000));
+            return _mm512_cmp_ps_mask(r, _mm512_setzero_ps(), _CMP_EQ_OQ)
+                | _mm512_cmp_ps_mask(_mm512_abs_ps(r), inf, _CMP_EQ_OQ);
+        }
+
+        inline float32x16 recip_s(const float32x16& s) noexcept
+        {
+            // One Newton-Raphson step: r * (2 - s*r)
+            const auto r = _mm512_rcp14_ps(s);
+            const auto refined = _mm512_sub_ps(
+                _mm512_add_ps(r, r), _mm512_mul_ps(_mm512_mul_ps(s, r), r));
+            return _mm512_mask_blend_ps(special_estimate_mask(r), refined, r);
+        }
+
+        inline float32x16 recip_exact_s(const float32x16& s) noexcept
+        {
+            return _mm512_div_ps(_mm512_set1_ps(1.0f), s);
+        }
+
+        inline float32x16 sqrt_s(const float32x16& s) noexcept
+        {
+            return _mm512_sqrt_ps(s);
+        }
+
+        inline float32x16 rsqrt_fast_s(const float32x16& s) noexcept
+        {
+            return _mm512_rsqrt14_ps(s);
+        }
+
+        inline float32x16 rsqrt_s(const float32x16& s) noexcept
+        {
+            // One Newton-Raphson step: r/2 * (3 - s*r*r)
+            const auto r = _mm512_rsqrt14_ps(s);
+            const auto srr = _mm512_mul_ps(_mm512_mul_ps(s, r), r);
+            const auto refined = _mm512_mul_ps(
+                _mm512_mul_ps(_mm512_set1_ps(0.5f), r),
+                _mm512_sub_ps(_mm512_set1_ps(3.0f), srr));
+            return _mm512_mask_blend_ps(special_estimate_mask(r), refined, r);
+        }
+
+        inline float32x16 rsqrt_exact_s(const float32x16& s) noexcept
+        {
+            return _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_sqrt_ps(s));
+        }
+
+        inline float32x16 min_ss(
+            const float32x16& s1, const float32x16& s2) noexcept
+        {
+            return _mm512_min_ps(s1, s2);
+        }
+
+        inline float32x16 max_ss(
+            const float32x16& s1, const float32x16& s2) noexcept
+        {
+            return _mm512_max_ps(s1, s2);
+        }
+
+        inline float32x16 mask_ss(
+            const bool32x16& conditions,
+            const float32x16& values) noexcept
+        {
+            return _mm512_maskz_mov_ps(conditions.to_mask(), values);
+        }
+
+        inline float32x16 select_sss(
+            const bool32x16& conditions,
+            const float32x16& values,
+            const float32x16& otherwise) noexcept
+        {
+            return _mm512_mask_blend_ps(
+                conditions.to_mask(), otherwise, values);
+        }
+
+        inline bool32x16 less_ss(
+            const float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(
+                _mm512_cmp_ps_mask(lhs, rhs, _CMP_LT_OQ));
+        }
+
+        inline bool32x16 less_equal_ss(
+            const float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(
+                _mm512_cmp_ps_mask(lhs, rhs, _CMP_LE_OQ));
+        }
+
+        inline bool32x16 greater_ss(
+            const float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(
+                _mm512_cmp_ps_mask(lhs, rhs, _CMP_GT_OQ));
+        }
+
+        inline bool32x16 greater_equal_ss(
+            const float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(
+                _mm512_cmp_ps_mask(lhs, rhs, _CMP_GE_OQ));
+        }
+
+        inline bool32x16 equal_ss(
+            const float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(
+                _mm512_cmp_ps_mask(lhs, rhs, _CMP_EQ_OQ));
+        }
+
+        inline bool32x16 not_equal_ss(
+            const float32x16& lhs, const float32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(
+                _mm512_cmp_ps_mask(lhs, rhs, _CMP_NEQ_UQ));
+        }
+
+        inline float hsum_s(const float32x16& s) noexcept
+        {
+            return _mm512_reduce_add_ps(s);
+        }
+
+        inline float hprod_s(const float32x16& s) noexcept
+        {
+            return _mm512_reduce_mul_ps(s);
+        }
+
+        inline float hmin_s(const float32x16& s) noexcept
+        {
+            return _mm512_reduce_min_ps(s);
+        }
+
+        inline float hmax_s(const float32x16& s) noexcept
+        {
+            return _mm512_reduce_max_ps(s);
+        }
+
+        template<int... I>
+        inline float32x16 shuffle_s(const float32x16& s) noexcept
+        {
+            // _mm512_setr_epi32 is a macro in some compilers, so it
+            // can't take a pack expansion.
+            static const std::int32_t indices[] = { I... };
+            return _mm512_permutexvar_ps(_mm512_loadu_si512(indices), s);
+        }
+    }
+}
@@ -0,0 +1,448 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<double, 8>())
+    simd<double, 8>
+    {
+        __m512d underlying_;
+
+    private:
+        template<typename U>
+        static float64x8 explicit_cast(const simd<U, 8>& s) noexcept
+        {
+            return {
+                double(s.data()[0]),
+                double(s.data()[1]),
+                double(s.data()[2]),
+                double(s.data()[3]),
+                double(s.data()[4]),
+                double(s.data()[5]),
+                double(s.data()[6]),
+                double(s.data()[7]),
+            };
+        }
+
+    public:
+        using component_type = double;
+
+        static constexpr int component_count = 8;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(double x) noexcept
+        :
+            underlying_(_mm512_set1_pd(x))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            double x, double y) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            double x, double y, double z, double w) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            double s0, double s1, double s2, double s3,
+            double s4, double s5, double s6, double s7) noexcept
+        :
+            underlying_(_mm512_setr_pd(s0, s1, s2, s3, s4, s5, s6, s7))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            double  s0, double  s1, double  s2, double  s3,
+            double  s4, double  s5, double  s6, double  s7,
+            double  s8, double  s9, double s10, double s11,
+            double s12, double s13, double s14, double s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 8>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m512d underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m512d() const noexcept
+        {
+            return underlying_;
+        }
+
+        static float64x8 zero() noexcept
+        {
+            return _mm512_setzero_pd();
+        }
+
+        static float64x8 load(const double* data) noexcept
+        {
+            return _mm512_load_pd(data);
+        }
+
+        static float64x8 loadu(const double* data) noexcept
+        {
+            return _mm512_loadu_pd(data);
+        }
+
+        static float64x8 gather(
+            const double* base, const int32x8& indices) noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m256i&>(indices);
+            return _mm512_i32gather_pd(vindex, base, 8);
+        }
+
+        static float64x8 gather(
+            const double* base,
+            const int32x8& indices,
+            const bool64x8& conditions) noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m256i&>(indices);
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi64_mask(vmask, vmask);
+            return _mm512_mask_i32gather_pd(
+                _mm512_setzero_pd(), k, vindex, base, 8);
+        }
+
+        static float64x8 load_partial(const double* data, int count) noexcept
+        {
+            const auto k = static_cast<__mmask8>(
+                (1u << tue::detail_::partial_count_s<8>(count)) - 1);
+            return _mm512_maskz_loadu_pd(k, data);
+        }
+
+        static float64x8 maskload(
+            const double* data, const bool64x8& conditions) noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi64_mask(vmask, vmask);
+            return _mm512_maskz_loadu_pd(k, data);
+        }
+
+        void store(double* data) const noexcept
+        {
+            _mm512_store_pd(data, underlying_);
+        }
+
+        void storeu(double* data) const noexcept
+        {
+            _mm512_storeu_pd(data, underlying_);
+        }
+
+        void store_stream(double* data) const noexcept
+        {
+            _mm512_stream_pd(data, underlying_);
+        }
+
+        void scatter(double* base, const int32x8& indices) const noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m256i&>(indices);
+            _mm512_i32scatter_pd(base, vindex, underlying_, 8);
+        }
+
+        void scatter(
+            double* base,
+            const int32x8& indices,
+            const bool64x8& conditions) const noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m256i&>(indices);
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi64_mask(vmask, vmask);
+            _mm512_mask_i32scatter_pd(base, k, vindex, underlying_, 8);
+        }
+
+        void store_partial(double* data, int count) const noexcept
+        {
+            const auto k = static_cast<__mmask8>(
+                (1u << tue::detail_::partial_count_s<8>(count)) - 1);
+            _mm512_mask_storeu_pd(data, k, underlying_);
+        }
+
+        void maskstore(
+            double* data, const bool64x8& conditions) const noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi64_mask(vmask, vmask);
+            _mm512_mask_storeu_pd(data, k, underlying_);
+        }
+
+        const double* data() const noexcept
+        {
+            return reinterpret_cast<const double*>(&underlying_);
+        }
+
+        double* data() noexcept
+        {
+            return reinterpret_cast<double*>(&underlying_);
+        }
+    };
+}
+
+#include "bool64x8.avx512.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        inline float64x8 unary_plus_operator_s(const float64x8& s) noexcept
+        {
+            return s;
+        }
+
+        inline float64x8& pre_increment_operator_s(float64x8& s) noexcept
+        {
+            return s = _mm512_add_pd(s, float64x8(1.0));
+        }
+
+        inline float64x8 post_increment_operator_s(float64x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm512_add_pd(s, float64x8(1.0));
+            return result;
+        }
+
+        inline float64x8 unary_minus_operator_s(const float64x8& s) noexcept
+        {
+            return _mm512_castsi512_pd(_mm512_xor_si512(
+                _mm512_castpd_si512(s),
+                _mm512_set1_epi64(0x8000000000000000ull)));
+        }
+
+        inline float64x8& pre_decrement_operator_s(float64x8& s) noexcept
+        {
+            return s = _mm512_sub_pd(s, float64x8(1.0));
+        }
+
+        inline float64x8 post_decrement_operator_s(float64x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm512_sub_pd(s, float64x8(1.0));
+            return result;
+        }
+
+        inline float64x8 addition_operator_ss(
+            const float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return _mm512_add_pd(lhs, rhs);
+        }
+
+        inline float64x8 subtraction_operator_ss(
+            const float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return _mm512_sub_pd(lhs, rhs);
+        }
+
+        inline float64x8 multiplication_operator_ss(
+            const float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return _mm512_mul_pd(lhs, rhs);
+        }
+
+        inline float64x8 division_operator_ss(
+            const float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return _mm512_div_pd(lhs, rhs);
+        }
+
+        inline float64x8& addition_assignment_operator_ss(
+            float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return lhs = _mm512_add_pd(lhs, rhs);
+        }
+
+        inline float64x8& subtraction_assignment_operator_ss(
+            float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return lhs = _mm512_sub_pd(lhs, rhs);
+        }
+
+        inline float64x8& multiplication_assignment_operator_ss(
+            float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return lhs = _mm512_mul_pd(lhs, rhs);
+        }
+
+        inline float64x8& division_assignment_operator_ss(
+            float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return lhs = _mm512_div_pd(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return _mm512_cmp_pd_mask(lhs, rhs, _CMP_NEQ_UQ) == 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return _mm512_cmp_pd_mask(lhs, rhs, _CMP_NEQ_UQ) != 0;
+        }
+
+        inline float64x8 abs_s(const float64x8& s) noexcept
+        {
+            return _mm512_abs_pd(s);
+        }
+
+        inline float64x8 recip_fast_s(const float64x8& s) noexcept
+        {
+            return _mm512_rcp14_pd(s);
+        }
+
+        inline float64x8 recip_s(const float64x8& s) noexcept
+        {
+            return _mm512_div_pd(_mm512_set1_pd(1.0), s);
+        }
+
+        inline float64x8 recip_exact_s(const float64x8& s) noexcept
+        {
+            return _mm512_div_pd(_mm512_set1_pd(1.0), s);
+        }
+
+        inline float64x8 sqrt_s(const float64x8& s) noexcept
+        {
+            return _mm512_sqrt_pd(s);
+        }
+
+        inline float64x8 rsqrt_fast_s(const float64x8& s) noexcept
+        {
+            return _mm512_rsqrt14_pd(s);
+        }
+
+        inline float64x8 rsqrt_s(const float64x8& s) noexcept
+        {
+            return _mm512_div_pd(_mm512_set1_pd(1.0), _mm512_sqrt_pd(s));
+        }
+
+        inline float64x8 rsqrt_exact_s(const float64x8& s) noexcept
+        {
+            return _mm512_div_pd(_mm512_set1_pd(1.0), _mm512_sqrt_pd(s));
+        }
+
+        inline float64x8 min_ss(
+            const float64x8& s1, const float64x8& s2) noexcept
+        {
+            return _mm512_min_pd(s1, s2);
+        }
+
+        inline float64x8 max_ss(
+            const float64x8& s1, const float64x8& s2) noexcept
+        {
+            return _mm512_max_pd(s1, s2);
+        }
+
+        inline float64x8 mask_ss(
+            const bool64x8& conditions,
+            const float64x8& values) noexcept
+        {
+            return _mm512_maskz_mov_pd(conditions.to_mask(), values);
+        }
+
+        inline float64x8 select_sss(
+            const bool64x8& conditions,
+            const float64x8& values,
+            const float64x8& otherwise) noexcept
+        {
+            return _mm512_mask_blend_pd(
+                conditions.to_mask(), otherwise, values);
+        }
+
+        inline bool64x8 less_ss(
+            const float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(
+                _mm512_cmp_pd_mask(lhs, rhs, _CMP_LT_OQ));
+        }
+
+        inline bool64x8 less_equal_ss(
+            const float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(
+                _mm512_cmp_pd_mask(lhs, rhs, _CMP_LE_OQ));
+        }
+
+        inline bool64x8 greater_ss(
+            const float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(
+                _mm512_cmp_pd_mask(lhs, rhs, _CMP_GT_OQ));
+        }
+
+        inline bool64x8 greater_equal_ss(
+            const float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(
+                _mm512_cmp_pd_mask(lhs, rhs, _CMP_GE_OQ));
+        }
+
+        inline bool64x8 equal_ss(
+            const float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(
+                _mm512_cmp_pd_mask(lhs, rhs, _CMP_EQ_OQ));
+        }
+
+        inline bool64x8 not_equal_ss(
+            const float64x8& lhs, const float64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(
+                _mm512_cmp_pd_mask(lhs, rhs, _CMP_NEQ_UQ));
+        }
+
+        inline double hsum_s(const float64x8& s) noexcept
+        {
+            return _mm512_reduce_add_pd(s);
+        }
+
+        inline double hprod_s(const float64x8& s) noexcept
+        {
+            return _mm512_reduce_mul_pd(s);
+        }
+
+        inline double hmin_s(const float64x8& s) noexcept
+        {
+            return _mm512_reduce_min_pd(s);
+        }
+
+        inline double hmax_s(const float64x8& s) noexcept
+        {
+            return _mm512_reduce_max_pd(s);
+        }
+
+        template<int... I>
+        inline float64x8 shuffle_s(const float64x8& s) noexcept
+        {
+            // _mm512_setr_epi64 is a macro in some compilers, so it
+            // can't take a pack expansion.
+            static const std::int64_t indices[] = { I... };
+            return _mm512_permutexvar_pd(_mm512_loadu_si512(indices), s);
+        }
+    }
+}
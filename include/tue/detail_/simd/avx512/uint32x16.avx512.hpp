@@ -0,0 +1,506 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<std::uint32_t, 16>())
+    simd<std::uint32_t, 16>
+    {
+        __m512i underlying_;
+
+    private:
+        template<typename U>
+        static uint32x16 explicit_cast(const simd<U, 16>& s) noexcept
+        {
+            return {
+                std::uint32_t(s.data()[0]),
+                std::uint32_t(s.data()[1]),
+                std::uint32_t(s.data()[2]),
+                std::uint32_t(s.data()[3]),
+                std::uint32_t(s.data()[4]),
+                std::uint32_t(s.data()[5]),
+                std::uint32_t(s.data()[6]),
+                std::uint32_t(s.data()[7]),
+                std::uint32_t(s.data()[8]),
+                std::uint32_t(s.data()[9]),
+                std::uint32_t(s.data()[10]),
+                std::uint32_t(s.data()[11]),
+                std::uint32_t(s.data()[12]),
+                std::uint32_t(s.data()[13]),
+                std::uint32_t(s.data()[14]),
+                std::uint32_t(s.data()[15]),
+            };
+        }
+
+        inline static uint32x16 explicit_cast(const bool32x16& s) noexcept;
+
+        inline static uint32x16 explicit_cast(const float32x16& s) noexcept;
+
+        inline static uint32x16 explicit_cast(const int32x16& s) noexcept;
+
+    public:
+        using component_type = std::uint32_t;
+
+        static constexpr int component_count = 16;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(std::uint32_t x) noexcept
+        :
+            underlying_(_mm512_set1_epi32(x))
+        {
+        }
+
+        template<int M = 16, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            std::uint32_t x, std::uint32_t y) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            std::uint32_t x, std::uint32_t y,
+            std::uint32_t z, std::uint32_t w) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            std::uint32_t s0, std::uint32_t s1,
+            std::uint32_t s2, std::uint32_t s3,
+            std::uint32_t s4, std::uint32_t s5,
+            std::uint32_t s6, std::uint32_t s7) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            std::uint32_t  s0, std::uint32_t  s1,
+            std::uint32_t  s2, std::uint32_t  s3,
+            std::uint32_t  s4, std::uint32_t  s5,
+            std::uint32_t  s6, std::uint32_t  s7,
+            std::uint32_t  s8, std::uint32_t  s9,
+            std::uint32_t s10, std::uint32_t s11,
+            std::uint32_t s12, std::uint32_t s13,
+            std::uint32_t s14, std::uint32_t s15) noexcept
+        :
+            underlying_(_mm512_setr_epi32(
+                s0, s1,  s2,  s3,  s4,  s5,  s6,  s7,
+                s8, s9, s10, s11, s12, s13, s14, s15))
+        {
+        }
+
+        template<typename U>
+        explicit simd(const simd<U, 16>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m512i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m512i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static uint32x16 zero() noexcept
+        {
+            return _mm512_setzero_si512();
+        }
+
+        static uint32x16 load(const std::uint32_t* data) noexcept
+        {
+            return _mm512_load_si512(data);
+        }
+
+        static uint32x16 loadu(const std::uint32_t* data) noexcept
+        {
+            return _mm512_loadu_si512(data);
+        }
+
+        static uint32x16 gather(
+            const std::uint32_t* base, const int32x16& indices) noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m512i&>(indices);
+            return _mm512_i32gather_epi32(vindex, base, 4);
+        }
+
+        static uint32x16 gather(
+            const std::uint32_t* base,
+            const int32x16& indices,
+            const bool32x16& conditions) noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m512i&>(indices);
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi32_mask(vmask, vmask);
+            return _mm512_mask_i32gather_epi32(
+                _mm512_setzero_si512(), k, vindex, base, 4);
+        }
+
+        static uint32x16 load_partial(
+            const std::uint32_t* data, int count) noexcept
+        {
+            const auto k = static_cast<__mmask16>(
+                (1u << tue::detail_::partial_count_s<16>(count)) - 1);
+            return _mm512_maskz_loadu_epi32(k, data);
+        }
+
+        static uint32x16 maskload(
+            const std::uint32_t* data, const bool32x16& conditions) noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi32_mask(vmask, vmask);
+            return _mm512_maskz_loadu_epi32(k, data);
+        }
+
+        void store(std::uint32_t* data) const noexcept
+        {
+            _mm512_store_si512(data, underlying_);
+        }
+
+        void storeu(std::uint32_t* data) const noexcept
+        {
+            _mm512_storeu_si512(data, underlying_);
+        }
+
+        void store_stream(std::uint32_t* data) const noexcept
+        {
+            _mm512_stream_si512(reinterpret_cast<__m512i*>(data), underlying_);
+        }
+
+        void scatter(
+            std::uint32_t* base, const int32x16& indices) const noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m512i&>(indices);
+            _mm512_i32scatter_epi32(base, vindex, underlying_, 4);
+        }
+
+        void scatter(
+            std::uint32_t* base,
+            const int32x16& indices,
+            const bool32x16& conditions) const noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m512i&>(indices);
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi32_mask(vmask, vmask);
+            _mm512_mask_i32scatter_epi32(base, k, vindex, underlying_, 4);
+        }
+
+        void store_partial(std::uint32_t* data, int count) const noexcept
+        {
+            const auto k = static_cast<__mmask16>(
+                (1u << tue::detail_::partial_count_s<16>(count)) - 1);
+            _mm512_mask_storeu_epi32(data, k, underlying_);
+        }
+
+        void maskstore(
+            std::uint32_t* data, const bool32x16& conditions) const noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi32_mask(vmask, vmask);
+            _mm512_mask_storeu_epi32(data, k, underlying_);
+        }
+
+        const std::uint32_t* data() const noexcept
+        {
+            return reinterpret_cast<const std::uint32_t*>(&underlying_);
+        }
+
+        std::uint32_t* data() noexcept
+        {
+            return reinterpret_cast<std::uint32_t*>(&underlying_);
+        }
+    };
+}
+
+#include "bool32x16.avx512.hpp"
+#include "float32x16.avx512.hpp"
+#include "int32x16.avx512.hpp"
+
+namespace tue
+{
+    inline uint32x16 uint32x16::explicit_cast(const bool32x16& s) noexcept
+    {
+        return __m512i(s);
+    }
+
+    inline uint32x16 uint32x16::explicit_cast(const float32x16& s) noexcept
+    {
+        return _mm512_cvttps_epu32(s);
+    }
+
+    inline uint32x16 uint32x16::explicit_cast(const int32x16& s) noexcept
+    {
+        return __m512i(s);
+    }
+
+    namespace detail_
+    {
+        inline uint32x16 unary_plus_operator_s(const uint32x16& s) noexcept
+        {
+            return s;
+        }
+
+        inline uint32x16& pre_increment_operator_s(uint32x16& s) noexcept
+        {
+            return s = _mm512_add_epi32(s, uint32x16(1));
+        }
+
+        inline uint32x16 post_increment_operator_s(uint32x16& s) noexcept
+        {
+            const auto result = s;
+            s = _mm512_add_epi32(s, uint32x16(1));
+            return result;
+        }
+
+        inline uint32x16 unary_minus_operator_s(const uint32x16& s) noexcept
+        {
+            return _mm512_sub_epi32(_mm512_setzero_si512(), s);
+        }
+
+        inline uint32x16& pre_decrement_operator_s(uint32x16& s) noexcept
+        {
+            return s = _mm512_sub_epi32(s, uint32x16(1));
+        }
+
+        inline uint32x16 post_decrement_operator_s(uint32x16& s) noexcept
+        {
+            const auto result = s;
+            s = _mm512_sub_epi32(s, uint32x16(1));
+            return result;
+        }
+
+        inline uint32x16 bitwise_not_operator_s(const uint32x16& s) noexcept
+        {
+            return _mm512_xor_si512(s, uint32x16(0xFFFFFFFF));
+        }
+
+        inline uint32x16 addition_operator_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return _mm512_add_epi32(lhs, rhs);
+        }
+
+        inline uint32x16 subtraction_operator_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return _mm512_sub_epi32(lhs, rhs);
+        }
+
+        inline uint32x16 multiplication_operator_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return _mm512_mullo_epi32(lhs, rhs);
+        }
+
+        inline uint32x16 bitwise_and_operator_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return _mm512_and_si512(lhs, rhs);
+        }
+
+        inline uint32x16 bitwise_or_operator_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return _mm512_or_si512(lhs, rhs);
+        }
+
+        inline uint32x16 bitwise_xor_operator_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return _mm512_xor_si512(lhs, rhs);
+        }
+
+        inline uint32x16 bitwise_shift_left_operator_si(
+            const uint32x16& lhs, int rhs) noexcept
+        {
+            return _mm512_slli_epi32(lhs, rhs);
+        }
+
+        inline uint32x16 bitwise_shift_right_operator_si(
+            const uint32x16& lhs, int rhs) noexcept
+        {
+            return _mm512_srli_epi32(lhs, rhs);
+        }
+
+        inline uint32x16& addition_assignment_operator_ss(
+            uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return lhs = addition_operator_ss(lhs, rhs);
+        }
+
+        inline uint32x16& subtraction_assignment_operator_ss(
+            uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return lhs = subtraction_operator_ss(lhs, rhs);
+        }
+
+        inline uint32x16& multiplication_assignment_operator_ss(
+            uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return lhs = multiplication_operator_ss(lhs, rhs);
+        }
+
+        inline uint32x16& bitwise_and_assignment_operator_ss(
+            uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return lhs = _mm512_and_si512(lhs, rhs);
+        }
+
+        inline uint32x16& bitwise_or_assignment_operator_ss(
+            uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return lhs = _mm512_or_si512(lhs, rhs);
+        }
+
+        inline uint32x16& bitwise_xor_assignment_operator_ss(
+            uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return lhs = _mm512_xor_si512(lhs, rhs);
+        }
+
+        inline uint32x16& bitwise_shift_left_assignment_operator_si(
+            uint32x16& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        inline uint32x16& bitwise_shift_right_assignment_operator_si(
+            uint32x16& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return _mm512_cmpneq_epi32_mask(lhs, rhs) == 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return _mm512_cmpneq_epi32_mask(lhs, rhs) != 0;
+        }
+
+        inline uint32x16 abs_s(const uint32x16& s) noexcept
+        {
+            return s;
+        }
+
+        inline uint32x16 min_ss(
+            const uint32x16& s1, const uint32x16& s2) noexcept
+        {
+            return _mm512_min_epu32(s1, s2);
+        }
+
+        inline uint32x16 max_ss(
+            const uint32x16& s1, const uint32x16& s2) noexcept
+        {
+            return _mm512_max_epu32(s1, s2);
+        }
+
+        inline uint32x16 mask_ss(
+            const bool32x16& conditions,
+            const uint32x16& values) noexcept
+        {
+            return _mm512_maskz_mov_epi32(conditions.to_mask(), values);
+        }
+
+        inline uint32x16 select_sss(
+            const bool32x16& conditions,
+            const uint32x16& values,
+            const uint32x16& otherwise) noexcept
+        {
+            return _mm512_mask_blend_epi32(
+                conditions.to_mask(), otherwise, values);
+        }
+
+        inline bool32x16 less_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(
+                _mm512_cmplt_epu32_mask(lhs, rhs));
+        }
+
+        inline bool32x16 less_equal_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(
+                _mm512_cmple_epu32_mask(lhs, rhs));
+        }
+
+        inline bool32x16 greater_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(
+                _mm512_cmpgt_epu32_mask(lhs, rhs));
+        }
+
+        inline bool32x16 greater_equal_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(
+                _mm512_cmpge_epu32_mask(lhs, rhs));
+        }
+
+        inline bool32x16 equal_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(
+                _mm512_cmpeq_epi32_mask(lhs, rhs));
+        }
+
+        inline bool32x16 not_equal_ss(
+            const uint32x16& lhs, const uint32x16& rhs) noexcept
+        {
+            return bool32x16::from_mask(
+                _mm512_cmpneq_epi32_mask(lhs, rhs));
+        }
+
+        inline std::uint32_t hsum_s(const uint32x16& s) noexcept
+        {
+            return static_cast<std::uint32_t>(_mm512_reduce_add_epi32(s));
+        }
+
+        inline std::uint32_t hprod_s(const uint32x16& s) noexcept
+        {
+            return static_cast<std::uint32_t>(_mm512_reduce_mul_epi32(s));
+        }
+
+        inline std::uint32_t hmin_s(const uint32x16& s) noexcept
+        {
+            return _mm512_reduce_min_epu32(s);
+        }
+
+        inline std::uint32_t hmax_s(const uint32x16& s) noexcept
+        {
+            return _mm512_reduce_max_epu32(s);
+        }
+
+        template<int... I>
+        inline uint32x16 shuffle_s(const uint32x16& s) noexcept
+        {
+            // _mm512_setr_epi32 is a macro in some compilers, so it
+            // can't take a pack expansion.
+            static const std::int32_t indices[] = { I... };
+            return _mm512_permutexvar_epi32(_mm512_loadu_si512(indices), s);
+        }
+    }
+}
@@ -0,0 +1,493 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<std::uint64_t, 8>())
+    simd<std::uint64_t, 8>
+    {
+        __m512i underlying_;
+
+    private:
+        template<typename U>
+        static uint64x8 explicit_cast(const simd<U, 8>& s) noexcept
+        {
+            return {
+                std::uint64_t(s.data()[0]),
+                std::uint64_t(s.data()[1]),
+                std::uint64_t(s.data()[2]),
+                std::uint64_t(s.data()[3]),
+                std::uint64_t(s.data()[4]),
+                std::uint64_t(s.data()[5]),
+                std::uint64_t(s.data()[6]),
+                std::uint64_t(s.data()[7]),
+            };
+        }
+
+        inline static uint64x8 explicit_cast(const bool64x8& s) noexcept;
+
+        inline static uint64x8 explicit_cast(const int64x8& s) noexcept;
+
+    public:
+        using component_type = std::uint64_t;
+
+        static constexpr int component_count = 8;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(std::uint64_t x) noexcept
+        :
+            underlying_(_mm512_set1_epi64(x))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            std::uint64_t x, std::uint64_t y) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            std::uint64_t x, std::uint64_t y,
+            std::uint64_t z, std::uint64_t w) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            std::uint64_t s0, std::uint64_t s1,
+            std::uint64_t s2, std::uint64_t s3,
+            std::uint64_t s4, std::uint64_t s5,
+            std::uint64_t s6, std::uint64_t s7) noexcept
+        :
+            underlying_(_mm512_setr_epi64(
+                s0, s1, s2, s3, s4, s5, s6, s7))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            std::uint64_t  s0, std::uint64_t  s1,
+            std::uint64_t  s2, std::uint64_t  s3,
+            std::uint64_t  s4, std::uint64_t  s5,
+            std::uint64_t  s6, std::uint64_t  s7,
+            std::uint64_t  s8, std::uint64_t  s9,
+            std::uint64_t s10, std::uint64_t s11,
+            std::uint64_t s12, std::uint64_t s13,
+            std::uint64_t s14, std::uint64_t s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 8>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m512i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m512i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static uint64x8 zero() noexcept
+        {
+            return _mm512_setzero_si512();
+        }
+
+        static uint64x8 load(const std::uint64_t* data) noexcept
+        {
+            return _mm512_load_si512(data);
+        }
+
+        static uint64x8 loadu(const std::uint64_t* data) noexcept
+        {
+            return _mm512_loadu_si512(data);
+        }
+
+        static uint64x8 gather(
+            const std::uint64_t* base, const int32x8& indices) noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m256i&>(indices);
+            return _mm512_i32gather_epi64(vindex, base, 8);
+        }
+
+        static uint64x8 gather(
+            const std::uint64_t* base,
+            const int32x8& indices,
+            const bool64x8& conditions) noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m256i&>(indices);
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi64_mask(vmask, vmask);
+            return _mm512_mask_i32gather_epi64(
+                _mm512_setzero_si512(), k, vindex, base, 8);
+        }
+
+        static uint64x8 load_partial(
+            const std::uint64_t* data, int count) noexcept
+        {
+            const auto k = static_cast<__mmask8>(
+                (1u << tue::detail_::partial_count_s<8>(count)) - 1);
+            return _mm512_maskz_loadu_epi64(k, data);
+        }
+
+        static uint64x8 maskload(
+            const std::uint64_t* data, const bool64x8& conditions) noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi64_mask(vmask, vmask);
+            return _mm512_maskz_loadu_epi64(k, data);
+        }
+
+        void store(std::uint64_t* data) const noexcept
+        {
+            _mm512_store_si512(data, underlying_);
+        }
+
+        void storeu(std::uint64_t* data) const noexcept
+        {
+            _mm512_storeu_si512(data, underlying_);
+        }
+
+        void store_stream(std::uint64_t* data) const noexcept
+        {
+            _mm512_stream_si512(reinterpret_cast<__m512i*>(data), underlying_);
+        }
+
+        void scatter(
+            std::uint64_t* base, const int32x8& indices) const noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m256i&>(indices);
+            _mm512_i32scatter_epi64(base, vindex, underlying_, 8);
+        }
+
+        void scatter(
+            std::uint64_t* base,
+            const int32x8& indices,
+            const bool64x8& conditions) const noexcept
+        {
+            const auto vindex = reinterpret_cast<const __m256i&>(indices);
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi64_mask(vmask, vmask);
+            _mm512_mask_i32scatter_epi64(base, k, vindex, underlying_, 8);
+        }
+
+        void store_partial(std::uint64_t* data, int count) const noexcept
+        {
+            const auto k = static_cast<__mmask8>(
+                (1u << tue::detail_::partial_count_s<8>(count)) - 1);
+            _mm512_mask_storeu_epi64(data, k, underlying_);
+        }
+
+        void maskstore(
+            std::uint64_t* data, const bool64x8& conditions) const noexcept
+        {
+            const auto vmask = reinterpret_cast<const __m512i&>(conditions);
+            const auto k = _mm512_test_epi64_mask(vmask, vmask);
+            _mm512_mask_storeu_epi64(data, k, underlying_);
+        }
+
+        const std::uint64_t* data() const noexcept
+        {
+            return reinterpret_cast<const std::uint64_t*>(&underlying_);
+        }
+
+        std::uint64_t* data() noexcept
+        {
+            return reinterpret_cast<std::uint64_t*>(&underlying_);
+        }
+    };
+}
+
+#include "bool64x8.avx512.hpp"
+#include "int64x8.avx512.hpp"
+
+namespace tue
+{
+    inline uint64x8 uint64x8::explicit_cast(const bool64x8& s) noexcept
+    {
+        return __m512i(s);
+    }
+
+    inline uint64x8 uint64x8::explicit_cast(const int64x8& s) noexcept
+    {
+        return __m512i(s);
+    }
+
+    namespace detail_
+    {
+        inline uint64x8 unary_plus_operator_s(const uint64x8& s) noexcept
+        {
+            return s;
+        }
+
+        inline uint64x8& pre_increment_operator_s(uint64x8& s) noexcept
+        {
+            return s = _mm512_add_epi64(s, uint64x8(1));
+        }
+
+        inline uint64x8 post_increment_operator_s(uint64x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm512_add_epi64(s, uint64x8(1));
+            return result;
+        }
+
+        inline uint64x8 unary_minus_operator_s(const uint64x8& s) noexcept
+        {
+            return _mm512_sub_epi64(_mm512_setzero_si512(), s);
+        }
+
+        inline uint64x8& pre_decrement_operator_s(uint64x8& s) noexcept
+        {
+            return s = _mm512_sub_epi64(s, uint64x8(1));
+        }
+
+        inline uint64x8 post_decrement_operator_s(uint64x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm512_sub_epi64(s, uint64x8(1));
+            return result;
+        }
+
+        inline uint64x8 bitwise_not_operator_s(const uint64x8& s) noexcept
+        {
+            return _mm512_xor_si512(s, uint64x8(~0ull));
+        }
+
+        inline uint64x8 addition_operator_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return _mm512_add_epi64(lhs, rhs);
+        }
+
+        inline uint64x8 subtraction_operator_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return _mm512_sub_epi64(lhs, rhs);
+        }
+
+        inline uint64x8 multiplication_operator_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            const auto lo = _mm512_mul_epu32(lhs, rhs);
+            const auto hi = _mm512_add_epi64(
+                _mm512_mul_epu32(_mm512_srli_epi64(lhs, 32), rhs),
+                _mm512_mul_epu32(lhs, _mm512_srli_epi64(rhs, 32)));
+            return _mm512_add_epi64(lo, _mm512_slli_epi64(hi, 32));
+        }
+
+        inline uint64x8 bitwise_and_operator_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return _mm512_and_si512(lhs, rhs);
+        }
+
+        inline uint64x8 bitwise_or_operator_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return _mm512_or_si512(lhs, rhs);
+        }
+
+        inline uint64x8 bitwise_xor_operator_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return _mm512_xor_si512(lhs, rhs);
+        }
+
+        inline uint64x8 bitwise_shift_left_operator_si(
+            const uint64x8& lhs, int rhs) noexcept
+        {
+            return _mm512_slli_epi64(lhs, rhs);
+        }
+
+        inline uint64x8 bitwise_shift_right_operator_si(
+            const uint64x8& lhs, int rhs) noexcept
+        {
+            return _mm512_srli_epi64(lhs, rhs);
+        }
+
+        inline uint64x8& addition_assignment_operator_ss(
+            uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return lhs = addition_operator_ss(lhs, rhs);
+        }
+
+        inline uint64x8& subtraction_assignment_operator_ss(
+            uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return lhs = subtraction_operator_ss(lhs, rhs);
+        }
+
+        inline uint64x8& multiplication_assignment_operator_ss(
+            uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return lhs = multiplication_operator_ss(lhs, rhs);
+        }
+
+        inline uint64x8& bitwise_and_assignment_operator_ss(
+            uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return lhs = _mm512_and_si512(lhs, rhs);
+        }
+
+        inline uint64x8& bitwise_or_assignment_operator_ss(
+            uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return lhs = _mm512_or_si512(lhs, rhs);
+        }
+
+        inline uint64x8& bitwise_xor_assignment_operator_ss(
+            uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return lhs = _mm512_xor_si512(lhs, rhs);
+        }
+
+        inline uint64x8& bitwise_shift_left_assignment_operator_si(
+            uint64x8& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        inline uint64x8& bitwise_shift_right_assignment_operator_si(
+            uint64x8& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return _mm512_cmpneq_epi64_mask(lhs, rhs) == 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return _mm512_cmpneq_epi64_mask(lhs, rhs) != 0;
+        }
+
+        inline uint64x8 abs_s(const uint64x8& s) noexcept
+        {
+            return s;
+        }
+
+        inline uint64x8 min_ss(
+            const uint64x8& s1, const uint64x8& s2) noexcept
+        {
+            return _mm512_min_epu64(s1, s2);
+        }
+
+        inline uint64x8 max_ss(
+            const uint64x8& s1, const uint64x8& s2) noexcept
+        {
+            return _mm512_max_epu64(s1, s2);
+        }
+
+        inline uint64x8 mask_ss(
+            const bool64x8& conditions,
+            const uint64x8& values) noexcept
+        {
+            return _mm512_maskz_mov_epi64(conditions.to_mask(), values);
+        }
+
+        inline uint64x8 select_sss(
+            const bool64x8& conditions,
+            const uint64x8& values,
+            const uint64x8& otherwise) noexcept
+        {
+            return _mm512_mask_blend_epi64(
+                conditions.to_mask(), otherwise, values);
+        }
+
+        inline bool64x8 less_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(
+                _mm512_cmplt_epu64_mask(lhs, rhs));
+        }
+
+        inline bool64x8 less_equal_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(
+                _mm512_cmple_epu64_mask(lhs, rhs));
+        }
+
+        inline bool64x8 greater_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(
+                _mm512_cmpgt_epu64_mask(lhs, rhs));
+        }
+
+        inline bool64x8 greater_equal_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(
+                _mm512_cmpge_epu64_mask(lhs, rhs));
+        }
+
+        inline bool64x8 equal_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(
+                _mm512_cmpeq_epi64_mask(lhs, rhs));
+        }
+
+        inline bool64x8 not_equal_ss(
+            const uint64x8& lhs, const uint64x8& rhs) noexcept
+        {
+            return bool64x8::from_mask(
+                _mm512_cmpneq_epi64_mask(lhs, rhs));
+        }
+
+        inline std::uint64_t hsum_s(const uint64x8& s) noexcept
+        {
+            return static_cast<std::uint64_t>(_mm512_reduce_add_epi64(s));
+        }
+
+        inline std::uint64_t hprod_s(const uint64x8& s) noexcept
+        {
+            return static_cast<std::uint64_t>(_mm512_reduce_mul_epi64(s));
+        }
+
+        inline std::uint64_t hmin_s(const uint64x8& s) noexcept
+        {
+            return _mm512_reduce_min_epu64(s);
+        }
+
+        inline std::uint64_t hmax_s(const uint64x8& s) noexcept
+        {
+            return _mm512_reduce_max_epu64(s);
+        }
+
+        template<int... I>
+        inline uint64x8 shuffle_s(const uint64x8& s) noexcept
+        {
+            // _mm512_setr_epi64 is a macro in some compilers, so it
+            // can't take a pack expansion.
+            static const std::int64_t indices[] = { I... };
+            return _mm512_permutexvar_epi64(_mm512_loadu_si512(indices), s);
+        }
+    }
+}
@@ -10,6 +10,10 @@
 
 #include <xmmintrin.h>
 
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -19,6 +23,10 @@
 #include <emmintrin.h>
 #endif
 
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -127,6 +135,31 @@ namespace tue
             return _mm_loadu_ps(reinterpret_cast<const float*>(data));
         }
 
+        static bool32x4 load_partial(const bool32* data, int count) noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool32, 4>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            return _mm_maskload_ps(
+                reinterpret_cast<const float*>(data), vmask);
+#else
+            return tue::detail_::load_partial_s<bool32, 4>(data, count);
+#endif
+        }
+
+        static bool32x4 maskload(
+            const bool32* data, const bool32x4& conditions) noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            return _mm_maskload_ps(
+                reinterpret_cast<const float*>(data), vmask);
+#else
+            return tue::detail_::maskload_s<bool32, 4>(data, conditions);
+#endif
+        }
+
         void store(bool32* data) const noexcept
         {
             _mm_store_ps(reinterpret_cast<float*>(data), underlying_);
@@ -137,6 +170,36 @@ namespace tue
             _mm_storeu_ps(reinterpret_cast<float*>(data), underlying_);
         }
 
+        void store_stream(bool32* data) const noexcept
+        {
+            _mm_stream_ps(reinterpret_cast<float*>(data), underlying_);
+        }
+
+        void store_partial(bool32* data, int count) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool32, 4>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            _mm_maskstore_ps(
+                reinterpret_cast<float*>(data), vmask, underlying_);
+#else
+            tue::detail_::store_partial_s<4>(this->data(), data, count);
+#endif
+        }
+
+        void maskstore(
+            bool32* data, const bool32x4& conditions) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            _mm_maskstore_ps(
+                reinterpret_cast<float*>(data), vmask, underlying_);
+#else
+            tue::detail_::maskstore_s<4>(this->data(), data, conditions);
+#endif
+        }
+
         const bool32* data() const noexcept
         {
             return reinterpret_cast<const bool32*>(&underlying_);
@@ -221,9 +284,13 @@ namespace tue
             const bool32x4& values,
             const bool32x4& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_ps(otherwise, values, conditions);
+#else
             return _mm_or_ps(
                 _mm_and_ps(conditions, values),
                 _mm_andnot_ps(conditions, otherwise));
+#endif
         }
 
 #ifdef TUE_SSE2
@@ -239,5 +306,10 @@ namespace tue
             return _mm_xor_si128(_mm_cmpeq_epi32(lhs, rhs), bool32x4(true32));
         }
 #endif
+
+        inline std::uint64_t movemask_s(const bool32x4& s) noexcept
+        {
+            return static_cast<std::uint64_t>(_mm_movemask_ps(s));
+        }
     }
 }
@@ -34,6 +34,12 @@
 
 #include <xmmintrin.h>
 
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
+#include <cstdint>
+#include <memory>
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -44,6 +50,10 @@
 #include <mmintrin.h>
 #endif
 
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -135,6 +145,55 @@ namespace tue
             return _mm_loadu_ps(data);
         }
 
+        static float32x4 gather(
+            const float* base, const int32x4& indices) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = reinterpret_cast<const __m128i&>(indices);
+            return _mm_i32gather_ps(base, vindex, 4);
+#else
+            return tue::detail_::gather_s<float, 4>(base, indices);
+#endif
+        }
+
+        static float32x4 gather(
+            const float* base,
+            const int32x4& indices,
+            const bool32x4& conditions) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = reinterpret_cast<const __m128i&>(indices);
+            const auto vmask = reinterpret_cast<const __m128&>(conditions);
+            return _mm_mask_i32gather_ps(
+                _mm_setzero_ps(), base, vindex, vmask, 4);
+#else
+            return tue::detail_::gather_s<float, 4>(base, indices, conditions);
+#endif
+        }
+
+        static float32x4 load_partial(const float* data, int count) noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool32, 4>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            return _mm_maskload_ps(data, vmask);
+#else
+            return tue::detail_::load_partial_s<float, 4>(data, count);
+#endif
+        }
+
+        static float32x4 maskload(
+            const float* data, const bool32x4& conditions) noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            return _mm_maskload_ps(data, vmask);
+#else
+            return tue::detail_::maskload_s<float, 4>(data, conditions);
+#endif
+        }
+
         void store(float* data) const noexcept
         {
             _mm_store_ps(data, underlying_);
@@ -145,6 +204,48 @@ namespace tue
             _mm_storeu_ps(data, underlying_);
         }
 
+        void store_stream(float* data) const noexcept
+        {
+            _mm_stream_ps(data, underlying_);
+        }
+
+        void scatter(float* base, const int32x4& indices) const noexcept
+        {
+            tue::detail_::scatter_s<4>(this->data(), base, indices);
+        }
+
+        void scatter(
+            float* base,
+            const int32x4& indices,
+            const bool32x4& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<4>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(float* data, int count) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool32, 4>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            _mm_maskstore_ps(data, vmask, underlying_);
+#else
+            tue::detail_::store_partial_s<4>(this->data(), data, count);
+#endif
+        }
+
+        void maskstore(
+            float* data, const bool32x4& conditions) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            _mm_maskstore_ps(data, vmask, underlying_);
+#else
+            tue::detail_::maskstore_s<4>(this->data(), data, conditions);
+#endif
+        }
+
         const float* data() const noexcept
         {
             return reinterpret_cast<const float*>(&underlying_);
@@ -458,6 +559,162 @@ namespace tue
             return cos;
         }
 
+        inline float32x4 tan_s(const float32x4& s) noexcept
+        {
+            float32x4 sin, cos;
+            sincos_s(s, sin, cos);
+            return _mm_div_ps(sin, cos);
+        }
+
+        inline __m128 select_ps(
+            const __m128& mask, const __m128& a, const __m128& b) noexcept
+        {
+#ifdef TUE_SSE41
+            return _mm_blendv_ps(b, a, mask);
+#else
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+#endif
+        }
+
+        // Computes asin(x) for 0 <= x <= 0.5 where z = x*x. This is the
+        // polynomial from Cephes' asinf().
+        inline __m128 asin_kernel_ps(const __m128& x, const __m128& z) noexcept
+        {
+            __m128 y = _mm_set1_ps(4.2163199048e-2f);
+            y = _mm_add_ps(_mm_mul_ps(y, z), _mm_set1_ps(2.4181311049e-2f));
+            y = _mm_add_ps(_mm_mul_ps(y, z), _mm_set1_ps(4.5470025998e-2f));
+            y = _mm_add_ps(_mm_mul_ps(y, z), _mm_set1_ps(7.4953002686e-2f));
+            y = _mm_add_ps(_mm_mul_ps(y, z), _mm_set1_ps(1.6666752422e-1f));
+            return _mm_add_ps(_mm_mul_ps(_mm_mul_ps(y, z), x), x);
+        }
+
+        inline float32x4 asin_s(const float32x4& s) noexcept
+        {
+            const __m128 sign_mask = _mm_set1_ps(binary_float(0x80000000u));
+            const __m128 half = _mm_set1_ps(0.5f);
+            const __m128 sign = _mm_and_ps(s, sign_mask);
+            const __m128 a = _mm_andnot_ps(sign_mask, s);
+
+            // For |x| > 0.5, asin(|x|) = pi/2 - 2*asin(sqrt((1 - |x|)/2))
+            const __m128 big = _mm_cmpgt_ps(a, half);
+            const __m128 zbig = _mm_mul_ps(
+                half, _mm_sub_ps(_mm_set1_ps(1.0f), a));
+            const __m128 z = select_ps(big, zbig, _mm_mul_ps(a, a));
+            const __m128 x = select_ps(big, _mm_sqrt_ps(zbig), a);
+            const __m128 y = asin_kernel_ps(x, z);
+
+            const __m128 result = select_ps(
+                big,
+                _mm_sub_ps(_mm_set1_ps(1.57079632679489661923f),
+                           _mm_add_ps(y, y)),
+                y);
+            return _mm_xor_ps(result, sign);
+        }
+
+        inline float32x4 acos_s(const float32x4& s) noexcept
+        {
+            const __m128 sign_mask = _mm_set1_ps(binary_float(0x80000000u));
+            const __m128 half = _mm_set1_ps(0.5f);
+            const __m128 sign = _mm_and_ps(s, sign_mask);
+            const __m128 a = _mm_andnot_ps(sign_mask, s);
+
+            const __m128 big = _mm_cmpgt_ps(a, half);
+            const __m128 zbig = _mm_mul_ps(
+                half, _mm_sub_ps(_mm_set1_ps(1.0f), a));
+            const __m128 z = select_ps(big, zbig, _mm_mul_ps(a, a));
+            const __m128 x = select_ps(big, _mm_sqrt_ps(zbig), a);
+            const __m128 y = asin_kernel_ps(x, z);
+
+            // For |x| > 0.5, acos(|x|) = 2*asin(sqrt((1 - |x|)/2)) and
+            // acos(-|x|) = pi - acos(|x|). Otherwise,
+            // acos(x) = pi/2 - asin(x).
+            const __m128 y2 = _mm_add_ps(y, y);
+            const __m128 big_result = select_ps(
+                _mm_cmplt_ps(s, _mm_setzero_ps()),
+                _mm_sub_ps(_mm_set1_ps(3.14159265358979323846f), y2),
+                y2);
+            const __m128 small_result = _mm_sub_ps(
+                _mm_set1_ps(1.57079632679489661923f), _mm_xor_ps(y, sign));
+            return select_ps(big, big_result, small_result);
+        }
+
+        inline float32x4 atan_s(const float32x4& s) noexcept
+        {
+            // This function's implementation is based on Cephes' atanf().
+            const __m128 sign_mask = _mm_set1_ps(binary_float(0x80000000u));
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 sign = _mm_and_ps(s, sign_mask);
+            const __m128 a = _mm_andnot_ps(sign_mask, s);
+
+            // Reduce the range to [-tan(pi/8), tan(pi/8)]
+            const __m128 big = _mm_cmpgt_ps(
+                a, _mm_set1_ps(2.414213562373095f));
+            const __m128 mid = _mm_cmpgt_ps(
+                a, _mm_set1_ps(0.4142135623730950f));
+            const __m128 num = select_ps(
+                big,
+                _mm_set1_ps(-1.0f),
+                select_ps(mid, _mm_sub_ps(a, one), a));
+            const __m128 den = select_ps(
+                big, a, select_ps(mid, _mm_add_ps(a, one), one));
+            const __m128 y0 = select_ps(
+                big,
+                _mm_set1_ps(1.57079632679489661923f),
+                _mm_and_ps(mid, _mm_set1_ps(0.78539816339744830962f)));
+            const __m128 x = _mm_div_ps(num, den);
+            const __m128 z = _mm_mul_ps(x, x);
+
+            __m128 y = _mm_set1_ps(8.05374449538e-2f);
+            y = _mm_sub_ps(_mm_mul_ps(y, z), _mm_set1_ps(1.38776856032e-1f));
+            y = _mm_add_ps(_mm_mul_ps(y, z), _mm_set1_ps(1.99777106478e-1f));
+            y = _mm_sub_ps(_mm_mul_ps(y, z), _mm_set1_ps(3.33329491539e-1f));
+            y = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(y, z), x), x);
+            return _mm_xor_ps(_mm_add_ps(y, y0), sign);
+        }
+
+        inline float32x4 atan2_ss(
+            const float32x4& y, const float32x4& x) noexcept
+        {
+            const __m128 sign_mask = _mm_set1_ps(binary_float(0x80000000u));
+            const __m128 ax = _mm_andnot_ps(sign_mask, x);
+            const __m128 ay = _mm_andnot_ps(sign_mask, y);
+
+            // Compute the angle in the first octant and then reflect it
+            const __m128 lo = _mm_min_ps(ax, ay);
+            const __m128 hi = _mm_max_ps(ax, ay);
+            // inf/inf is NAN, but atan2(+-inf, +-inf) is an odd multiple
+            // of pi/4, so use t = 1 there
+            const __m128 inf = _mm_set1_ps(binary_float(0x7F800000));
+            const __m128 both_inf = _mm_and_ps(
+                _mm_cmpeq_ps(ax, inf), _mm_cmpeq_ps(ay, inf));
+            const __m128 t = select_ps(
+                both_inf,
+                _mm_set1_ps(1.0f),
+                _mm_and_ps(
+                    _mm_div_ps(lo, hi),
+                    _mm_cmpneq_ps(hi, _mm_setzero_ps())));
+            __m128 a = atan_s(float32x4(t));
+            a = select_ps(
+                _mm_cmpgt_ps(ay, ax),
+                _mm_sub_ps(_mm_set1_ps(1.57079632679489661923f), a),
+                a);
+#ifdef TUE_SSE2
+            const __m128 x_negative = _mm_castsi128_ps(
+                _mm_srai_epi32(_mm_castps_si128(x), 31));
+#else
+            // Use +-1 with the sign of x so that -0 also counts
+            const __m128 x_negative = _mm_cmplt_ps(
+                _mm_or_ps(_mm_and_ps(x, sign_mask), _mm_set1_ps(1.0f)),
+                _mm_setzero_ps());
+#endif
+            a = select_ps(
+                x_negative,
+                _mm_sub_ps(_mm_set1_ps(3.14159265358979323846f), a),
+                a);
+            a = _mm_xor_ps(a, _mm_and_ps(y, sign_mask));
+            return _mm_or_ps(a, _mm_cmpunord_ps(y, x));
+        }
+
         inline float32x4 exp_s(const float32x4& s) noexcept
         {
             // This function's implementation is based on Julien Pommier's
@@ -479,6 +736,9 @@ namespace tue
             fx = _mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f));
             fx = _mm_add_ps(fx, _mm_set1_ps(0.5f));
 
+#ifdef TUE_SSE41
+            fx = _mm_floor_ps(fx);
+#else
             /* how to perform a floorf with SSE: just below */
 #ifndef TUE_SSE2
             /* step 1 : cast to int */
@@ -497,6 +757,7 @@ namespace tue
             __m128 mask = _mm_cmpgt_ps(tmp, fx);
             mask = _mm_and_ps(mask, one);
             fx = _mm_sub_ps(tmp, mask);
+#endif
 
             tmp = _mm_mul_ps(fx, _mm_set1_ps(0.693359375f));
             __m128 z = _mm_mul_ps(fx, _mm_set1_ps(-2.12194440e-4f));
@@ -632,6 +893,121 @@ namespace tue
             return x;
         }
 
+        inline float32x4 exp2_s(const float32x4& s) noexcept
+        {
+#ifdef TUE_SSE2
+            // This function's implementation is based on Cephes' exp2f().
+            // 2^x is split into 2^n * 2^f with n = round(x) and |f| <= 0.5.
+            // The constant comes first in min and max so NaN passes
+            // through.
+            __m128 x = s;
+            x = _mm_min_ps(_mm_set1_ps(129.0f), x);
+            x = _mm_max_ps(_mm_set1_ps(-150.0f), x);
+
+            const __m128i n = _mm_cvtps_epi32(x);
+            x = _mm_sub_ps(x, _mm_cvtepi32_ps(n));
+
+            __m128 y = _mm_set1_ps(1.535336188319500e-4f);
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(1.339887440266574e-3f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(9.618437357674640e-3f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(5.550332471162809e-2f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(2.402264791363012e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(6.931472028550421e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(1.0f));
+
+            // 2^n is applied in two halves so that neither overflows the
+            // exponent field when the result is infinite or subnormal.
+            const __m128i n1 = _mm_srai_epi32(n, 1);
+            const __m128i n2 = _mm_sub_epi32(n, n1);
+            const __m128i bias = _mm_set1_epi32(0x7F);
+            y = _mm_mul_ps(y, _mm_castsi128_ps(
+                _mm_slli_epi32(_mm_add_epi32(n1, bias), 23)));
+            y = _mm_mul_ps(y, _mm_castsi128_ps(
+                _mm_slli_epi32(_mm_add_epi32(n2, bias), 23)));
+            return y;
+#else
+            return exp_s(float32x4(
+                _mm_mul_ps(s, _mm_set1_ps(0.693147180559945309f))));
+#endif
+        }
+
+        inline float32x4 log2_s(const float32x4& s) noexcept
+        {
+#ifdef TUE_SSE2
+            // This function's implementation is based on Cephes' log2f().
+            // The reduction is the same as in log_s(), but the result is
+            // scaled by log2(e) instead of having ln(2) * e added to it.
+            __m128 x = s;
+
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 invalid_mask = _mm_cmpnge_ps(x, zero);
+            const __m128 zero_mask = _mm_cmpeq_ps(x, zero);
+            const __m128 inf = _mm_set1_ps(binary_float(0x7F800000));
+            const __m128 inf_mask = _mm_cmpeq_ps(x, inf);
+
+            /* cut off denormalized stuff */
+            x = _mm_max_ps(x, _mm_set1_ps(binary_float(0x00800000)));
+
+            /* x = frexpf(x, &e); */
+            __m128i emm0 = _mm_srli_epi32(_mm_castps_si128(x), 23);
+            emm0 = _mm_sub_epi32(emm0, _mm_set1_epi32(0x7E));
+            __m128 e = _mm_cvtepi32_ps(emm0);
+            x = _mm_and_ps(x, _mm_set1_ps(binary_float(~0x7f800000)));
+            x = _mm_or_ps(x, _mm_set1_ps(0.5f));
+
+            /* if (x < SQRTHF) { e -= 1; x = x + x - 1; } else { x -= 1; } */
+            const __m128 mask = _mm_cmplt_ps(
+                x, _mm_set1_ps(0.707106781186547524f));
+            const __m128 tmp = _mm_and_ps(x, mask);
+            x = _mm_sub_ps(x, one);
+            e = _mm_sub_ps(e, _mm_and_ps(one, mask));
+            x = _mm_add_ps(x, tmp);
+
+            const __m128 z = _mm_mul_ps(x, x);
+
+            __m128 y = _mm_set1_ps(7.0376836292e-2f);
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(-1.1514610310e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(1.1676998740e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(-1.2420140846e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(1.4249322787e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(-1.6668057665e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(2.0000714765e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(-2.4999993993e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(3.3333331174e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_mul_ps(y, z);
+            y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+
+            /* y * log2(e) + x * log2(e) + y + x + e, with log2(e) - 1 */
+            const __m128 log2ea = _mm_set1_ps(0.44269504088896340736f);
+            __m128 r = _mm_mul_ps(y, log2ea);
+            r = _mm_add_ps(r, _mm_mul_ps(x, log2ea));
+            r = _mm_add_ps(r, y);
+            r = _mm_add_ps(r, x);
+            r = _mm_add_ps(r, e);
+            r = select_ps(inf_mask, inf, r);
+            r = select_ps(zero_mask, _mm_sub_ps(zero, inf), r);
+            return _mm_or_ps(r, invalid_mask); // negative arg will be NAN
+#else
+            return _mm_mul_ps(log_s(s), _mm_set1_ps(1.44269504088896341f));
+#endif
+        }
+
         inline float32x4 abs_s(const float32x4& s) noexcept
         {
             return _mm_and_ps(s, float32x4(binary_float(0x7FFFFFFF)));
@@ -643,21 +1019,62 @@ namespace tue
             return exp_s(float32x4(_mm_mul_ps(log_s(bases), exponents)));
         }
 
-        inline float32x4 recip_s(const float32x4& s) noexcept
+        inline float32x4 recip_fast_s(const float32x4& s) noexcept
         {
             return _mm_rcp_ps(s);
         }
 
+        // Lanes where a recip/rsqrt estimate is 0 or inf. The refinement
+        // step would compute 0*inf = NAN there, so these keep the estimate.
+        inline __m128 special_estimate_mask(const __m128& r) noexcept
+        {
+            const auto abs_r = _mm_and_ps(
+                r, _mm_set1_ps(binary_float(0x7FFFFFFF)));
+            return _mm_or_ps(
+                _mm_cmpeq_ps(r, _mm_setzero_ps()),
+                _mm_cmpeq_ps(abs_r, _mm_set1_ps(binary_float(0x7F800000))));
+        }
+
+        inline float32x4 recip_s(const float32x4& s) noexcept
+        {
+            // One Newton-Raphson step: r * (2 - s*r)
+            const auto r = _mm_rcp_ps(s);
+            const auto refined = _mm_sub_ps(
+                _mm_add_ps(r, r), _mm_mul_ps(_mm_mul_ps(s, r), r));
+            return select_ps(special_estimate_mask(r), r, refined);
+        }
+
+        inline float32x4 recip_exact_s(const float32x4& s) noexcept
+        {
+            return _mm_div_ps(_mm_set1_ps(1.0f), s);
+        }
+
         inline float32x4 sqrt_s(const float32x4& s) noexcept
         {
             return _mm_sqrt_ps(s);
         }
 
-        inline float32x4 rsqrt_s(const float32x4& s) noexcept
+        inline float32x4 rsqrt_fast_s(const float32x4& s) noexcept
         {
             return _mm_rsqrt_ps(s);
         }
 
+        inline float32x4 rsqrt_s(const float32x4& s) noexcept
+        {
+            // One Newton-Raphson step: r/2 * (3 - s*r*r)
+            const auto r = _mm_rsqrt_ps(s);
+            const auto srr = _mm_mul_ps(_mm_mul_ps(s, r), r);
+            const auto refined = _mm_mul_ps(
+                _mm_mul_ps(_mm_set1_ps(0.5f), r),
+                _mm_sub_ps(_mm_set1_ps(3.0f), srr));
+            return select_ps(special_estimate_mask(r), r, refined);
+        }
+
+        inline float32x4 rsqrt_exact_s(const float32x4& s) noexcept
+        {
+            return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(s));
+        }
+
         inline float32x4 min_ss(
             const float32x4& s1, const float32x4& s2) noexcept
         {
@@ -682,9 +1099,13 @@ namespace tue
             const float32x4& values,
             const float32x4& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_ps(otherwise, values, conditions);
+#else
             return _mm_or_ps(
                 _mm_and_ps(conditions, values),
                 _mm_andnot_ps(conditions, otherwise));
+#endif
         }
 
         inline bool32x4 less_ss(
@@ -722,5 +1143,51 @@ namespace tue
         {
             return _mm_cmpneq_ps(lhs, rhs);
         }
+
+        inline float hsum_s(const float32x4& s) noexcept
+        {
+            const auto t = _mm_add_ps(s, _mm_movehl_ps(s, s));
+            return _mm_cvtss_f32(_mm_add_ss(
+                t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+
+        inline float hprod_s(const float32x4& s) noexcept
+        {
+            const auto t = _mm_mul_ps(s, _mm_movehl_ps(s, s));
+            return _mm_cvtss_f32(_mm_mul_ss(
+                t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+
+        inline float hmin_s(const float32x4& s) noexcept
+        {
+            const auto t = _mm_min_ps(s, _mm_movehl_ps(s, s));
+            return _mm_cvtss_f32(_mm_min_ss(
+                t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+
+        inline float hmax_s(const float32x4& s) noexcept
+        {
+            const auto t = _mm_max_ps(s, _mm_movehl_ps(s, s));
+            return _mm_cvtss_f32(_mm_max_ss(
+                t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline float32x4 shuffle_s(const float32x4& s) noexcept
+        {
+            return _mm_shuffle_ps(s, s, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+
+        inline float32x4 unpack_lo_ss(
+            const float32x4& s1, const float32x4& s2) noexcept
+        {
+            return _mm_unpacklo_ps(s1, s2);
+        }
+
+        inline float32x4 unpack_hi_ss(
+            const float32x4& s1, const float32x4& s2) noexcept
+        {
+            return _mm_unpackhi_ps(s1, s2);
+        }
     }
 }
@@ -10,6 +10,10 @@
 
 #include <emmintrin.h>
 
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -115,6 +119,17 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        static bool16x8 load_partial(const bool16* data, int count) noexcept
+        {
+            return tue::detail_::load_partial_s<bool16, 8>(data, count);
+        }
+
+        static bool16x8 maskload(
+            const bool16* data, const bool16x8& conditions) noexcept
+        {
+            return tue::detail_::maskload_s<bool16, 8>(data, conditions);
+        }
+
         void store(bool16* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -125,6 +140,22 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void store_stream(bool16* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        void store_partial(bool16* data, int count) const noexcept
+        {
+            tue::detail_::store_partial_s<8>(this->data(), data, count);
+        }
+
+        void maskstore(
+            bool16* data, const bool16x8& conditions) const noexcept
+        {
+            tue::detail_::maskstore_s<8>(this->data(), data, conditions);
+        }
+
         const bool16* data() const noexcept
         {
             return reinterpret_cast<const bool16*>(&underlying_);
@@ -220,9 +251,13 @@ namespace tue
             const bool16x8& values,
             const bool16x8& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         inline bool16x8 equal_ss(
@@ -236,5 +271,11 @@ namespace tue
         {
             return _mm_xor_si128(_mm_cmpeq_epi16(lhs, rhs), bool16x8(true16));
         }
+
+        inline std::uint64_t movemask_s(const bool16x8& s) noexcept
+        {
+            return static_cast<std::uint64_t>(_mm_movemask_epi8(
+                _mm_packs_epi16(s, _mm_setzero_si128())));
+        }
     }
 }
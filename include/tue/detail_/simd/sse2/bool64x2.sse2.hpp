@@ -10,6 +10,14 @@
 
 #include <emmintrin.h>
 
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -115,6 +123,31 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        static bool64x2 load_partial(const bool64* data, int count) noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool64, 2>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            return _mm_castpd_si128(
+                _mm_maskload_pd(reinterpret_cast<const double*>(data), vmask));
+#else
+            return tue::detail_::load_partial_s<bool64, 2>(data, count);
+#endif
+        }
+
+        static bool64x2 maskload(
+            const bool64* data, const bool64x2& conditions) noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            return _mm_castpd_si128(
+                _mm_maskload_pd(reinterpret_cast<const double*>(data), vmask));
+#else
+            return tue::detail_::maskload_s<bool64, 2>(data, conditions);
+#endif
+        }
+
         void store(bool64* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -125,6 +158,40 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void store_stream(bool64* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        void store_partial(bool64* data, int count) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool64, 2>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            _mm_maskstore_pd(
+                reinterpret_cast<double*>(data),
+                vmask,
+                _mm_castsi128_pd(underlying_));
+#else
+            tue::detail_::store_partial_s<2>(this->data(), data, count);
+#endif
+        }
+
+        void maskstore(
+            bool64* data, const bool64x2& conditions) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            _mm_maskstore_pd(
+                reinterpret_cast<double*>(data),
+                vmask,
+                _mm_castsi128_pd(underlying_));
+#else
+            tue::detail_::maskstore_s<2>(this->data(), data, conditions);
+#endif
+        }
+
         const bool64* data() const noexcept
         {
             return reinterpret_cast<const bool64*>(&underlying_);
@@ -207,9 +274,13 @@ namespace tue
             const bool64x2& values,
             const bool64x2& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         inline bool64x2 equal_ss(
@@ -226,5 +297,10 @@ namespace tue
         {
             return _mm_xor_si128(equal_ss(lhs, rhs), bool64x2(true64));
         }
+
+        inline std::uint64_t movemask_s(const bool64x2& s) noexcept
+        {
+            return static_cast<std::uint64_t>(_mm_movemask_pd(s));
+        }
     }
 }
@@ -10,6 +10,10 @@
 
 #include <emmintrin.h>
 
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -124,6 +128,17 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        static bool8x16 load_partial(const bool8* data, int count) noexcept
+        {
+            return tue::detail_::load_partial_s<bool8, 16>(data, count);
+        }
+
+        static bool8x16 maskload(
+            const bool8* data, const bool8x16& conditions) noexcept
+        {
+            return tue::detail_::maskload_s<bool8, 16>(data, conditions);
+        }
+
         void store(bool8* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -134,6 +149,22 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void store_stream(bool8* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        void store_partial(bool8* data, int count) const noexcept
+        {
+            tue::detail_::store_partial_s<16>(this->data(), data, count);
+        }
+
+        void maskstore(
+            bool8* data, const bool8x16& conditions) const noexcept
+        {
+            tue::detail_::maskstore_s<16>(this->data(), data, conditions);
+        }
+
         const bool8* data() const noexcept
         {
             return reinterpret_cast<const bool8*>(&underlying_);
@@ -229,9 +260,13 @@ namespace tue
             const bool8x16& values,
             const bool8x16& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         inline bool8x16 equal_ss(
@@ -245,5 +280,10 @@ namespace tue
         {
             return _mm_xor_si128(_mm_cmpeq_epi8(lhs, rhs), bool8x16(true8));
         }
+
+        inline std::uint64_t movemask_s(const bool8x16& s) noexcept
+        {
+            return static_cast<std::uint64_t>(_mm_movemask_epi8(s));
+        }
     }
 }
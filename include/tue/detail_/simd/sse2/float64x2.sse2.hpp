@@ -35,6 +35,18 @@
 #include <xmmintrin.h>
 #include <emmintrin.h>
 
+#include <cmath>
+
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
+#include <cstdint>
+#include <memory>
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -128,6 +140,58 @@ namespace tue
             return _mm_loadu_pd(data);
         }
 
+        static float64x2 gather(
+            const double* base, const int32x2& indices) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = _mm_loadl_epi64(
+                reinterpret_cast<const __m128i*>(std::addressof(indices)));
+            return _mm_i32gather_pd(base, vindex, 8);
+#else
+            return tue::detail_::gather_s<double, 2>(base, indices);
+#endif
+        }
+
+        static float64x2 gather(
+            const double* base,
+            const int32x2& indices,
+            const bool64x2& conditions) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = _mm_loadl_epi64(
+                reinterpret_cast<const __m128i*>(std::addressof(indices)));
+            const auto vmask = reinterpret_cast<const __m128d&>(conditions);
+            return _mm_mask_i32gather_pd(
+                _mm_setzero_pd(), base, vindex, vmask, 8);
+#else
+            return tue::detail_::gather_s<double, 2>(
+                base, indices, conditions);
+#endif
+        }
+
+        static float64x2 load_partial(const double* data, int count) noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool64, 2>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            return _mm_maskload_pd(data, vmask);
+#else
+            return tue::detail_::load_partial_s<double, 2>(data, count);
+#endif
+        }
+
+        static float64x2 maskload(
+            const double* data, const bool64x2& conditions) noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            return _mm_maskload_pd(data, vmask);
+#else
+            return tue::detail_::maskload_s<double, 2>(data, conditions);
+#endif
+        }
+
         void store(double* data) const noexcept
         {
             _mm_store_pd(data, underlying_);
@@ -138,6 +202,48 @@ namespace tue
             _mm_storeu_pd(data, underlying_);
         }
 
+        void store_stream(double* data) const noexcept
+        {
+            _mm_stream_pd(data, underlying_);
+        }
+
+        void scatter(double* base, const int32x2& indices) const noexcept
+        {
+            tue::detail_::scatter_s<2>(this->data(), base, indices);
+        }
+
+        void scatter(
+            double* base,
+            const int32x2& indices,
+            const bool64x2& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<2>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(double* data, int count) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool64, 2>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            _mm_maskstore_pd(data, vmask, underlying_);
+#else
+            tue::detail_::store_partial_s<2>(this->data(), data, count);
+#endif
+        }
+
+        void maskstore(
+            double* data, const bool64x2& conditions) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            _mm_maskstore_pd(data, vmask, underlying_);
+#else
+            tue::detail_::maskstore_s<2>(this->data(), data, conditions);
+#endif
+        }
+
         const double* data() const noexcept
         {
             return reinterpret_cast<const double*>(&underlying_);
@@ -374,6 +480,352 @@ namespace tue
             return cos;
         }
 
+        inline __m128d select_pd(
+            const __m128d& mask, const __m128d& a, const __m128d& b) noexcept
+        {
+#ifdef TUE_SSE41
+            return _mm_blendv_pd(b, a, mask);
+#else
+            return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+#endif
+        }
+
+        inline void sincos_accurate_s(
+            const float64x2& s,
+            float64x2& sin_out,
+            float64x2& cos_out) noexcept
+        {
+            // This function's implementation is based on FreeBSD's msun
+            // (k_sin.c, k_cos.c, and the medium case of e_rem_pio2.c). x is
+            // reduced to r = x - n*pi/2 as a hi + lo pair using pi/2 split
+            // into three 33-bit parts plus tails, which keeps r accurate
+            // for |x| up to about 2^20 * pi/2. Larger components fall back
+            // to std::sin() and std::cos(), which use Payne-Hanek
+            // reduction.
+            const __m128d x = s;
+
+            /* n = rint(x * 2/pi) */
+            const __m128i n = _mm_cvtpd_epi32(
+                _mm_mul_pd(x, _mm_set1_pd(6.36619772367581382433e-01)));
+            const __m128d fn = _mm_cvtepi32_pd(n);
+
+            /* 1st round, good to 85 bits */
+            __m128d r = _mm_sub_pd(
+                x, _mm_mul_pd(fn, _mm_set1_pd(1.57079632673412561417e+00)));
+
+            /* 2nd round, good to 118 bits */
+            __m128d t = r;
+            __m128d w = _mm_mul_pd(
+                fn, _mm_set1_pd(6.07710050630396597660e-11));
+            r = _mm_sub_pd(t, w);
+            w = _mm_sub_pd(
+                _mm_mul_pd(fn, _mm_set1_pd(2.02226624879595063154e-21)),
+                _mm_sub_pd(_mm_sub_pd(t, r), w));
+
+            /* 3rd round, good to 151 bits */
+            t = r;
+            w = _mm_mul_pd(fn, _mm_set1_pd(2.02226624871116645580e-21));
+            r = _mm_sub_pd(t, w);
+            w = _mm_sub_pd(
+                _mm_mul_pd(fn, _mm_set1_pd(8.47842766036889956997e-32)),
+                _mm_sub_pd(_mm_sub_pd(t, r), w));
+
+            /* r = y0 + y1 */
+            const __m128d y0 = _mm_sub_pd(r, w);
+            const __m128d y1 = _mm_sub_pd(_mm_sub_pd(r, y0), w);
+
+            const __m128d z = _mm_mul_pd(y0, y0);
+            const __m128d zz = _mm_mul_pd(z, z);
+            const __m128d half = _mm_set1_pd(0.5);
+            const __m128d one = _mm_set1_pd(1.0);
+
+            /* __kernel_sin(y0, y1, 1) */
+            __m128d sr = _mm_set1_pd(1.58969099521155010221e-10);
+            sr = _mm_mul_pd(sr, z);
+            sr = _mm_add_pd(sr, _mm_set1_pd(-2.50507602534068634195e-08));
+            sr = _mm_mul_pd(sr, _mm_mul_pd(z, zz));
+            __m128d sp = _mm_set1_pd(2.75573137070700676789e-06);
+            sp = _mm_mul_pd(sp, z);
+            sp = _mm_add_pd(sp, _mm_set1_pd(-1.98412698298579493134e-04));
+            sp = _mm_mul_pd(sp, z);
+            sp = _mm_add_pd(sp, _mm_set1_pd(8.33333333332248946124e-03));
+            sr = _mm_add_pd(sr, sp);
+            const __m128d v = _mm_mul_pd(z, y0);
+            __m128d ys = _mm_sub_pd(_mm_mul_pd(half, y1), _mm_mul_pd(v, sr));
+            ys = _mm_sub_pd(_mm_mul_pd(z, ys), y1);
+            ys = _mm_sub_pd(ys, _mm_mul_pd(
+                v, _mm_set1_pd(-1.66666666666666324348e-01)));
+            ys = _mm_sub_pd(y0, ys);
+
+            /* __kernel_cos(y0, y1) */
+            __m128d cr = _mm_set1_pd(-1.13596475577881948265e-11);
+            cr = _mm_mul_pd(cr, z);
+            cr = _mm_add_pd(cr, _mm_set1_pd(2.08757232129817482790e-09));
+            cr = _mm_mul_pd(cr, z);
+            cr = _mm_add_pd(cr, _mm_set1_pd(-2.75573143513906633035e-07));
+            cr = _mm_mul_pd(cr, _mm_mul_pd(zz, zz));
+            __m128d cp = _mm_set1_pd(2.48015872894767294178e-05);
+            cp = _mm_mul_pd(cp, z);
+            cp = _mm_add_pd(cp, _mm_set1_pd(-1.38888888888741095749e-03));
+            cp = _mm_mul_pd(cp, z);
+            cp = _mm_add_pd(cp, _mm_set1_pd(4.16666666666666019037e-02));
+            cr = _mm_add_pd(cr, _mm_mul_pd(cp, z));
+            const __m128d hz = _mm_mul_pd(half, z);
+            const __m128d cw = _mm_sub_pd(one, hz);
+            __m128d yc = _mm_sub_pd(_mm_mul_pd(z, cr), _mm_mul_pd(y0, y1));
+            yc = _mm_add_pd(_mm_sub_pd(_mm_sub_pd(one, cw), hz), yc);
+            yc = _mm_add_pd(cw, yc);
+
+            /* pick and negate the results by the quadrant n & 3 */
+            const __m128i nn = _mm_shuffle_epi32(n, _MM_SHUFFLE(1, 1, 0, 0));
+            const __m128d swap = _mm_castsi128_pd(_mm_cmpeq_epi32(
+                _mm_and_si128(nn, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+            const __m128d sin_sign = _mm_castsi128_pd(_mm_slli_epi64(
+                _mm_and_si128(nn, _mm_set1_epi64x(2)), 62));
+            const __m128d cos_sign = _mm_castsi128_pd(_mm_slli_epi64(
+                _mm_and_si128(
+                    _mm_add_epi32(nn, _mm_set1_epi32(1)),
+                    _mm_set1_epi64x(2)),
+                62));
+            __m128d sin = _mm_xor_pd(select_pd(swap, yc, ys), sin_sign);
+            __m128d cos = _mm_xor_pd(select_pd(swap, ys, yc), cos_sign);
+
+            const __m128d large = _mm_cmpnle_pd(
+                _mm_and_pd(
+                    x, _mm_set1_pd(binary_double(~0x8000000000000000ull))),
+                _mm_set1_pd(1647099.0));
+            if (_mm_movemask_pd(large) != 0)
+            {
+                alignas(16) double xs[2];
+                alignas(16) double ss[2];
+                alignas(16) double cs[2];
+                _mm_store_pd(xs, x);
+                _mm_store_pd(ss, sin);
+                _mm_store_pd(cs, cos);
+                for (int i = 0; i < 2; ++i)
+                {
+                    if (std::abs(xs[i]) > 1647099.0)
+                    {
+                        ss[i] = std::sin(xs[i]);
+                        cs[i] = std::cos(xs[i]);
+                    }
+                }
+                sin = _mm_load_pd(ss);
+                cos = _mm_load_pd(cs);
+            }
+
+            sin_out = sin;
+            cos_out = cos;
+        }
+
+        inline float64x2 sin_accurate_s(const float64x2& s) noexcept
+        {
+            float64x2 sin, cos;
+            sincos_accurate_s(s, sin, cos);
+            return sin;
+        }
+
+        inline float64x2 cos_accurate_s(const float64x2& s) noexcept
+        {
+            float64x2 sin, cos;
+            sincos_accurate_s(s, sin, cos);
+            return cos;
+        }
+
+        inline float64x2 tan_s(const float64x2& s) noexcept
+        {
+            // sincos_s() only has float-level accuracy, so this uses the
+            // double-precision reduction and polynomials of
+            // sincos_accurate_s() instead.
+            float64x2 sin, cos;
+            sincos_accurate_s(s, sin, cos);
+            return _mm_div_pd(sin, cos);
+        }
+
+        // Computes asin(x) for 0 <= x <= 0.5 where z = x*x. This is the
+        // rational approximation from Cephes' asin().
+        inline __m128d asin_kernel_pd(
+            const __m128d& x, const __m128d& z) noexcept
+        {
+            __m128d p = _mm_set1_pd(4.253011369004428248960e-3);
+            p = _mm_add_pd(
+                _mm_mul_pd(p, z), _mm_set1_pd(-6.019598008014123785661e-1));
+            p = _mm_add_pd(
+                _mm_mul_pd(p, z), _mm_set1_pd(5.444622390564711410273e0));
+            p = _mm_add_pd(
+                _mm_mul_pd(p, z), _mm_set1_pd(-1.626247967210700244449e1));
+            p = _mm_add_pd(
+                _mm_mul_pd(p, z), _mm_set1_pd(1.956261983317594739197e1));
+            p = _mm_add_pd(
+                _mm_mul_pd(p, z), _mm_set1_pd(-8.198089802484824371615e0));
+
+            __m128d q = _mm_add_pd(
+                z, _mm_set1_pd(-1.474091372988853791896e1));
+            q = _mm_add_pd(
+                _mm_mul_pd(q, z), _mm_set1_pd(7.049610280856842141659e1));
+            q = _mm_add_pd(
+                _mm_mul_pd(q, z), _mm_set1_pd(-1.471791292232726029859e2));
+            q = _mm_add_pd(
+                _mm_mul_pd(q, z), _mm_set1_pd(1.395105614657485689735e2));
+            q = _mm_add_pd(
+                _mm_mul_pd(q, z), _mm_set1_pd(-4.918853881490881290097e1));
+
+            const __m128d r = _mm_div_pd(_mm_mul_pd(z, p), q);
+            return _mm_add_pd(_mm_mul_pd(x, r), x);
+        }
+
+        inline float64x2 asin_s(const float64x2& s) noexcept
+        {
+            const __m128d sign_mask = _mm_set1_pd(-0.0);
+            const __m128d half = _mm_set1_pd(0.5);
+            const __m128d sign = _mm_and_pd(s, sign_mask);
+            const __m128d a = _mm_andnot_pd(sign_mask, s);
+
+            // For |x| > 0.5, asin(|x|) = pi/2 - 2*asin(sqrt((1 - |x|)/2))
+            const __m128d big = _mm_cmpgt_pd(a, half);
+            const __m128d zbig = _mm_mul_pd(
+                half, _mm_sub_pd(_mm_set1_pd(1.0), a));
+            const __m128d z = select_pd(big, zbig, _mm_mul_pd(a, a));
+            const __m128d x = select_pd(big, _mm_sqrt_pd(zbig), a);
+            const __m128d y = asin_kernel_pd(x, z);
+
+            const __m128d result = select_pd(
+                big,
+                _mm_add_pd(
+                    _mm_sub_pd(_mm_set1_pd(1.57079632679489661923),
+                               _mm_add_pd(y, y)),
+                    _mm_set1_pd(6.123233995736765886130e-17)),
+                y);
+            return _mm_xor_pd(result, sign);
+        }
+
+        inline float64x2 acos_s(const float64x2& s) noexcept
+        {
+            const __m128d sign_mask = _mm_set1_pd(-0.0);
+            const __m128d half = _mm_set1_pd(0.5);
+            const __m128d sign = _mm_and_pd(s, sign_mask);
+            const __m128d a = _mm_andnot_pd(sign_mask, s);
+
+            const __m128d big = _mm_cmpgt_pd(a, half);
+            const __m128d zbig = _mm_mul_pd(
+                half, _mm_sub_pd(_mm_set1_pd(1.0), a));
+            const __m128d z = select_pd(big, zbig, _mm_mul_pd(a, a));
+            const __m128d x = select_pd(big, _mm_sqrt_pd(zbig), a);
+            const __m128d y = asin_kernel_pd(x, z);
+
+            // For |x| > 0.5, acos(|x|) = 2*asin(sqrt((1 - |x|)/2)) and
+            // acos(-|x|) = pi - acos(|x|). Otherwise,
+            // acos(x) = pi/2 - asin(x).
+            // The pi and pi/2 constants are split in two for extra precision.
+            const __m128d y2 = _mm_add_pd(y, y);
+            const __m128d big_result = select_pd(
+                _mm_cmplt_pd(s, _mm_setzero_pd()),
+                _mm_add_pd(
+                    _mm_sub_pd(_mm_set1_pd(3.14159265358979323846), y2),
+                    _mm_set1_pd(1.224646799147353177226e-16)),
+                y2);
+            const __m128d small_result = _mm_add_pd(
+                _mm_sub_pd(_mm_set1_pd(1.57079632679489661923),
+                           _mm_xor_pd(y, sign)),
+                _mm_set1_pd(6.123233995736765886130e-17));
+            return select_pd(big, big_result, small_result);
+        }
+
+        inline float64x2 atan_s(const float64x2& s) noexcept
+        {
+            // This function's implementation is based on Cephes' atan().
+            const __m128d sign_mask = _mm_set1_pd(-0.0);
+            const __m128d one = _mm_set1_pd(1.0);
+            const __m128d sign = _mm_and_pd(s, sign_mask);
+            const __m128d a = _mm_andnot_pd(sign_mask, s);
+
+            // Reduce the range to [-0.66, 0.66]
+            const __m128d big = _mm_cmpgt_pd(
+                a, _mm_set1_pd(2.41421356237309504880));
+            const __m128d mid = _mm_cmpgt_pd(a, _mm_set1_pd(0.66));
+            const __m128d num = select_pd(
+                big, _mm_set1_pd(-1.0), select_pd(mid, _mm_sub_pd(a, one), a));
+            const __m128d den = select_pd(
+                big, a, select_pd(mid, _mm_add_pd(a, one), one));
+            const __m128d y0 = select_pd(
+                big,
+                _mm_set1_pd(1.57079632679489661923),
+                _mm_and_pd(mid, _mm_set1_pd(0.78539816339744830962)));
+            const __m128d more_bits = select_pd(
+                big,
+                _mm_set1_pd(6.123233995736765886130e-17),
+                _mm_and_pd(mid, _mm_set1_pd(3.061616997868382943065e-17)));
+            const __m128d x = _mm_div_pd(num, den);
+            const __m128d z = _mm_mul_pd(x, x);
+
+            __m128d p = _mm_set1_pd(-8.750608600031904122785e-1);
+            p = _mm_add_pd(
+                _mm_mul_pd(p, z), _mm_set1_pd(-1.615753718733365076637e1));
+            p = _mm_add_pd(
+                _mm_mul_pd(p, z), _mm_set1_pd(-7.500855792314704667340e1));
+            p = _mm_add_pd(
+                _mm_mul_pd(p, z), _mm_set1_pd(-1.228866684490136173410e2));
+            p = _mm_add_pd(
+                _mm_mul_pd(p, z), _mm_set1_pd(-6.485021904942025371773e1));
+
+            __m128d q = _mm_add_pd(z, _mm_set1_pd(2.485846490142306297962e1));
+            q = _mm_add_pd(
+                _mm_mul_pd(q, z), _mm_set1_pd(1.650270098316988542046e2));
+            q = _mm_add_pd(
+                _mm_mul_pd(q, z), _mm_set1_pd(4.328810604912902668951e2));
+            q = _mm_add_pd(
+                _mm_mul_pd(q, z), _mm_set1_pd(4.853903996359136964868e2));
+            q = _mm_add_pd(
+                _mm_mul_pd(q, z), _mm_set1_pd(1.945506571482613964425e2));
+
+            const __m128d r = _mm_div_pd(_mm_mul_pd(z, p), q);
+            const __m128d y = _mm_add_pd(
+                y0, _mm_add_pd(_mm_add_pd(_mm_mul_pd(x, r), x), more_bits));
+            return _mm_xor_pd(y, sign);
+        }
+
+        inline float64x2 atan2_ss(
+            const float64x2& y, const float64x2& x) noexcept
+        {
+            const __m128d sign_mask = _mm_set1_pd(-0.0);
+            const __m128d ax = _mm_andnot_pd(sign_mask, x);
+            const __m128d ay = _mm_andnot_pd(sign_mask, y);
+
+            // Compute the angle in the first octant and then reflect it
+            const __m128d lo = _mm_min_pd(ax, ay);
+            const __m128d hi = _mm_max_pd(ax, ay);
+            // inf/inf is NAN, but atan2(+-inf, +-inf) is an odd multiple
+            // of pi/4, so use t = 1 there
+            const __m128d inf = _mm_set1_pd(
+                binary_double(0x7FF0000000000000ull));
+            const __m128d both_inf = _mm_and_pd(
+                _mm_cmpeq_pd(ax, inf), _mm_cmpeq_pd(ay, inf));
+            const __m128d t = select_pd(
+                both_inf,
+                _mm_set1_pd(1.0),
+                _mm_and_pd(
+                    _mm_div_pd(lo, hi),
+                    _mm_cmpneq_pd(hi, _mm_setzero_pd())));
+            __m128d a = atan_s(float64x2(t));
+            a = select_pd(
+                _mm_cmpgt_pd(ay, ax),
+                _mm_add_pd(
+                    _mm_sub_pd(_mm_set1_pd(1.57079632679489661923), a),
+                    _mm_set1_pd(6.123233995736765886130e-17)),
+                a);
+            const __m128d x_negative = _mm_castsi128_pd(_mm_shuffle_epi32(
+                _mm_srai_epi32(_mm_castpd_si128(x), 31),
+                _MM_SHUFFLE(3, 3, 1, 1)));
+            a = select_pd(
+                x_negative,
+                _mm_add_pd(
+                    _mm_sub_pd(_mm_set1_pd(3.14159265358979323846), a),
+                    _mm_set1_pd(1.224646799147353177226e-16)),
+                a);
+            a = _mm_xor_pd(a, _mm_and_pd(y, sign_mask));
+            return _mm_or_pd(a, _mm_cmpunord_pd(y, x));
+        }
+
         inline float64x2 exp_s(const float64x2& s) noexcept
         {
             // This function's implementation is based on Julien Pommier's
@@ -392,6 +844,9 @@ namespace tue
             fx = _mm_mul_pd(x, _mm_set1_pd(1.44269504088896341));
             fx = _mm_add_pd(fx, _mm_set1_pd(0.5));
 
+#ifdef TUE_SSE41
+            fx = _mm_floor_pd(fx);
+#else
             /* how to perform a floorf with SSE: just below */
             emm0 = _mm_cvttpd_epi32(fx);
             tmp = _mm_cvtepi32_pd(emm0);
@@ -400,6 +855,7 @@ namespace tue
             __m128d mask = _mm_cmpgt_pd(tmp, fx);
             mask = _mm_and_pd(mask, one);
             fx = _mm_sub_pd(tmp, mask);
+#endif
 
             tmp = _mm_mul_pd(fx, _mm_set1_pd(0.693359375));
             __m128d z = _mm_mul_pd(fx, _mm_set1_pd(-2.12194440e-4));
@@ -510,6 +966,121 @@ namespace tue
             return x;
         }
 
+        inline float64x2 exp2_s(const float64x2& s) noexcept
+        {
+            // This function's implementation is based on Cephes' exp2().
+            // 2^x is split into 2^n * 2^f with n = round(x) and |f| <= 0.5.
+            // The constant comes first in min and max so NaN passes
+            // through.
+            __m128d x = s;
+            x = _mm_min_pd(_mm_set1_pd(1025.0), x);
+            x = _mm_max_pd(_mm_set1_pd(-1075.0), x);
+
+            const __m128i n = _mm_cvtpd_epi32(x);
+            x = _mm_sub_pd(x, _mm_cvtepi32_pd(n));
+
+            const __m128d xx = _mm_mul_pd(x, x);
+
+            __m128d px = _mm_set1_pd(2.30933477057345225087e-2);
+            px = _mm_mul_pd(px, xx);
+            px = _mm_add_pd(px, _mm_set1_pd(2.02020656693165307700e1));
+            px = _mm_mul_pd(px, xx);
+            px = _mm_add_pd(px, _mm_set1_pd(1.51390680115615096133e3));
+            px = _mm_mul_pd(px, x);
+
+            __m128d qx = _mm_add_pd(
+                xx, _mm_set1_pd(2.33184211722314911771e2));
+            qx = _mm_mul_pd(qx, xx);
+            qx = _mm_add_pd(qx, _mm_set1_pd(4.36821166879210612817e3));
+
+            x = _mm_div_pd(px, _mm_sub_pd(qx, px));
+            __m128d y = _mm_add_pd(_mm_set1_pd(1.0), _mm_add_pd(x, x));
+
+            // 2^n is applied in two halves so that neither overflows the
+            // exponent field when the result is infinite or subnormal.
+            const __m128i n1 = _mm_srai_epi32(n, 1);
+            const __m128i n2 = _mm_sub_epi32(n, n1);
+            const __m128i bias = _mm_set1_epi32(0x3FF);
+            const __m128i zero = _mm_setzero_si128();
+            y = _mm_mul_pd(y, _mm_castsi128_pd(_mm_slli_epi64(
+                _mm_unpacklo_epi32(_mm_add_epi32(n1, bias), zero), 52)));
+            y = _mm_mul_pd(y, _mm_castsi128_pd(_mm_slli_epi64(
+                _mm_unpacklo_epi32(_mm_add_epi32(n2, bias), zero), 52)));
+            return y;
+        }
+
+        inline float64x2 log2_s(const float64x2& s) noexcept
+        {
+            // This function's implementation is based on Cephes' log2().
+            // Unlike log_s(), it uses the full double precision rational
+            // approximation of log(1 + x).
+            __m128d x = s;
+
+            const __m128d one = _mm_set1_pd(1.0);
+            const __m128d zero = _mm_setzero_pd();
+            const __m128d invalid_mask = _mm_cmpnge_pd(x, zero);
+            const __m128d zero_mask = _mm_cmpeq_pd(x, zero);
+            const __m128d inf = _mm_set1_pd(binary_double(0x7FFull << 52ull));
+            const __m128d inf_mask = _mm_cmpeq_pd(x, inf);
+
+            /* cut off denormalized stuff */
+            x = _mm_max_pd(x, _mm_set1_pd(binary_double(1ull << 52ull)));
+
+            /* x = frexp(x, &e); */
+            __m128i emm0 = _mm_srli_epi64(_mm_castpd_si128(x), 52);
+            emm0 = _mm_shuffle_epi32(emm0, _MM_SHUFFLE(3, 1, 2, 0));
+            emm0 = _mm_sub_epi32(emm0, _mm_set1_epi32(0x3FE));
+            __m128d e = _mm_cvtepi32_pd(emm0);
+            x = _mm_and_pd(x, _mm_set1_pd(binary_double(~(0x7FFull << 52))));
+            x = _mm_or_pd(x, _mm_set1_pd(0.5));
+
+            /* if (x < SQRTH) { e -= 1; x = x + x - 1; } else { x -= 1; } */
+            const __m128d mask = _mm_cmplt_pd(
+                x, _mm_set1_pd(0.70710678118654752440));
+            const __m128d tmp = _mm_and_pd(x, mask);
+            x = _mm_sub_pd(x, one);
+            e = _mm_sub_pd(e, _mm_and_pd(one, mask));
+            x = _mm_add_pd(x, tmp);
+
+            const __m128d z = _mm_mul_pd(x, x);
+
+            __m128d px = _mm_set1_pd(1.01875663804580931796e-4);
+            px = _mm_mul_pd(px, x);
+            px = _mm_add_pd(px, _mm_set1_pd(4.97494994976747001425e-1));
+            px = _mm_mul_pd(px, x);
+            px = _mm_add_pd(px, _mm_set1_pd(4.70579119878881725854e0));
+            px = _mm_mul_pd(px, x);
+            px = _mm_add_pd(px, _mm_set1_pd(1.44989225341610930846e1));
+            px = _mm_mul_pd(px, x);
+            px = _mm_add_pd(px, _mm_set1_pd(1.79368678507819816313e1));
+            px = _mm_mul_pd(px, x);
+            px = _mm_add_pd(px, _mm_set1_pd(7.70838733755885391666e0));
+
+            __m128d qx = _mm_add_pd(x, _mm_set1_pd(1.12873587189167450590e1));
+            qx = _mm_mul_pd(qx, x);
+            qx = _mm_add_pd(qx, _mm_set1_pd(4.52279145837532221105e1));
+            qx = _mm_mul_pd(qx, x);
+            qx = _mm_add_pd(qx, _mm_set1_pd(8.29875266912776603211e1));
+            qx = _mm_mul_pd(qx, x);
+            qx = _mm_add_pd(qx, _mm_set1_pd(7.11544750618563894466e1));
+            qx = _mm_mul_pd(qx, x);
+            qx = _mm_add_pd(qx, _mm_set1_pd(2.31251620126765340583e1));
+
+            __m128d y = _mm_mul_pd(x, _mm_div_pd(_mm_mul_pd(z, px), qx));
+            y = _mm_sub_pd(y, _mm_mul_pd(z, _mm_set1_pd(0.5)));
+
+            /* y * log2(e) + x * log2(e) + y + x + e, with log2(e) - 1 */
+            const __m128d log2ea = _mm_set1_pd(0.44269504088896340735992);
+            __m128d r = _mm_mul_pd(y, log2ea);
+            r = _mm_add_pd(r, _mm_mul_pd(x, log2ea));
+            r = _mm_add_pd(r, y);
+            r = _mm_add_pd(r, x);
+            r = _mm_add_pd(r, e);
+            r = select_pd(inf_mask, inf, r);
+            r = select_pd(zero_mask, _mm_sub_pd(zero, inf), r);
+            return _mm_or_pd(r, invalid_mask); // negative arg will be NAN
+        }
+
         inline float64x2 abs_s(const float64x2& s) noexcept
         {
             return _mm_and_pd(
@@ -522,21 +1093,41 @@ namespace tue
             return exp_s(float64x2(_mm_mul_pd(log_s(bases), exponents)));
         }
 
+        inline float64x2 recip_fast_s(const float64x2& s) noexcept
+        {
+            return _mm_div_pd(_mm_set1_pd(1.0), s);
+        }
+
         inline float64x2 recip_s(const float64x2& s) noexcept
         {
             return _mm_div_pd(_mm_set1_pd(1.0), s);
         }
 
+        inline float64x2 recip_exact_s(const float64x2& s) noexcept
+        {
+            return _mm_div_pd(_mm_set1_pd(1.0), s);
+        }
+
         inline float64x2 sqrt_s(const float64x2& s) noexcept
         {
             return _mm_sqrt_pd(s);
         }
 
+        inline float64x2 rsqrt_fast_s(const float64x2& s) noexcept
+        {
+            return _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(s));
+        }
+
         inline float64x2 rsqrt_s(const float64x2& s) noexcept
         {
             return _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(s));
         }
 
+        inline float64x2 rsqrt_exact_s(const float64x2& s) noexcept
+        {
+            return _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(s));
+        }
+
         inline float64x2 min_ss(
             const float64x2& s1, const float64x2& s2) noexcept
         {
@@ -561,9 +1152,13 @@ namespace tue
             const float64x2& values,
             const float64x2& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_pd(otherwise, values, conditions);
+#else
             return _mm_or_pd(
                 _mm_and_pd(conditions, values),
                 _mm_andnot_pd(conditions, otherwise));
+#endif
         }
 
         inline bool64x2 less_ss(
@@ -601,5 +1196,43 @@ namespace tue
         {
             return _mm_cmpneq_pd(lhs, rhs);
         }
+
+        inline double hsum_s(const float64x2& s) noexcept
+        {
+            return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+        }
+
+        inline double hprod_s(const float64x2& s) noexcept
+        {
+            return _mm_cvtsd_f64(_mm_mul_sd(s, _mm_unpackhi_pd(s, s)));
+        }
+
+        inline double hmin_s(const float64x2& s) noexcept
+        {
+            return _mm_cvtsd_f64(_mm_min_sd(s, _mm_unpackhi_pd(s, s)));
+        }
+
+        inline double hmax_s(const float64x2& s) noexcept
+        {
+            return _mm_cvtsd_f64(_mm_max_sd(s, _mm_unpackhi_pd(s, s)));
+        }
+
+        template<int I0, int I1>
+        inline float64x2 shuffle_s(const float64x2& s) noexcept
+        {
+            return _mm_shuffle_pd(s, s, _MM_SHUFFLE2(I1, I0));
+        }
+
+        inline float64x2 unpack_lo_ss(
+            const float64x2& s1, const float64x2& s2) noexcept
+        {
+            return _mm_unpacklo_pd(s1, s2);
+        }
+
+        inline float64x2 unpack_hi_ss(
+            const float64x2& s1, const float64x2& s2) noexcept
+        {
+            return _mm_unpackhi_pd(s1, s2);
+        }
     }
 }
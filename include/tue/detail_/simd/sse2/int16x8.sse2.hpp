@@ -10,7 +10,16 @@
 
 #include <emmintrin.h>
 
+#ifdef TUE_SSSE3
+#include <tmmintrin.h>
+#endif
+
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
 #include <cstdint>
+#include <memory>
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -122,6 +131,33 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        static int16x8 gather(
+            const std::int16_t* base, const int32x8& indices) noexcept
+        {
+            return tue::detail_::gather_s<std::int16_t, 8>(base, indices);
+        }
+
+        static int16x8 gather(
+            const std::int16_t* base,
+            const int32x8& indices,
+            const bool16x8& conditions) noexcept
+        {
+            return tue::detail_::gather_s<std::int16_t, 8>(
+                base, indices, conditions);
+        }
+
+        static int16x8 load_partial(
+            const std::int16_t* data, int count) noexcept
+        {
+            return tue::detail_::load_partial_s<std::int16_t, 8>(data, count);
+        }
+
+        static int16x8 maskload(
+            const std::int16_t* data, const bool16x8& conditions) noexcept
+        {
+            return tue::detail_::maskload_s<std::int16_t, 8>(data, conditions);
+        }
+
         void store(std::int16_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -132,6 +168,36 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void store_stream(std::int16_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        void scatter(std::int16_t* base, const int32x8& indices) const noexcept
+        {
+            tue::detail_::scatter_s<8>(this->data(), base, indices);
+        }
+
+        void scatter(
+            std::int16_t* base,
+            const int32x8& indices,
+            const bool16x8& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<8>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(std::int16_t* data, int count) const noexcept
+        {
+            tue::detail_::store_partial_s<8>(this->data(), data, count);
+        }
+
+        void maskstore(
+            std::int16_t* data, const bool16x8& conditions) const noexcept
+        {
+            tue::detail_::maskstore_s<8>(this->data(), data, conditions);
+        }
+
         const std::int16_t* data() const noexcept
         {
             return reinterpret_cast<const std::int16_t*>(&underlying_);
@@ -212,23 +278,38 @@ namespace tue
             return _mm_sub_epi16(lhs, rhs);
         }
 
-        /*inline int16x8 multiplication_operator_ss(
+        inline int16x8 multiplication_operator_ss(
             const int16x8& lhs, const int16x8& rhs) noexcept
         {
-            // TODO
+            return _mm_mullo_epi16(lhs, rhs);
         }
 
         inline int16x8 division_operator_ss(
             const int16x8& lhs, const int16x8& rhs) noexcept
         {
-            // TODO
+            const auto lhs_lo = _mm_srai_epi32(
+                _mm_unpacklo_epi16(lhs, lhs), 16);
+            const auto lhs_hi = _mm_srai_epi32(
+                _mm_unpackhi_epi16(lhs, lhs), 16);
+            const auto rhs_lo = _mm_srai_epi32(
+                _mm_unpacklo_epi16(rhs, rhs), 16);
+            const auto rhs_hi = _mm_srai_epi32(
+                _mm_unpackhi_epi16(rhs, rhs), 16);
+            const auto lo = _mm_cvttps_epi32(_mm_div_ps(
+                _mm_cvtepi32_ps(lhs_lo), _mm_cvtepi32_ps(rhs_lo)));
+            const auto hi = _mm_cvttps_epi32(_mm_div_ps(
+                _mm_cvtepi32_ps(lhs_hi), _mm_cvtepi32_ps(rhs_hi)));
+            return _mm_packs_epi32(
+                _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16),
+                _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
         }
 
         inline int16x8 modulo_operator_ss(
             const int16x8& lhs, const int16x8& rhs) noexcept
         {
-            // TODO
-        }*/
+            return subtraction_operator_ss(lhs, multiplication_operator_ss(
+                division_operator_ss(lhs, rhs), rhs));
+        }
 
         inline int16x8 bitwise_and_operator_ss(
             const int16x8& lhs, const int16x8& rhs) noexcept
@@ -257,7 +338,7 @@ namespace tue
         inline int16x8 bitwise_shift_right_operator_si(
             const int16x8& lhs, int rhs) noexcept
         {
-            return _mm_srli_epi16(lhs, rhs);
+            return _mm_srai_epi16(lhs, rhs);
         }
 
         inline int16x8& addition_assignment_operator_ss(
@@ -272,23 +353,23 @@ namespace tue
             return lhs = _mm_sub_epi16(lhs, rhs);
         }
 
-        /*inline int16x8& multiplication_assignment_operator_ss(
+        inline int16x8& multiplication_assignment_operator_ss(
             int16x8& lhs, const int16x8& rhs) noexcept
         {
-            // TODO
+            return lhs = multiplication_operator_ss(lhs, rhs);
         }
 
         inline int16x8& division_assignment_operator_ss(
             int16x8& lhs, const int16x8& rhs) noexcept
         {
-            // TODO
+            return lhs = division_operator_ss(lhs, rhs);
         }
 
         inline int16x8& modulo_assignment_operator_ss(
             int16x8& lhs, const int16x8& rhs) noexcept
         {
-            // TODO
-        }*/
+            return lhs = modulo_operator_ss(lhs, rhs);
+        }
 
         inline int16x8& bitwise_and_assignment_operator_ss(
             int16x8& lhs, const int16x8& rhs) noexcept
@@ -317,7 +398,7 @@ namespace tue
         inline int16x8& bitwise_shift_right_assignment_operator_si(
             int16x8& lhs, int rhs) noexcept
         {
-            return lhs = _mm_srli_epi16(lhs, rhs);
+            return lhs = _mm_srai_epi16(lhs, rhs);
         }
 
         inline bool equality_operator_ss(
@@ -334,10 +415,14 @@ namespace tue
 
         inline int16x8 abs_s(const int16x8& s) noexcept
         {
+#ifdef TUE_SSSE3
+            return _mm_abs_epi16(s);
+#else
             const auto nmask = _mm_cmplt_epi16(s, _mm_setzero_si128());
             return _mm_or_si128(
                 _mm_and_si128(nmask, unary_minus_operator_s(s)),
                 _mm_andnot_si128(nmask, s));
+#endif
         }
 
         inline int16x8 min_ss(
@@ -364,9 +449,13 @@ namespace tue
             const int16x8& values,
             const int16x8& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         inline bool16x8 less_ss(
@@ -404,5 +493,75 @@ namespace tue
         {
             return _mm_xor_si128(_mm_cmpeq_epi16(lhs, rhs), int16x8(0xFFFFu));
         }
+
+        inline std::int16_t hsum_s(const int16x8& s) noexcept
+        {
+            int16x8 t = s;
+            t = tue::detail_::addition_operator_ss(
+                t, int16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::addition_operator_ss(
+                t, int16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            t = tue::detail_::addition_operator_ss(
+                t, int16x8(_mm_srli_epi32(t, 16)));
+            return t.data()[0];
+        }
+
+        inline std::int16_t hprod_s(const int16x8& s) noexcept
+        {
+            int16x8 t = s;
+            t = tue::detail_::multiplication_operator_ss(
+                t, int16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::multiplication_operator_ss(
+                t, int16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            t = tue::detail_::multiplication_operator_ss(
+                t, int16x8(_mm_srli_epi32(t, 16)));
+            return t.data()[0];
+        }
+
+        inline std::int16_t hmin_s(const int16x8& s) noexcept
+        {
+            int16x8 t = s;
+            t = tue::detail_::min_ss(
+                t, int16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::min_ss(
+                t, int16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            t = tue::detail_::min_ss(
+                t, int16x8(_mm_srli_epi32(t, 16)));
+            return t.data()[0];
+        }
+
+        inline std::int16_t hmax_s(const int16x8& s) noexcept
+        {
+            int16x8 t = s;
+            t = tue::detail_::max_ss(
+                t, int16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::max_ss(
+                t, int16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            t = tue::detail_::max_ss(
+                t, int16x8(_mm_srli_epi32(t, 16)));
+            return t.data()[0];
+        }
+
+#ifdef TUE_SSSE3
+        template<int... I>
+        inline int16x8 shuffle_s(const int16x8& s) noexcept
+        {
+            // Each 16-bit index selects its component's two bytes.
+            return _mm_shuffle_epi8(s, _mm_setr_epi16(
+                static_cast<short>(I*2 | (I*2 + 1) << 8)...));
+        }
+#endif
+
+        inline int16x8 unpack_lo_ss(
+            const int16x8& s1, const int16x8& s2) noexcept
+        {
+            return _mm_unpacklo_epi16(s1, s2);
+        }
+
+        inline int16x8 unpack_hi_ss(
+            const int16x8& s1, const int16x8& s2) noexcept
+        {
+            return _mm_unpackhi_epi16(s1, s2);
+        }
     }
 }
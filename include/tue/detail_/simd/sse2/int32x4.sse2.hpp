@@ -10,7 +10,20 @@
 
 #include <emmintrin.h>
 
+#ifdef TUE_SSSE3
+#include <tmmintrin.h>
+#endif
+
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 #include <cstdint>
+#include <memory>
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -119,6 +132,64 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        static int32x4 gather(
+            const std::int32_t* base, const int32x4& indices) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = reinterpret_cast<const __m128i&>(indices);
+            return _mm_i32gather_epi32(
+                reinterpret_cast<const int*>(base), vindex, 4);
+#else
+            return tue::detail_::gather_s<std::int32_t, 4>(base, indices);
+#endif
+        }
+
+        static int32x4 gather(
+            const std::int32_t* base,
+            const int32x4& indices,
+            const bool32x4& conditions) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = reinterpret_cast<const __m128i&>(indices);
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            return _mm_mask_i32gather_epi32(
+                _mm_setzero_si128(),
+                reinterpret_cast<const int*>(base),
+                vindex,
+                vmask,
+                4);
+#else
+            return tue::detail_::gather_s<std::int32_t, 4>(
+                base, indices, conditions);
+#endif
+        }
+
+        static int32x4 load_partial(
+            const std::int32_t* data, int count) noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool32, 4>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            return _mm_castps_si128(
+                _mm_maskload_ps(reinterpret_cast<const float*>(data), vmask));
+#else
+            return tue::detail_::load_partial_s<std::int32_t, 4>(data, count);
+#endif
+        }
+
+        static int32x4 maskload(
+            const std::int32_t* data, const bool32x4& conditions) noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            return _mm_castps_si128(
+                _mm_maskload_ps(reinterpret_cast<const float*>(data), vmask));
+#else
+            return tue::detail_::maskload_s<std::int32_t, 4>(data, conditions);
+#endif
+        }
+
         void store(std::int32_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -129,6 +200,54 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void store_stream(std::int32_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        void scatter(std::int32_t* base, const int32x4& indices) const noexcept
+        {
+            tue::detail_::scatter_s<4>(this->data(), base, indices);
+        }
+
+        void scatter(
+            std::int32_t* base,
+            const int32x4& indices,
+            const bool32x4& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<4>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(std::int32_t* data, int count) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool32, 4>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            _mm_maskstore_ps(
+                reinterpret_cast<float*>(data),
+                vmask,
+                _mm_castsi128_ps(underlying_));
+#else
+            tue::detail_::store_partial_s<4>(this->data(), data, count);
+#endif
+        }
+
+        void maskstore(
+            std::int32_t* data, const bool32x4& conditions) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            _mm_maskstore_ps(
+                reinterpret_cast<float*>(data),
+                vmask,
+                _mm_castsi128_ps(underlying_));
+#else
+            tue::detail_::maskstore_s<4>(this->data(), data, conditions);
+#endif
+        }
+
         const std::int32_t* data() const noexcept
         {
             return reinterpret_cast<const std::int32_t*>(&underlying_);
@@ -215,23 +334,38 @@ namespace tue
             return _mm_sub_epi32(lhs, rhs);
         }
 
-        /*inline int32x4 multiplication_operator_ss(
+        inline int32x4 multiplication_operator_ss(
             const int32x4& lhs, const int32x4& rhs) noexcept
         {
-            // TODO
+#ifdef TUE_SSE41
+            return _mm_mullo_epi32(lhs, rhs);
+#else
+            const auto even = _mm_mul_epu32(lhs, rhs);
+            const auto odd = _mm_mul_epu32(
+                _mm_srli_epi64(lhs, 32), _mm_srli_epi64(rhs, 32));
+            return _mm_unpacklo_epi32(
+                _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
         }
 
         inline int32x4 division_operator_ss(
             const int32x4& lhs, const int32x4& rhs) noexcept
         {
-            // TODO
+            const auto lo = _mm_cvttpd_epi32(_mm_div_pd(
+                _mm_cvtepi32_pd(lhs), _mm_cvtepi32_pd(rhs)));
+            const auto hi = _mm_cvttpd_epi32(_mm_div_pd(
+                _mm_cvtepi32_pd(_mm_unpackhi_epi64(lhs, lhs)),
+                _mm_cvtepi32_pd(_mm_unpackhi_epi64(rhs, rhs))));
+            return _mm_unpacklo_epi64(lo, hi);
         }
 
         inline int32x4 modulo_operator_ss(
             const int32x4& lhs, const int32x4& rhs) noexcept
         {
-            // TODO
-        }*/
+            return subtraction_operator_ss(lhs, multiplication_operator_ss(
+                division_operator_ss(lhs, rhs), rhs));
+        }
 
         inline int32x4 bitwise_and_operator_ss(
             const int32x4& lhs, const int32x4& rhs) noexcept
@@ -260,7 +394,7 @@ namespace tue
         inline int32x4 bitwise_shift_right_operator_si(
             const int32x4& lhs, int rhs) noexcept
         {
-            return _mm_srli_epi32(lhs, rhs);
+            return _mm_srai_epi32(lhs, rhs);
         }
 
         inline int32x4& addition_assignment_operator_ss(
@@ -275,23 +409,23 @@ namespace tue
             return lhs = _mm_sub_epi32(lhs, rhs);
         }
 
-        /*inline int32x4& multiplication_assignment_operator_ss(
+        inline int32x4& multiplication_assignment_operator_ss(
             int32x4& lhs, const int32x4& rhs) noexcept
         {
-            // TODO
+            return lhs = multiplication_operator_ss(lhs, rhs);
         }
 
         inline int32x4& division_assignment_operator_ss(
             int32x4& lhs, const int32x4& rhs) noexcept
         {
-            // TODO
+            return lhs = division_operator_ss(lhs, rhs);
         }
 
         inline int32x4& modulo_assignment_operator_ss(
             int32x4& lhs, const int32x4& rhs) noexcept
         {
-            // TODO
-        }*/
+            return lhs = modulo_operator_ss(lhs, rhs);
+        }
 
         inline int32x4& bitwise_and_assignment_operator_ss(
             int32x4& lhs, const int32x4& rhs) noexcept
@@ -320,7 +454,7 @@ namespace tue
         inline int32x4& bitwise_shift_right_assignment_operator_si(
             int32x4& lhs, int rhs) noexcept
         {
-            return lhs = _mm_srli_epi32(lhs, rhs);
+            return lhs = _mm_srai_epi32(lhs, rhs);
         }
 
         inline bool equality_operator_ss(
@@ -337,23 +471,39 @@ namespace tue
 
         inline int32x4 abs_s(const int32x4& s) noexcept
         {
+#ifdef TUE_SSSE3
+            return _mm_abs_epi32(s);
+#else
             const auto nmask = _mm_cmplt_epi32(s, _mm_setzero_si128());
             return _mm_or_si128(
                 _mm_and_si128(nmask, unary_minus_operator_s(s)),
                 _mm_andnot_si128(nmask, s));
+#endif
         }
 
-        /*inline int32x4 min_ss(
+        inline int32x4 min_ss(
             const int32x4& s1, const int32x4& s2) noexcept
         {
-            // TODO
+#ifdef TUE_SSE41
+            return _mm_min_epi32(s1, s2);
+#else
+            const auto mask = _mm_cmplt_epi32(s1, s2);
+            return _mm_or_si128(
+                _mm_and_si128(mask, s1), _mm_andnot_si128(mask, s2));
+#endif
         }
 
         inline int32x4 max_ss(
             const int32x4& s1, const int32x4& s2) noexcept
         {
-            // TODO
-        }*/
+#ifdef TUE_SSE41
+            return _mm_max_epi32(s1, s2);
+#else
+            const auto mask = _mm_cmpgt_epi32(s1, s2);
+            return _mm_or_si128(
+                _mm_and_si128(mask, s1), _mm_andnot_si128(mask, s2));
+#endif
+        }
 
         inline int32x4 mask_ss(
             const bool32x4& conditions,
@@ -367,9 +517,13 @@ namespace tue
             const int32x4& values,
             const int32x4& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         inline bool32x4 less_ss(
@@ -410,5 +564,63 @@ namespace tue
             return _mm_xor_si128(
                 _mm_cmpeq_epi32(lhs, rhs), int32x4(0xFFFFFFFF));
         }
+
+        inline std::int32_t hsum_s(const int32x4& s) noexcept
+        {
+            int32x4 t = s;
+            t = tue::detail_::addition_operator_ss(
+                t, int32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::addition_operator_ss(
+                t, int32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            return t.data()[0];
+        }
+
+        inline std::int32_t hprod_s(const int32x4& s) noexcept
+        {
+            int32x4 t = s;
+            t = tue::detail_::multiplication_operator_ss(
+                t, int32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::multiplication_operator_ss(
+                t, int32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            return t.data()[0];
+        }
+
+        inline std::int32_t hmin_s(const int32x4& s) noexcept
+        {
+            int32x4 t = s;
+            t = tue::detail_::min_ss(
+                t, int32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::min_ss(
+                t, int32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            return t.data()[0];
+        }
+
+        inline std::int32_t hmax_s(const int32x4& s) noexcept
+        {
+            int32x4 t = s;
+            t = tue::detail_::max_ss(
+                t, int32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::max_ss(
+                t, int32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            return t.data()[0];
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline int32x4 shuffle_s(const int32x4& s) noexcept
+        {
+            return _mm_shuffle_epi32(s, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+
+        inline int32x4 unpack_lo_ss(
+            const int32x4& s1, const int32x4& s2) noexcept
+        {
+            return _mm_unpacklo_epi32(s1, s2);
+        }
+
+        inline int32x4 unpack_hi_ss(
+            const int32x4& s1, const int32x4& s2) noexcept
+        {
+            return _mm_unpackhi_epi32(s1, s2);
+        }
     }
 }
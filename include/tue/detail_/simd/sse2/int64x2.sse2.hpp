@@ -10,7 +10,16 @@
 
 #include <emmintrin.h>
 
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 #include <cstdint>
+#include <memory>
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -115,6 +124,66 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        static int64x2 gather(
+            const std::int64_t* base, const int32x2& indices) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = _mm_loadl_epi64(
+                reinterpret_cast<const __m128i*>(std::addressof(indices)));
+            return _mm_i32gather_epi64(
+                reinterpret_cast<const long long*>(base), vindex, 8);
+#else
+            return tue::detail_::gather_s<std::int64_t, 2>(base, indices);
+#endif
+        }
+
+        static int64x2 gather(
+            const std::int64_t* base,
+            const int32x2& indices,
+            const bool64x2& conditions) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = _mm_loadl_epi64(
+                reinterpret_cast<const __m128i*>(std::addressof(indices)));
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            return _mm_mask_i32gather_epi64(
+                _mm_setzero_si128(),
+                reinterpret_cast<const long long*>(base),
+                vindex,
+                vmask,
+                8);
+#else
+            return tue::detail_::gather_s<std::int64_t, 2>(
+                base, indices, conditions);
+#endif
+        }
+
+        static int64x2 load_partial(
+            const std::int64_t* data, int count) noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool64, 2>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            return _mm_castpd_si128(
+                _mm_maskload_pd(reinterpret_cast<const double*>(data), vmask));
+#else
+            return tue::detail_::load_partial_s<std::int64_t, 2>(data, count);
+#endif
+        }
+
+        static int64x2 maskload(
+            const std::int64_t* data, const bool64x2& conditions) noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            return _mm_castpd_si128(
+                _mm_maskload_pd(reinterpret_cast<const double*>(data), vmask));
+#else
+            return tue::detail_::maskload_s<std::int64_t, 2>(data, conditions);
+#endif
+        }
+
         void store(std::int64_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -125,6 +194,54 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void store_stream(std::int64_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        void scatter(std::int64_t* base, const int32x2& indices) const noexcept
+        {
+            tue::detail_::scatter_s<2>(this->data(), base, indices);
+        }
+
+        void scatter(
+            std::int64_t* base,
+            const int32x2& indices,
+            const bool64x2& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<2>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(std::int64_t* data, int count) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool64, 2>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            _mm_maskstore_pd(
+                reinterpret_cast<double*>(data),
+                vmask,
+                _mm_castsi128_pd(underlying_));
+#else
+            tue::detail_::store_partial_s<2>(this->data(), data, count);
+#endif
+        }
+
+        void maskstore(
+            std::int64_t* data, const bool64x2& conditions) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            _mm_maskstore_pd(
+                reinterpret_cast<double*>(data),
+                vmask,
+                _mm_castsi128_pd(underlying_));
+#else
+            tue::detail_::maskstore_s<2>(this->data(), data, conditions);
+#endif
+        }
+
         const std::int64_t* data() const noexcept
         {
             return reinterpret_cast<const std::int64_t*>(&underlying_);
@@ -205,13 +322,17 @@ namespace tue
             return _mm_sub_epi64(lhs, rhs);
         }
 
-        /*inline int64x2 multiplication_operator_ss(
+        inline int64x2 multiplication_operator_ss(
             const int64x2& lhs, const int64x2& rhs) noexcept
         {
-            // TODO
+            const auto lo = _mm_mul_epu32(lhs, rhs);
+            const auto hi = _mm_add_epi64(
+                _mm_mul_epu32(_mm_srli_epi64(lhs, 32), rhs),
+                _mm_mul_epu32(lhs, _mm_srli_epi64(rhs, 32)));
+            return _mm_add_epi64(lo, _mm_slli_epi64(hi, 32));
         }
 
-        inline int64x2 division_operator_ss(
+        /*inline int64x2 division_operator_ss(
             const int64x2& lhs, const int64x2& rhs) noexcept
         {
             // TODO
@@ -250,7 +371,11 @@ namespace tue
         inline int64x2 bitwise_shift_right_operator_si(
             const int64x2& lhs, int rhs) noexcept
         {
-            return _mm_srli_epi64(lhs, rhs);
+            const auto sign = _mm_shuffle_epi32(
+                _mm_srai_epi32(lhs, 31), _MM_SHUFFLE(3, 3, 1, 1));
+            return _mm_or_si128(
+                _mm_srli_epi64(lhs, rhs),
+                _mm_slli_epi64(sign, 64 - rhs));
         }
 
         inline int64x2& addition_assignment_operator_ss(
@@ -265,13 +390,13 @@ namespace tue
             return lhs = _mm_sub_epi64(lhs, rhs);
         }
 
-        /*inline int64x2& multiplication_assignment_operator_ss(
+        inline int64x2& multiplication_assignment_operator_ss(
             int64x2& lhs, const int64x2& rhs) noexcept
         {
-            // TODO
+            return lhs = multiplication_operator_ss(lhs, rhs);
         }
 
-        inline int64x2& division_assignment_operator_ss(
+        /*inline int64x2& division_assignment_operator_ss(
             int64x2& lhs, const int64x2& rhs) noexcept
         {
             // TODO
@@ -310,7 +435,7 @@ namespace tue
         inline int64x2& bitwise_shift_right_assignment_operator_si(
             int64x2& lhs, int rhs) noexcept
         {
-            return lhs = _mm_srli_epi64(lhs, rhs);
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
         }
 
         inline bool equality_operator_ss(
@@ -335,18 +460,6 @@ namespace tue
                 _mm_andnot_si128(nmask, s));
         }
 
-        /*inline int64x2 min_ss(
-            const int64x2& s1, const int64x2& s2) noexcept
-        {
-            // TODO
-        }
-
-        inline int64x2 max_ss(
-            const int64x2& s1, const int64x2& s2) noexcept
-        {
-            // TODO
-        }*/
-
         inline int64x2 mask_ss(
             const bool64x2& conditions,
             const int64x2& values) noexcept
@@ -359,42 +472,59 @@ namespace tue
             const int64x2& values,
             const int64x2& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
-        /*inline bool64x2 less_ss(
+        inline bool64x2 less_ss(
             const int64x2& lhs, const int64x2& rhs) noexcept
         {
-            // TODO
+            // Compare the high halves as signed and the low halves as
+            // unsigned, then use the low result where the high halves
+            // are equal
+            const auto bias = _mm_set1_epi64x(0x80000000);
+            const auto gt = _mm_cmpgt_epi32(
+                _mm_xor_si128(rhs, bias), _mm_xor_si128(lhs, bias));
+            const auto eq = _mm_cmpeq_epi32(lhs, rhs);
+            const auto result = _mm_or_si128(gt, _mm_and_si128(
+                eq, _mm_shuffle_epi32(gt, _MM_SHUFFLE(2, 2, 0, 0))));
+            return _mm_shuffle_epi32(result, _MM_SHUFFLE(3, 3, 1, 1));
         }
 
         inline bool64x2 less_equal_ss(
             const int64x2& lhs, const int64x2& rhs) noexcept
         {
-            // TODO
+            return _mm_xor_si128(less_ss(rhs, lhs), int64x2(~0ull));
         }
 
         inline bool64x2 greater_ss(
             const int64x2& lhs, const int64x2& rhs) noexcept
         {
-            // TODO
+            return less_ss(rhs, lhs);
         }
 
         inline bool64x2 greater_equal_ss(
             const int64x2& lhs, const int64x2& rhs) noexcept
         {
-            // TODO
-        }*/
+            return _mm_xor_si128(less_ss(lhs, rhs), int64x2(~0ull));
+        }
 
         inline bool64x2 equal_ss(
             const int64x2& lhs, const int64x2& rhs) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_cmpeq_epi64(lhs, rhs);
+#else
             const auto cmp = _mm_cmpeq_epi32(lhs, rhs);
             const auto hi = _mm_shuffle_epi32(cmp, _MM_SHUFFLE(3, 3, 1, 1));
             const auto lo = _mm_shuffle_epi32(cmp, _MM_SHUFFLE(2, 2, 0, 0));
             return _mm_and_si128(hi, lo);
+#endif
         }
 
         inline bool64x2 not_equal_ss(
@@ -402,5 +532,68 @@ namespace tue
         {
             return _mm_xor_si128(equal_ss(lhs, rhs), int64x2(~0ull));
         }
+
+        inline int64x2 min_ss(
+            const int64x2& s1, const int64x2& s2) noexcept
+        {
+            return select_sss(less_ss(s1, s2), s1, s2);
+        }
+
+        inline int64x2 max_ss(
+            const int64x2& s1, const int64x2& s2) noexcept
+        {
+            return select_sss(greater_ss(s1, s2), s1, s2);
+        }
+
+        inline std::int64_t hsum_s(const int64x2& s) noexcept
+        {
+            int64x2 t = s;
+            t = tue::detail_::addition_operator_ss(
+                t, int64x2(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            return t.data()[0];
+        }
+
+        inline std::int64_t hprod_s(const int64x2& s) noexcept
+        {
+            int64x2 t = s;
+            t = tue::detail_::multiplication_operator_ss(
+                t, int64x2(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            return t.data()[0];
+        }
+
+        inline std::int64_t hmin_s(const int64x2& s) noexcept
+        {
+            int64x2 t = s;
+            t = tue::detail_::min_ss(
+                t, int64x2(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            return t.data()[0];
+        }
+
+        inline std::int64_t hmax_s(const int64x2& s) noexcept
+        {
+            int64x2 t = s;
+            t = tue::detail_::max_ss(
+                t, int64x2(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            return t.data()[0];
+        }
+
+        template<int I0, int I1>
+        inline int64x2 shuffle_s(const int64x2& s) noexcept
+        {
+            return _mm_shuffle_epi32(
+                s, _MM_SHUFFLE(I1*2 + 1, I1*2, I0*2 + 1, I0*2));
+        }
+
+        inline int64x2 unpack_lo_ss(
+            const int64x2& s1, const int64x2& s2) noexcept
+        {
+            return _mm_unpacklo_epi64(s1, s2);
+        }
+
+        inline int64x2 unpack_hi_ss(
+            const int64x2& s1, const int64x2& s2) noexcept
+        {
+            return _mm_unpackhi_epi64(s1, s2);
+        }
     }
 }
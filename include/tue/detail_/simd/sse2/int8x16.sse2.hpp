@@ -10,7 +10,16 @@
 
 #include <emmintrin.h>
 
+#ifdef TUE_SSSE3
+#include <tmmintrin.h>
+#endif
+
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
 #include <cstdint>
+#include <memory>
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -131,6 +140,33 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        static int8x16 gather(
+            const std::int8_t* base, const int32x16& indices) noexcept
+        {
+            return tue::detail_::gather_s<std::int8_t, 16>(base, indices);
+        }
+
+        static int8x16 gather(
+            const std::int8_t* base,
+            const int32x16& indices,
+            const bool8x16& conditions) noexcept
+        {
+            return tue::detail_::gather_s<std::int8_t, 16>(
+                base, indices, conditions);
+        }
+
+        static int8x16 load_partial(
+            const std::int8_t* data, int count) noexcept
+        {
+            return tue::detail_::load_partial_s<std::int8_t, 16>(data, count);
+        }
+
+        static int8x16 maskload(
+            const std::int8_t* data, const bool8x16& conditions) noexcept
+        {
+            return tue::detail_::maskload_s<std::int8_t, 16>(data, conditions);
+        }
+
         void store(std::int8_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -141,6 +177,36 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void store_stream(std::int8_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        void scatter(std::int8_t* base, const int32x16& indices) const noexcept
+        {
+            tue::detail_::scatter_s<16>(this->data(), base, indices);
+        }
+
+        void scatter(
+            std::int8_t* base,
+            const int32x16& indices,
+            const bool8x16& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<16>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(std::int8_t* data, int count) const noexcept
+        {
+            tue::detail_::store_partial_s<16>(this->data(), data, count);
+        }
+
+        void maskstore(
+            std::int8_t* data, const bool8x16& conditions) const noexcept
+        {
+            tue::detail_::maskstore_s<16>(this->data(), data, conditions);
+        }
+
         const std::int8_t* data() const noexcept
         {
             return reinterpret_cast<const std::int8_t*>(&underlying_);
@@ -154,6 +220,7 @@ namespace tue
 }
 
 #include "bool8x16.sse2.hpp"
+#include "int16x8.sse2.hpp"
 #include "uint8x16.sse2.hpp"
 
 namespace tue
@@ -221,23 +288,42 @@ namespace tue
             return _mm_sub_epi8(lhs, rhs);
         }
 
-        /*inline int8x16 multiplication_operator_ss(
+        inline int8x16 multiplication_operator_ss(
             const int8x16& lhs, const int8x16& rhs) noexcept
         {
-            // TODO
+            const auto even = _mm_mullo_epi16(lhs, rhs);
+            const auto odd = _mm_mullo_epi16(
+                _mm_srli_epi16(lhs, 8), _mm_srli_epi16(rhs, 8));
+            return _mm_or_si128(
+                _mm_slli_epi16(odd, 8),
+                _mm_and_si128(even, _mm_set1_epi16(0x00FF)));
         }
 
         inline int8x16 division_operator_ss(
             const int8x16& lhs, const int8x16& rhs) noexcept
         {
-            // TODO
+            const auto lhs_lo = _mm_srai_epi16(
+                _mm_unpacklo_epi8(lhs, lhs), 8);
+            const auto lhs_hi = _mm_srai_epi16(
+                _mm_unpackhi_epi8(lhs, lhs), 8);
+            const auto rhs_lo = _mm_srai_epi16(
+                _mm_unpacklo_epi8(rhs, rhs), 8);
+            const auto rhs_hi = _mm_srai_epi16(
+                _mm_unpackhi_epi8(rhs, rhs), 8);
+            const auto mask = _mm_set1_epi16(0x00FF);
+            const auto lo = _mm_and_si128(mask, division_operator_ss(
+                int16x8(lhs_lo), int16x8(rhs_lo)));
+            const auto hi = _mm_and_si128(mask, division_operator_ss(
+                int16x8(lhs_hi), int16x8(rhs_hi)));
+            return _mm_packus_epi16(lo, hi);
         }
 
         inline int8x16 modulo_operator_ss(
             const int8x16& lhs, const int8x16& rhs) noexcept
         {
-            // TODO
-        }*/
+            return subtraction_operator_ss(lhs, multiplication_operator_ss(
+                division_operator_ss(lhs, rhs), rhs));
+        }
 
         inline int8x16 bitwise_and_operator_ss(
             const int8x16& lhs, const int8x16& rhs) noexcept
@@ -257,17 +343,23 @@ namespace tue
             return _mm_xor_si128(lhs, rhs);
         }
 
-        /*inline int8x16 bitwise_shift_left_operator_si(
+        inline int8x16 bitwise_shift_left_operator_si(
             const int8x16& lhs, int rhs) noexcept
         {
-            // TODO
+            return _mm_and_si128(
+                _mm_slli_epi16(lhs, rhs),
+                _mm_set1_epi8(std::int8_t(0xFF << rhs)));
         }
 
         inline int8x16 bitwise_shift_right_operator_si(
             const int8x16& lhs, int rhs) noexcept
         {
-            // TODO
-        }*/
+            const auto sign = _mm_set1_epi8(std::int8_t(0x80 >> rhs));
+            const auto logical = _mm_and_si128(
+                _mm_srli_epi16(lhs, rhs),
+                _mm_set1_epi8(std::int8_t(0xFF >> rhs)));
+            return _mm_sub_epi8(_mm_xor_si128(logical, sign), sign);
+        }
 
         inline int8x16& addition_assignment_operator_ss(
             int8x16& lhs, const int8x16& rhs) noexcept
@@ -281,23 +373,23 @@ namespace tue
             return lhs = _mm_sub_epi8(lhs, rhs);
         }
 
-        /*inline int8x16& multiplication_assignment_operator_ss(
+        inline int8x16& multiplication_assignment_operator_ss(
             int8x16& lhs, const int8x16& rhs) noexcept
         {
-            // TODO
+            return lhs = multiplication_operator_ss(lhs, rhs);
         }
 
         inline int8x16& division_assignment_operator_ss(
             int8x16& lhs, const int8x16& rhs) noexcept
         {
-            // TODO
+            return lhs = division_operator_ss(lhs, rhs);
         }
 
         inline int8x16& modulo_assignment_operator_ss(
             int8x16& lhs, const int8x16& rhs) noexcept
         {
-            // TODO
-        }*/
+            return lhs = modulo_operator_ss(lhs, rhs);
+        }
 
         inline int8x16& bitwise_and_assignment_operator_ss(
             int8x16& lhs, const int8x16& rhs) noexcept
@@ -317,17 +409,17 @@ namespace tue
             return lhs = _mm_xor_si128(lhs, rhs);
         }
 
-        /*inline int8x16& bitwise_shift_left_assignment_operator_si(
+        inline int8x16& bitwise_shift_left_assignment_operator_si(
             int8x16& lhs, int rhs) noexcept
         {
-            // TODO
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
         }
 
         inline int8x16& bitwise_shift_right_assignment_operator_si(
             int8x16& lhs, int rhs) noexcept
         {
-            // TODO
-        }*/
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
 
         inline bool equality_operator_ss(
             const int8x16& lhs, const int8x16& rhs) noexcept
@@ -343,23 +435,39 @@ namespace tue
 
         inline int8x16 abs_s(const int8x16& s) noexcept
         {
+#ifdef TUE_SSSE3
+            return _mm_abs_epi8(s);
+#else
             const auto nmask = _mm_cmplt_epi8(s, _mm_setzero_si128());
             return _mm_or_si128(
                 _mm_and_si128(nmask, unary_minus_operator_s(s)),
                 _mm_andnot_si128(nmask, s));
+#endif
         }
 
-        /*inline int8x16 min_ss(
+        inline int8x16 min_ss(
             const int8x16& s1, const int8x16& s2) noexcept
         {
-            // TODO
+#ifdef TUE_SSE41
+            return _mm_min_epi8(s1, s2);
+#else
+            const auto bias = _mm_set1_epi8(std::int8_t(0x80));
+            return _mm_xor_si128(bias, _mm_min_epu8(
+                _mm_xor_si128(s1, bias), _mm_xor_si128(s2, bias)));
+#endif
         }
 
         inline int8x16 max_ss(
             const int8x16& s1, const int8x16& s2) noexcept
         {
-            // TODO
-        }*/
+#ifdef TUE_SSE41
+            return _mm_max_epi8(s1, s2);
+#else
+            const auto bias = _mm_set1_epi8(std::int8_t(0x80));
+            return _mm_xor_si128(bias, _mm_max_epu8(
+                _mm_xor_si128(s1, bias), _mm_xor_si128(s2, bias)));
+#endif
+        }
 
         inline int8x16 mask_ss(
             const bool8x16& conditions,
@@ -373,9 +481,13 @@ namespace tue
             const int8x16& values,
             const int8x16& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         inline bool8x16 less_ss(
@@ -413,5 +525,81 @@ namespace tue
         {
             return _mm_xor_si128(_mm_cmpeq_epi8(lhs, rhs), int8x16(0xFFu));
         }
+
+        inline std::int8_t hsum_s(const int8x16& s) noexcept
+        {
+            int8x16 t = s;
+            t = tue::detail_::addition_operator_ss(
+                t, int8x16(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::addition_operator_ss(
+                t, int8x16(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            t = tue::detail_::addition_operator_ss(
+                t, int8x16(_mm_srli_epi32(t, 16)));
+            t = tue::detail_::addition_operator_ss(
+                t, int8x16(_mm_srli_epi16(t, 8)));
+            return t.data()[0];
+        }
+
+        inline std::int8_t hprod_s(const int8x16& s) noexcept
+        {
+            int8x16 t = s;
+            t = tue::detail_::multiplication_operator_ss(
+                t, int8x16(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::multiplication_operator_ss(
+                t, int8x16(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            t = tue::detail_::multiplication_operator_ss(
+                t, int8x16(_mm_srli_epi32(t, 16)));
+            t = tue::detail_::multiplication_operator_ss(
+                t, int8x16(_mm_srli_epi16(t, 8)));
+            return t.data()[0];
+        }
+
+        inline std::int8_t hmin_s(const int8x16& s) noexcept
+        {
+            int8x16 t = s;
+            t = tue::detail_::min_ss(
+                t, int8x16(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::min_ss(
+                t, int8x16(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            t = tue::detail_::min_ss(
+                t, int8x16(_mm_srli_epi32(t, 16)));
+            t = tue::detail_::min_ss(
+                t, int8x16(_mm_srli_epi16(t, 8)));
+            return t.data()[0];
+        }
+
+        inline std::int8_t hmax_s(const int8x16& s) noexcept
+        {
+            int8x16 t = s;
+            t = tue::detail_::max_ss(
+                t, int8x16(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::max_ss(
+                t, int8x16(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            t = tue::detail_::max_ss(
+                t, int8x16(_mm_srli_epi32(t, 16)));
+            t = tue::detail_::max_ss(
+                t, int8x16(_mm_srli_epi16(t, 8)));
+            return t.data()[0];
+        }
+
+#ifdef TUE_SSSE3
+        template<int... I>
+        inline int8x16 shuffle_s(const int8x16& s) noexcept
+        {
+            return _mm_shuffle_epi8(s, _mm_setr_epi8(static_cast<char>(I)...));
+        }
+#endif
+
+        inline int8x16 unpack_lo_ss(
+            const int8x16& s1, const int8x16& s2) noexcept
+        {
+            return _mm_unpacklo_epi8(s1, s2);
+        }
+
+        inline int8x16 unpack_hi_ss(
+            const int8x16& s1, const int8x16& s2) noexcept
+        {
+            return _mm_unpackhi_epi8(s1, s2);
+        }
     }
 }
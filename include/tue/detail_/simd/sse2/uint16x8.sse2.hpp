@@ -10,7 +10,16 @@
 
 #include <emmintrin.h>
 
+#ifdef TUE_SSSE3
+#include <tmmintrin.h>
+#endif
+
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
 #include <cstdint>
+#include <memory>
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -122,6 +131,34 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        static uint16x8 gather(
+            const std::uint16_t* base, const int32x8& indices) noexcept
+        {
+            return tue::detail_::gather_s<std::uint16_t, 8>(base, indices);
+        }
+
+        static uint16x8 gather(
+            const std::uint16_t* base,
+            const int32x8& indices,
+            const bool16x8& conditions) noexcept
+        {
+            return tue::detail_::gather_s<std::uint16_t, 8>(
+                base, indices, conditions);
+        }
+
+        static uint16x8 load_partial(
+            const std::uint16_t* data, int count) noexcept
+        {
+            return tue::detail_::load_partial_s<std::uint16_t, 8>(data, count);
+        }
+
+        static uint16x8 maskload(
+            const std::uint16_t* data, const bool16x8& conditions) noexcept
+        {
+            return tue::detail_::maskload_s<std::uint16_t, 8>(
+                data, conditions);
+        }
+
         void store(std::uint16_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -132,6 +169,37 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void store_stream(std::uint16_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        void scatter(
+            std::uint16_t* base, const int32x8& indices) const noexcept
+        {
+            tue::detail_::scatter_s<8>(this->data(), base, indices);
+        }
+
+        void scatter(
+            std::uint16_t* base,
+            const int32x8& indices,
+            const bool16x8& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<8>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(std::uint16_t* data, int count) const noexcept
+        {
+            tue::detail_::store_partial_s<8>(this->data(), data, count);
+        }
+
+        void maskstore(
+            std::uint16_t* data, const bool16x8& conditions) const noexcept
+        {
+            tue::detail_::maskstore_s<8>(this->data(), data, conditions);
+        }
+
         const std::uint16_t* data() const noexcept
         {
             return reinterpret_cast<const std::uint16_t*>(&underlying_);
@@ -202,23 +270,35 @@ namespace tue
             return _mm_sub_epi16(lhs, rhs);
         }
 
-        /*inline uint16x8 multiplication_operator_ss(
+        inline uint16x8 multiplication_operator_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
+            return _mm_mullo_epi16(lhs, rhs);
         }
 
         inline uint16x8 division_operator_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
+            const auto zero = _mm_setzero_si128();
+            const auto lhs_lo = _mm_unpacklo_epi16(lhs, zero);
+            const auto lhs_hi = _mm_unpackhi_epi16(lhs, zero);
+            const auto rhs_lo = _mm_unpacklo_epi16(rhs, zero);
+            const auto rhs_hi = _mm_unpackhi_epi16(rhs, zero);
+            const auto lo = _mm_cvttps_epi32(_mm_div_ps(
+                _mm_cvtepi32_ps(lhs_lo), _mm_cvtepi32_ps(rhs_lo)));
+            const auto hi = _mm_cvttps_epi32(_mm_div_ps(
+                _mm_cvtepi32_ps(lhs_hi), _mm_cvtepi32_ps(rhs_hi)));
+            return _mm_packs_epi32(
+                _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16),
+                _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
         }
 
         inline uint16x8 modulo_operator_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
-        }*/
+            return subtraction_operator_ss(lhs, multiplication_operator_ss(
+                division_operator_ss(lhs, rhs), rhs));
+        }
 
         inline uint16x8 bitwise_and_operator_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
@@ -262,23 +342,23 @@ namespace tue
             return lhs = _mm_sub_epi16(lhs, rhs);
         }
 
-        /*inline uint16x8& multiplication_assignment_operator_ss(
+        inline uint16x8& multiplication_assignment_operator_ss(
             uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
+            return lhs = multiplication_operator_ss(lhs, rhs);
         }
 
         inline uint16x8& division_assignment_operator_ss(
             uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
+            return lhs = division_operator_ss(lhs, rhs);
         }
 
         inline uint16x8& modulo_assignment_operator_ss(
             uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
-        }*/
+            return lhs = modulo_operator_ss(lhs, rhs);
+        }
 
         inline uint16x8& bitwise_and_assignment_operator_ss(
             uint16x8& lhs, const uint16x8& rhs) noexcept
@@ -327,17 +407,29 @@ namespace tue
             return s;
         }
 
-        /*inline uint16x8 min_ss(
+        inline uint16x8 min_ss(
             const uint16x8& s1, const uint16x8& s2) noexcept
         {
-            // TODO
+#ifdef TUE_SSE41
+            return _mm_min_epu16(s1, s2);
+#else
+            const auto bias = _mm_set1_epi16(std::int16_t(0x8000));
+            return _mm_xor_si128(bias, _mm_min_epi16(
+                _mm_xor_si128(s1, bias), _mm_xor_si128(s2, bias)));
+#endif
         }
 
         inline uint16x8 max_ss(
             const uint16x8& s1, const uint16x8& s2) noexcept
         {
-            // TODO
-        }*/
+#ifdef TUE_SSE41
+            return _mm_max_epu16(s1, s2);
+#else
+            const auto bias = _mm_set1_epi16(std::int16_t(0x8000));
+            return _mm_xor_si128(bias, _mm_max_epi16(
+                _mm_xor_si128(s1, bias), _mm_xor_si128(s2, bias)));
+#endif
+        }
 
         inline uint16x8 mask_ss(
             const bool16x8& conditions,
@@ -351,34 +443,42 @@ namespace tue
             const uint16x8& values,
             const uint16x8& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
-        /*inline bool16x8 less_ss(
+        inline bool16x8 less_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
+            const auto bias = _mm_set1_epi16(std::int16_t(0x8000));
+            return _mm_cmplt_epi16(
+                _mm_xor_si128(lhs, bias), _mm_xor_si128(rhs, bias));
         }
 
         inline bool16x8 less_equal_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
+            return _mm_xor_si128(less_ss(rhs, lhs), uint16x8(0xFFFF));
         }
 
         inline bool16x8 greater_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
+            const auto bias = _mm_set1_epi16(std::int16_t(0x8000));
+            return _mm_cmpgt_epi16(
+                _mm_xor_si128(lhs, bias), _mm_xor_si128(rhs, bias));
         }
 
         inline bool16x8 greater_equal_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
-        }*/
+            return _mm_xor_si128(less_ss(lhs, rhs), uint16x8(0xFFFF));
+        }
 
         inline bool16x8 equal_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
@@ -391,5 +491,75 @@ namespace tue
         {
             return _mm_xor_si128(_mm_cmpeq_epi16(lhs, rhs), uint16x8(0xFFFF));
         }
+
+        inline std::uint16_t hsum_s(const uint16x8& s) noexcept
+        {
+            uint16x8 t = s;
+            t = tue::detail_::addition_operator_ss(
+                t, uint16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::addition_operator_ss(
+                t, uint16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            t = tue::detail_::addition_operator_ss(
+                t, uint16x8(_mm_srli_epi32(t, 16)));
+            return t.data()[0];
+        }
+
+        inline std::uint16_t hprod_s(const uint16x8& s) noexcept
+        {
+            uint16x8 t = s;
+            t = tue::detail_::multiplication_operator_ss(
+                t, uint16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::multiplication_operator_ss(
+                t, uint16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            t = tue::detail_::multiplication_operator_ss(
+                t, uint16x8(_mm_srli_epi32(t, 16)));
+            return t.data()[0];
+        }
+
+        inline std::uint16_t hmin_s(const uint16x8& s) noexcept
+        {
+            uint16x8 t = s;
+            t = tue::detail_::min_ss(
+                t, uint16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::min_ss(
+                t, uint16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            t = tue::detail_::min_ss(
+                t, uint16x8(_mm_srli_epi32(t, 16)));
+            return t.data()[0];
+        }
+
+        inline std::uint16_t hmax_s(const uint16x8& s) noexcept
+        {
+            uint16x8 t = s;
+            t = tue::detail_::max_ss(
+                t, uint16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::max_ss(
+                t, uint16x8(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            t = tue::detail_::max_ss(
+                t, uint16x8(_mm_srli_epi32(t, 16)));
+            return t.data()[0];
+        }
+
+#ifdef TUE_SSSE3
+        template<int... I>
+        inline uint16x8 shuffle_s(const uint16x8& s) noexcept
+        {
+            // Each 16-bit index selects its component's two bytes.
+            return _mm_shuffle_epi8(s, _mm_setr_epi16(
+                static_cast<short>(I*2 | (I*2 + 1) << 8)...));
+        }
+#endif
+
+        inline uint16x8 unpack_lo_ss(
+            const uint16x8& s1, const uint16x8& s2) noexcept
+        {
+            return _mm_unpacklo_epi16(s1, s2);
+        }
+
+        inline uint16x8 unpack_hi_ss(
+            const uint16x8& s1, const uint16x8& s2) noexcept
+        {
+            return _mm_unpackhi_epi16(s1, s2);
+        }
     }
 }
@@ -10,7 +10,16 @@
 
 #include <emmintrin.h>
 
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 #include <cstdint>
+#include <memory>
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -119,6 +128,65 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        static uint32x4 gather(
+            const std::uint32_t* base, const int32x4& indices) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = reinterpret_cast<const __m128i&>(indices);
+            return _mm_i32gather_epi32(
+                reinterpret_cast<const int*>(base), vindex, 4);
+#else
+            return tue::detail_::gather_s<std::uint32_t, 4>(base, indices);
+#endif
+        }
+
+        static uint32x4 gather(
+            const std::uint32_t* base,
+            const int32x4& indices,
+            const bool32x4& conditions) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = reinterpret_cast<const __m128i&>(indices);
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            return _mm_mask_i32gather_epi32(
+                _mm_setzero_si128(),
+                reinterpret_cast<const int*>(base),
+                vindex,
+                vmask,
+                4);
+#else
+            return tue::detail_::gather_s<std::uint32_t, 4>(
+                base, indices, conditions);
+#endif
+        }
+
+        static uint32x4 load_partial(
+            const std::uint32_t* data, int count) noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool32, 4>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            return _mm_castps_si128(
+                _mm_maskload_ps(reinterpret_cast<const float*>(data), vmask));
+#else
+            return tue::detail_::load_partial_s<std::uint32_t, 4>(data, count);
+#endif
+        }
+
+        static uint32x4 maskload(
+            const std::uint32_t* data, const bool32x4& conditions) noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            return _mm_castps_si128(
+                _mm_maskload_ps(reinterpret_cast<const float*>(data), vmask));
+#else
+            return tue::detail_::maskload_s<std::uint32_t, 4>(
+                data, conditions);
+#endif
+        }
+
         void store(std::uint32_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -129,6 +197,55 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void store_stream(std::uint32_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        void scatter(
+            std::uint32_t* base, const int32x4& indices) const noexcept
+        {
+            tue::detail_::scatter_s<4>(this->data(), base, indices);
+        }
+
+        void scatter(
+            std::uint32_t* base,
+            const int32x4& indices,
+            const bool32x4& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<4>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(std::uint32_t* data, int count) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool32, 4>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            _mm_maskstore_ps(
+                reinterpret_cast<float*>(data),
+                vmask,
+                _mm_castsi128_ps(underlying_));
+#else
+            tue::detail_::store_partial_s<4>(this->data(), data, count);
+#endif
+        }
+
+        void maskstore(
+            std::uint32_t* data, const bool32x4& conditions) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            _mm_maskstore_ps(
+                reinterpret_cast<float*>(data),
+                vmask,
+                _mm_castsi128_ps(underlying_));
+#else
+            tue::detail_::maskstore_s<4>(this->data(), data, conditions);
+#endif
+        }
+
         const std::uint32_t* data() const noexcept
         {
             return reinterpret_cast<const std::uint32_t*>(&underlying_);
@@ -205,23 +322,49 @@ namespace tue
             return _mm_sub_epi32(lhs, rhs);
         }
 
-        /*inline uint32x4 multiplication_operator_ss(
+        inline uint32x4 multiplication_operator_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
+#ifdef TUE_SSE41
+            return _mm_mullo_epi32(lhs, rhs);
+#else
+            const auto even = _mm_mul_epu32(lhs, rhs);
+            const auto odd = _mm_mul_epu32(
+                _mm_srli_epi64(lhs, 32), _mm_srli_epi64(rhs, 32));
+            return _mm_unpacklo_epi32(
+                _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
         }
 
         inline uint32x4 division_operator_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
+            const auto bias = _mm_set1_epi32(std::int32_t(0x80000000u));
+            const auto offset = _mm_set1_pd(2147483648.0);
+            const auto lhs_biased = _mm_xor_si128(lhs, bias);
+            const auto rhs_biased = _mm_xor_si128(rhs, bias);
+            const auto lo = _mm_cvttpd_epi32(_mm_div_pd(
+                _mm_add_pd(_mm_cvtepi32_pd(lhs_biased), offset),
+                _mm_add_pd(_mm_cvtepi32_pd(rhs_biased), offset)));
+            const auto hi = _mm_cvttpd_epi32(_mm_div_pd(
+                _mm_add_pd(_mm_cvtepi32_pd(
+                    _mm_unpackhi_epi64(lhs_biased, lhs_biased)), offset),
+                _mm_add_pd(_mm_cvtepi32_pd(
+                    _mm_unpackhi_epi64(rhs_biased, rhs_biased)), offset)));
+            // Only a divisor of 1 can produce a quotient >= 2^31
+            const auto one = _mm_cmpeq_epi32(rhs, _mm_set1_epi32(1));
+            return _mm_or_si128(
+                _mm_and_si128(one, lhs),
+                _mm_andnot_si128(one, _mm_unpacklo_epi64(lo, hi)));
         }
 
         inline uint32x4 modulo_operator_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
-        }*/
+            return subtraction_operator_ss(lhs, multiplication_operator_ss(
+                division_operator_ss(lhs, rhs), rhs));
+        }
 
         inline uint32x4 bitwise_and_operator_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
@@ -265,23 +408,23 @@ namespace tue
             return lhs = _mm_sub_epi32(lhs, rhs);
         }
 
-        /*inline uint32x4& multiplication_assignment_operator_ss(
+        inline uint32x4& multiplication_assignment_operator_ss(
             uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
+            return lhs = multiplication_operator_ss(lhs, rhs);
         }
 
         inline uint32x4& division_assignment_operator_ss(
             uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
+            return lhs = division_operator_ss(lhs, rhs);
         }
 
         inline uint32x4& modulo_assignment_operator_ss(
             uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
-        }*/
+            return lhs = modulo_operator_ss(lhs, rhs);
+        }
 
         inline uint32x4& bitwise_and_assignment_operator_ss(
             uint32x4& lhs, const uint32x4& rhs) noexcept
@@ -330,18 +473,6 @@ namespace tue
             return s;
         }
 
-        /*inline uint32x4 min_ss(
-            const uint32x4& s1, const uint32x4& s2) noexcept
-        {
-            // TODO
-        }
-
-        inline uint32x4 max_ss(
-            const uint32x4& s1, const uint32x4& s2) noexcept
-        {
-            // TODO
-        }*/
-
         inline uint32x4 mask_ss(
             const bool32x4& conditions,
             const uint32x4& values) noexcept
@@ -354,34 +485,42 @@ namespace tue
             const uint32x4& values,
             const uint32x4& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
-        /*inline bool32x4 less_ss(
+        inline bool32x4 less_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
+            const auto bias = _mm_set1_epi32(std::int32_t(0x80000000u));
+            return _mm_cmplt_epi32(
+                _mm_xor_si128(lhs, bias), _mm_xor_si128(rhs, bias));
         }
 
         inline bool32x4 less_equal_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
+            return _mm_xor_si128(less_ss(rhs, lhs), uint32x4(0xFFFFFFFF));
         }
 
         inline bool32x4 greater_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
+            const auto bias = _mm_set1_epi32(std::int32_t(0x80000000u));
+            return _mm_cmpgt_epi32(
+                _mm_xor_si128(lhs, bias), _mm_xor_si128(rhs, bias));
         }
 
         inline bool32x4 greater_equal_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
-        }*/
+            return _mm_xor_si128(less_ss(lhs, rhs), uint32x4(0xFFFFFFFF));
+        }
 
         inline bool32x4 equal_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
@@ -395,5 +534,83 @@ namespace tue
             return _mm_xor_si128(
                 _mm_cmpeq_epi32(lhs, rhs), uint32x4(0xFFFFFFFF));
         }
+
+        inline uint32x4 min_ss(
+            const uint32x4& s1, const uint32x4& s2) noexcept
+        {
+#ifdef TUE_SSE41
+            return _mm_min_epu32(s1, s2);
+#else
+            return select_sss(less_ss(s1, s2), s1, s2);
+#endif
+        }
+
+        inline uint32x4 max_ss(
+            const uint32x4& s1, const uint32x4& s2) noexcept
+        {
+#ifdef TUE_SSE41
+            return _mm_max_epu32(s1, s2);
+#else
+            return select_sss(greater_ss(s1, s2), s1, s2);
+#endif
+        }
+
+        inline std::uint32_t hsum_s(const uint32x4& s) noexcept
+        {
+            uint32x4 t = s;
+            t = tue::detail_::addition_operator_ss(
+                t, uint32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::addition_operator_ss(
+                t, uint32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            return t.data()[0];
+        }
+
+        inline std::uint32_t hprod_s(const uint32x4& s) noexcept
+        {
+            uint32x4 t = s;
+            t = tue::detail_::multiplication_operator_ss(
+                t, uint32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::multiplication_operator_ss(
+                t, uint32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            return t.data()[0];
+        }
+
+        inline std::uint32_t hmin_s(const uint32x4& s) noexcept
+        {
+            uint32x4 t = s;
+            t = tue::detail_::min_ss(
+                t, uint32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::min_ss(
+                t, uint32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            return t.data()[0];
+        }
+
+        inline std::uint32_t hmax_s(const uint32x4& s) noexcept
+        {
+            uint32x4 t = s;
+            t = tue::detail_::max_ss(
+                t, uint32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            t = tue::detail_::max_ss(
+                t, uint32x4(_mm_shuffle_epi32(t, _MM_SHUFFLE(2, 3, 0, 1))));
+            return t.data()[0];
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline uint32x4 shuffle_s(const uint32x4& s) noexcept
+        {
+            return _mm_shuffle_epi32(s, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+
+        inline uint32x4 unpack_lo_ss(
+            const uint32x4& s1, const uint32x4& s2) noexcept
+        {
+            return _mm_unpacklo_epi32(s1, s2);
+        }
+
+        inline uint32x4 unpack_hi_ss(
+            const uint32x4& s1, const uint32x4& s2) noexcept
+        {
+            return _mm_unpackhi_epi32(s1, s2);
+        }
     }
 }
@@ -10,7 +10,16 @@
 
 #include <emmintrin.h>
 
+#ifdef TUE_SSE41
+#include <smmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 #include <cstdint>
+#include <memory>
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -115,6 +124,67 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        static uint64x2 gather(
+            const std::uint64_t* base, const int32x2& indices) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = _mm_loadl_epi64(
+                reinterpret_cast<const __m128i*>(std::addressof(indices)));
+            return _mm_i32gather_epi64(
+                reinterpret_cast<const long long*>(base), vindex, 8);
+#else
+            return tue::detail_::gather_s<std::uint64_t, 2>(base, indices);
+#endif
+        }
+
+        static uint64x2 gather(
+            const std::uint64_t* base,
+            const int32x2& indices,
+            const bool64x2& conditions) noexcept
+        {
+#ifdef TUE_AVX2
+            const auto vindex = _mm_loadl_epi64(
+                reinterpret_cast<const __m128i*>(std::addressof(indices)));
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            return _mm_mask_i32gather_epi64(
+                _mm_setzero_si128(),
+                reinterpret_cast<const long long*>(base),
+                vindex,
+                vmask,
+                8);
+#else
+            return tue::detail_::gather_s<std::uint64_t, 2>(
+                base, indices, conditions);
+#endif
+        }
+
+        static uint64x2 load_partial(
+            const std::uint64_t* data, int count) noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool64, 2>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            return _mm_castpd_si128(
+                _mm_maskload_pd(reinterpret_cast<const double*>(data), vmask));
+#else
+            return tue::detail_::load_partial_s<std::uint64_t, 2>(data, count);
+#endif
+        }
+
+        static uint64x2 maskload(
+            const std::uint64_t* data, const bool64x2& conditions) noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            return _mm_castpd_si128(
+                _mm_maskload_pd(reinterpret_cast<const double*>(data), vmask));
+#else
+            return tue::detail_::maskload_s<std::uint64_t, 2>(
+                data, conditions);
+#endif
+        }
+
         void store(std::uint64_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -125,6 +195,55 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void store_stream(std::uint64_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        void scatter(
+            std::uint64_t* base, const int32x2& indices) const noexcept
+        {
+            tue::detail_::scatter_s<2>(this->data(), base, indices);
+        }
+
+        void scatter(
+            std::uint64_t* base,
+            const int32x2& indices,
+            const bool64x2& conditions) const noexcept
+        {
+            tue::detail_::scatter_s<2>(
+                this->data(), base, indices, conditions);
+        }
+
+        void store_partial(std::uint64_t* data, int count) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto mask = tue::detail_::partial_mask_s<bool64, 2>(count);
+            const auto vmask = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(mask));
+            _mm_maskstore_pd(
+                reinterpret_cast<double*>(data),
+                vmask,
+                _mm_castsi128_pd(underlying_));
+#else
+            tue::detail_::store_partial_s<2>(this->data(), data, count);
+#endif
+        }
+
+        void maskstore(
+            std::uint64_t* data, const bool64x2& conditions) const noexcept
+        {
+#ifdef TUE_AVX
+            const auto vmask = reinterpret_cast<const __m128i&>(conditions);
+            _mm_maskstore_pd(
+                reinterpret_cast<double*>(data),
+                vmask,
+                _mm_castsi128_pd(underlying_));
+#else
+            tue::detail_::maskstore_s<2>(this->data(), data, conditions);
+#endif
+        }
+
         const std::uint64_t* data() const noexcept
         {
             return reinterpret_cast<const std::uint64_t*>(&underlying_);
@@ -195,13 +314,17 @@ namespace tue
             return _mm_sub_epi64(lhs, rhs);
         }
 
-        /*inline uint64x2 multiplication_operator_ss(
+        inline uint64x2 multiplication_operator_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
-            // TODO
+            const auto lo = _mm_mul_epu32(lhs, rhs);
+            const auto hi = _mm_add_epi64(
+                _mm_mul_epu32(_mm_srli_epi64(lhs, 32), rhs),
+                _mm_mul_epu32(lhs, _mm_srli_epi64(rhs, 32)));
+            return _mm_add_epi64(lo, _mm_slli_epi64(hi, 32));
         }
 
-        inline uint64x2 division_operator_ss(
+        /*inline uint64x2 division_operator_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
             // TODO
@@ -255,13 +378,13 @@ namespace tue
             return lhs = _mm_sub_epi64(lhs, rhs);
         }
 
-        /*inline uint64x2& multiplication_assignment_operator_ss(
+        inline uint64x2& multiplication_assignment_operator_ss(
             uint64x2& lhs, const uint64x2& rhs) noexcept
         {
-            // TODO
+            return lhs = multiplication_operator_ss(lhs, rhs);
         }
 
-        inline uint64x2& division_assignment_operator_ss(
+        /*inline uint64x2& division_assignment_operator_ss(
             uint64x2& lhs, const uint64x2& rhs) noexcept
         {
             // TODO
@@ -320,18 +443,6 @@ namespace tue
             return s;
         }
 
-        /*inline uint64x2 min_ss(
-            const uint64x2& s1, const uint64x2& s2) noexcept
-        {
-            // TODO
-        }
-
-        inline uint64x2 max_ss(
-            const uint64x2& s1, const uint64x2& s2) noexcept
-        {
-            // TODO
-        }*/
-
         inline uint64x2 mask_ss(
             const bool64x2& conditions,
             const uint64x2& values) noexcept
@@ -344,42 +455,59 @@ namespace tue
             const uint64x2& values,
             const uint64x2& otherwise) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
-        /*inline bool64x2 less_ss(
+        inline bool64x2 less_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
-            // TODO
+            // Compare the high halves as signed and the low halves as
+            // unsigned, then use the low result where the high halves
+            // are equal
+            const auto bias = _mm_set1_epi64x(0x8000000080000000);
+            const auto gt = _mm_cmpgt_epi32(
+                _mm_xor_si128(rhs, bias), _mm_xor_si128(lhs, bias));
+            const auto eq = _mm_cmpeq_epi32(lhs, rhs);
+            const auto result = _mm_or_si128(gt, _mm_and_si128(
+                eq, _mm_shuffle_epi32(gt, _MM_SHUFFLE(2, 2, 0, 0))));
+            return _mm_shuffle_epi32(result, _MM_SHUFFLE(3, 3, 1, 1));
         }
 
         inline bool64x2 less_equal_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
-            // TODO
+            return _mm_xor_si128(less_ss(rhs, lhs), uint64x2(~0ull));
         }
 
         inline bool64x2 greater_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
-            // TODO
+            return less_ss(rhs, lhs);
         }
 
         inline bool64x2 greater_equal_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
-            // TODO
-        }*/
+            return _mm_xor_si128(less_ss(lhs, rhs), uint64x2(~0ull));
+        }
 
         inline bool64x2 equal_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
+#ifdef TUE_SSE41
+            return _mm_cmpeq_epi64(lhs, rhs);
+#else
             const auto cmp = _mm_cmpeq_epi32(lhs, rhs);
             const auto hi = _mm_shuffle_epi32(cmp, _MM_SHUFFLE(3, 3, 1, 1));
             const auto lo = _mm_shuffle_epi32(cmp, _MM_SHUFFLE(2, 2, 0, 0));
             return _mm_and_si128(hi, lo);
+#endif
         }
 
         inline bool64x2 not_equal_ss(
@@ -387,5 +515,68 @@ namespace tue
         {
             return _mm_xor_si128(equal_ss(lhs, rhs), uint64x2(~0ull));
         }
+
+        inline uint64x2 min_ss(
+            const uint64x2& s1, const uint64x2& s2) noexcept
+        {
+            return select_sss(less_ss(s1, s2), s1, s2);
+        }
+
+        inline uint64x2 max_ss(
+            const uint64x2& s1, const uint64x2& s2) noexcept
+        {
+            return select_sss(greater_ss(s1, s2), s1, s2);
+        }
+
+        inline std::uint64_t hsum_s(const uint64x2& s) noexcept
+        {
+            uint64x2 t = s;
+            t = tue::detail_::addition_operator_ss(
+                t, uint64x2(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            return t.data()[0];
+        }
+
+        inline std::uint64_t hprod_s(const uint64x2& s) noexcept
+        {
+            uint64x2 t = s;
+            t = tue::detail_::multiplication_operator_ss(
+                t, uint64x2(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            return t.data()[0];
+        }
+
+        inline std::uint64_t hmin_s(const uint64x2& s) noexcept
+        {
+            uint64x2 t = s;
+            t = tue::detail_::min_ss(
+                t, uint64x2(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            return t.data()[0];
+        }
+
+        inline std::uint64_t hmax_s(const uint64x2& s) noexcept
+        {
+            uint64x2 t = s;
+            t = tue::detail_::max_ss(
+                t, uint64x2(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2))));
+            return t.data()[0];
+        }
+
+        template<int I0, int I1>
+        inline uint64x2 shuffle_s(const uint64x2& s) noexcept
+        {
+            return _mm_shuffle_epi32(
+                s, _MM_SHUFFLE(I1*2 + 1, I1*2, I0*2 + 1, I0*2));
+        }
+
+        inline uint64x2 unpack_lo_ss(
+            const uint64x2& s1, const uint64x2& s2) noexcept
+        {
+            return _mm_unpacklo_epi64(s1, s2);
+        }
+
+        inline uint64x2 unpack_hi_ss(
+            const uint64x2& s1, const uint64x2& s2) noexcept
+        {
+            return _mm_unpackhi_epi64(s1, s2);
+        }
     }
 }
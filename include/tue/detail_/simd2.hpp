@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <type_traits>
 
 #include "../math.hpp"
@@ -86,6 +87,50 @@ namespace tue
             return s;
         }
 
+        static simd<T, 2> gather(
+            const T* base, const simd<std::int32_t, 2>& indices) noexcept
+        {
+            const auto idata = reinterpret_cast<const std::int32_t*>(&indices);
+            simd<T, 2> s;
+            s.data_[0] = base[idata[0]];
+            s.data_[1] = base[idata[1]];
+            return s;
+        }
+
+        static simd<T, 2> gather(
+            const T* base,
+            const simd<std::int32_t, 2>& indices,
+            const simd<sized_bool_t<sizeof(T)>, 2>& conditions) noexcept
+        {
+            const auto idata = reinterpret_cast<const std::int32_t*>(&indices);
+            const auto cdata = reinterpret_cast<
+                const sized_bool_t<sizeof(T)>*>(&conditions);
+            simd<T, 2> s;
+            s.data_[0] = cdata[0] ? base[idata[0]] : static_cast<T>(0);
+            s.data_[1] = cdata[1] ? base[idata[1]] : static_cast<T>(0);
+            return s;
+        }
+
+        static simd<T, 2> load_partial(const T* data, int count) noexcept
+        {
+            simd<T, 2> s;
+            s.data_[0] = count > 0 ? data[0] : static_cast<T>(0);
+            s.data_[1] = count > 1 ? data[1] : static_cast<T>(0);
+            return s;
+        }
+
+        static simd<T, 2> maskload(
+            const T* data,
+            const simd<sized_bool_t<sizeof(T)>, 2>& conditions) noexcept
+        {
+            const auto cdata = reinterpret_cast<
+                const sized_bool_t<sizeof(T)>*>(&conditions);
+            simd<T, 2> s;
+            s.data_[0] = cdata[0] ? data[0] : static_cast<T>(0);
+            s.data_[1] = cdata[1] ? data[1] : static_cast<T>(0);
+            return s;
+        }
+
         void store(T* data) const noexcept
         {
             data[0] = this->data_[0];
@@ -98,6 +143,66 @@ namespace tue
             data[1] = this->data_[1];
         }
 
+        void store_stream(T* data) const noexcept
+        {
+            data[0] = this->data_[0];
+            data[1] = this->data_[1];
+        }
+
+        void scatter(
+            T* base, const simd<std::int32_t, 2>& indices) const noexcept
+        {
+            const auto idata = reinterpret_cast<const std::int32_t*>(&indices);
+            base[idata[0]] = this->data_[0];
+            base[idata[1]] = this->data_[1];
+        }
+
+        void scatter(
+            T* base,
+            const simd<std::int32_t, 2>& indices,
+            const simd<sized_bool_t<sizeof(T)>, 2>& conditions) const noexcept
+        {
+            const auto idata = reinterpret_cast<const std::int32_t*>(&indices);
+            const auto cdata = reinterpret_cast<
+                const sized_bool_t<sizeof(T)>*>(&conditions);
+            if (cdata[0])
+            {
+                base[idata[0]] = this->data_[0];
+            }
+            if (cdata[1])
+            {
+                base[idata[1]] = this->data_[1];
+            }
+        }
+
+        void store_partial(T* data, int count) const noexcept
+        {
+            if (count > 0)
+            {
+                data[0] = this->data_[0];
+            }
+            if (count > 1)
+            {
+                data[1] = this->data_[1];
+            }
+        }
+
+        void maskstore(
+            T* data,
+            const simd<sized_bool_t<sizeof(T)>, 2>& conditions) const noexcept
+        {
+            const auto cdata = reinterpret_cast<
+                const sized_bool_t<sizeof(T)>*>(&conditions);
+            if (cdata[0])
+            {
+                data[0] = this->data_[0];
+            }
+            if (cdata[1])
+            {
+                data[1] = this->data_[1];
+            }
+        }
+
         const T* data() const noexcept
         {
             return this->data_;
@@ -473,6 +578,98 @@ namespace tue
             tue::math::sincos(sdata[1], sout[1], cout[1]);
         }
 
+        template<typename T>
+        inline simd<T, 2> sin_accurate_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::sin_accurate(sdata[0]);
+            rdata[1] = tue::math::sin_accurate(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> cos_accurate_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::cos_accurate(sdata[0]);
+            rdata[1] = tue::math::cos_accurate(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline void sincos_accurate_s(
+            const simd<T, 2>& s,
+            simd<T, 2>& sin_out,
+            simd<T, 2>& cos_out) noexcept
+        {
+            const auto sdata = s.data();
+            const auto sout = sin_out.data();
+            const auto cout = cos_out.data();
+            tue::math::sincos_accurate(sdata[0], sout[0], cout[0]);
+            tue::math::sincos_accurate(sdata[1], sout[1], cout[1]);
+        }
+
+        template<typename T>
+        inline simd<T, 2> tan_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::tan(sdata[0]);
+            rdata[1] = tue::math::tan(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> asin_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::asin(sdata[0]);
+            rdata[1] = tue::math::asin(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> acos_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::acos(sdata[0]);
+            rdata[1] = tue::math::acos(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> atan_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::atan(sdata[0]);
+            rdata[1] = tue::math::atan(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> atan2_ss(
+            const simd<T, 2>& y, const simd<T, 2>& x) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto ydata = y.data();
+            const auto xdata = x.data();
+            rdata[0] = tue::math::atan2(ydata[0], xdata[0]);
+            rdata[1] = tue::math::atan2(ydata[1], xdata[1]);
+            return result;
+        }
+
         template<typename T>
         inline simd<T, 2> exp_s(const simd<T, 2>& s) noexcept
         {
@@ -495,6 +692,28 @@ namespace tue
             return result;
         }
 
+        template<typename T>
+        inline simd<T, 2> exp2_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::exp2(sdata[0]);
+            rdata[1] = tue::math::exp2(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> log2_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::log2(sdata[0]);
+            rdata[1] = tue::math::log2(sdata[1]);
+            return result;
+        }
+
         template<typename T>
         inline simd<T, 2> abs_s(const simd<T, 2>& s) noexcept
         {
@@ -530,6 +749,28 @@ namespace tue
             return result;
         }
 
+        template<typename T>
+        inline simd<T, 2> recip_fast_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::recip_fast(sdata[0]);
+            rdata[1] = tue::math::recip_fast(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> recip_exact_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::recip_exact(sdata[0]);
+            rdata[1] = tue::math::recip_exact(sdata[1]);
+            return result;
+        }
+
         template<typename T>
         inline simd<T, 2> sqrt_s(const simd<T, 2>& s) noexcept
         {
@@ -552,6 +793,28 @@ namespace tue
             return result;
         }
 
+        template<typename T>
+        inline simd<T, 2> rsqrt_fast_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::rsqrt_fast(sdata[0]);
+            rdata[1] = tue::math::rsqrt_fast(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> rsqrt_exact_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::rsqrt_exact(sdata[0]);
+            rdata[1] = tue::math::rsqrt_exact(sdata[1]);
+            return result;
+        }
+
         template<typename T>
         inline simd<T, 2> min_ss(
             const simd<T, 2>& s1, const simd<T, 2>& s2) noexcept
@@ -578,6 +841,34 @@ namespace tue
             return result;
         }
 
+        template<typename T>
+        inline T hsum_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return T(sdata[0] + sdata[1]);
+        }
+
+        template<typename T>
+        inline T hprod_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return T(sdata[0] * sdata[1]);
+        }
+
+        template<typename T>
+        inline T hmin_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return tue::math::min(sdata[0], sdata[1]);
+        }
+
+        template<typename T>
+        inline T hmax_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return tue::math::max(sdata[0], sdata[1]);
+        }
+
         template<typename T, typename U>
         inline simd<U, 2> mask_ss(
             const simd<T, 2>& conditions,
@@ -608,6 +899,34 @@ namespace tue
             return result;
         }
 
+        template<typename T>
+        inline std::uint64_t movemask_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return (sdata[0] ? 1u : 0u) | (sdata[1] ? 2u : 0u);
+        }
+
+        template<int I0, int I1, typename T>
+        inline simd<T, 2> shuffle_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return simd<T, 2>(sdata[I0], sdata[I1]);
+        }
+
+        template<typename T>
+        inline simd<T, 2> unpack_lo_ss(
+            const simd<T, 2>& s1, const simd<T, 2>& s2) noexcept
+        {
+            return simd<T, 2>(s1.data()[0], s2.data()[0]);
+        }
+
+        template<typename T>
+        inline simd<T, 2> unpack_hi_ss(
+            const simd<T, 2>& s1, const simd<T, 2>& s2) noexcept
+        {
+            return simd<T, 2>(s1.data()[1], s2.data()[1]);
+        }
+
         template<typename T>
         inline simd<sized_bool_t<sizeof(T)>, 2> less_ss(
             const simd<T, 2>& lhs, const simd<T, 2>& rhs) noexcept
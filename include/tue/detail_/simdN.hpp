@@ -8,11 +8,61 @@
 
 #pragma once
 
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
 #include "../simd.hpp"
 #include "../sized_bool.hpp"
 
 namespace tue
 {
+    // Declared ahead of their definitions in simd.hpp so the functions below
+    // reach the accelerated overloads for their halves, which are only
+    // defined later.
+
+    template<int... I, typename T, int N>
+    inline simd<T, N> shuffle(const simd<T, N>& s) noexcept;
+
+    template<typename T, int N>
+    inline simd<T, N> unpack_lo(
+        const simd<T, N>& s1, const simd<T, N>& s2) noexcept;
+
+    template<typename T, int N>
+    inline simd<T, N> unpack_hi(
+        const simd<T, N>& s1, const simd<T, N>& s2) noexcept;
+
+    namespace math
+    {
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, simd<T, N>>
+        min(const simd<T, N>& s1, const simd<T, N>& s2) noexcept;
+
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, simd<T, N>>
+        max(const simd<T, N>& s1, const simd<T, N>& s2) noexcept;
+
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        hsum(const simd<T, N>& s) noexcept;
+
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        hprod(const simd<T, N>& s) noexcept;
+
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        hmin(const simd<T, N>& s) noexcept;
+
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        hmax(const simd<T, N>& s) noexcept;
+
+        template<typename T, int N>
+        inline std::enable_if_t<is_sized_bool<T>::value, std::uint64_t>
+        movemask(const simd<T, N>& s) noexcept;
+    }
+
     namespace detail_
     {
         template<typename T, int N>
@@ -429,6 +479,98 @@ namespace tue
             tue::detail_::sincos_s(simpl[1], sout[1], cout[1]);
         }
 
+        template<typename T, int N>
+        inline simd<T, N> sin_accurate_s(const simd<T, N>& s) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            rimpl[0] = tue::detail_::sin_accurate_s(simpl[0]);
+            rimpl[1] = tue::detail_::sin_accurate_s(simpl[1]);
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> cos_accurate_s(const simd<T, N>& s) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            rimpl[0] = tue::detail_::cos_accurate_s(simpl[0]);
+            rimpl[1] = tue::detail_::cos_accurate_s(simpl[1]);
+            return result;
+        }
+
+        template<typename T, int N>
+        inline void sincos_accurate_s(
+            const simd<T, N>& s,
+            simd<T, N>& sin_out,
+            simd<T, N>& cos_out) noexcept
+        {
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            const auto sout = reinterpret_cast<simd<T, N/2>*>(&sin_out);
+            const auto cout = reinterpret_cast<simd<T, N/2>*>(&cos_out);
+            tue::detail_::sincos_accurate_s(simpl[0], sout[0], cout[0]);
+            tue::detail_::sincos_accurate_s(simpl[1], sout[1], cout[1]);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> tan_s(const simd<T, N>& s) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            rimpl[0] = tue::detail_::tan_s(simpl[0]);
+            rimpl[1] = tue::detail_::tan_s(simpl[1]);
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> asin_s(const simd<T, N>& s) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            rimpl[0] = tue::detail_::asin_s(simpl[0]);
+            rimpl[1] = tue::detail_::asin_s(simpl[1]);
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> acos_s(const simd<T, N>& s) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            rimpl[0] = tue::detail_::acos_s(simpl[0]);
+            rimpl[1] = tue::detail_::acos_s(simpl[1]);
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> atan_s(const simd<T, N>& s) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            rimpl[0] = tue::detail_::atan_s(simpl[0]);
+            rimpl[1] = tue::detail_::atan_s(simpl[1]);
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> atan2_ss(
+            const simd<T, N>& y, const simd<T, N>& x) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto yimpl = reinterpret_cast<const simd<T, N/2>*>(&y);
+            const auto ximpl = reinterpret_cast<const simd<T, N/2>*>(&x);
+            rimpl[0] = tue::detail_::atan2_ss(yimpl[0], ximpl[0]);
+            rimpl[1] = tue::detail_::atan2_ss(yimpl[1], ximpl[1]);
+            return result;
+        }
+
         template<typename T, int N>
         inline simd<T, N> exp_s(const simd<T, N>& s) noexcept
         {
@@ -451,6 +593,28 @@ namespace tue
             return result;
         }
 
+        template<typename T, int N>
+        inline simd<T, N> exp2_s(const simd<T, N>& s) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            rimpl[0] = tue::detail_::exp2_s(simpl[0]);
+            rimpl[1] = tue::detail_::exp2_s(simpl[1]);
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> log2_s(const simd<T, N>& s) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            rimpl[0] = tue::detail_::log2_s(simpl[0]);
+            rimpl[1] = tue::detail_::log2_s(simpl[1]);
+            return result;
+        }
+
         template<typename T, int N>
         inline simd<T, N> abs_s(const simd<T, N>& s) noexcept
         {
@@ -490,6 +654,28 @@ namespace tue
             return result;
         }
 
+        template<typename T, int N>
+        inline simd<T, N> recip_fast_s(const simd<T, N>& s) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            rimpl[0] = tue::detail_::recip_fast_s(simpl[0]);
+            rimpl[1] = tue::detail_::recip_fast_s(simpl[1]);
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> recip_exact_s(const simd<T, N>& s) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            rimpl[0] = tue::detail_::recip_exact_s(simpl[0]);
+            rimpl[1] = tue::detail_::recip_exact_s(simpl[1]);
+            return result;
+        }
+
         template<typename T, int N>
         inline simd<T, N> sqrt_s(const simd<T, N>& s) noexcept
         {
@@ -512,6 +698,28 @@ namespace tue
             return result;
         }
 
+        template<typename T, int N>
+        inline simd<T, N> rsqrt_fast_s(const simd<T, N>& s) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            rimpl[0] = tue::detail_::rsqrt_fast_s(simpl[0]);
+            rimpl[1] = tue::detail_::rsqrt_fast_s(simpl[1]);
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> rsqrt_exact_s(const simd<T, N>& s) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            rimpl[0] = tue::detail_::rsqrt_exact_s(simpl[0]);
+            rimpl[1] = tue::detail_::rsqrt_exact_s(simpl[1]);
+            return result;
+        }
+
         template<typename T, int N>
         inline simd<T, N> min_ss(
             const simd<T, N>& s1, const simd<T, N>& s2) noexcept
@@ -538,6 +746,34 @@ namespace tue
             return result;
         }
 
+        template<typename T, int N>
+        inline T hsum_s(const simd<T, N>& s) noexcept
+        {
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            return tue::math::hsum(simpl[0] + simpl[1]);
+        }
+
+        template<typename T, int N>
+        inline T hprod_s(const simd<T, N>& s) noexcept
+        {
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            return tue::math::hprod(simpl[0] * simpl[1]);
+        }
+
+        template<typename T, int N>
+        inline T hmin_s(const simd<T, N>& s) noexcept
+        {
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            return tue::math::hmin(tue::math::min(simpl[0], simpl[1]));
+        }
+
+        template<typename T, int N>
+        inline T hmax_s(const simd<T, N>& s) noexcept
+        {
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            return tue::math::hmax(tue::math::max(simpl[0], simpl[1]));
+        }
+
         template<typename T, typename U, int N>
         inline simd<U, N> mask_ss(
             const simd<T, N>& conditions,
@@ -577,6 +813,68 @@ namespace tue
             return result;
         }
 
+        template<typename T, int N>
+        inline std::uint64_t movemask_s(const simd<T, N>& s) noexcept
+        {
+            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
+            return tue::math::movemask(simpl[0])
+                | tue::math::movemask(simpl[1]) << (N/2);
+        }
+
+        template<int... I, typename T, int N>
+        inline simd<T, N> shuffle_s(const simd<T, N>& s) noexcept
+        {
+            const int indices[] = { I... };
+            simd<T, N> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            for (int i = 0; i < N; ++i)
+            {
+                rdata[i] = sdata[indices[i]];
+            }
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> unpack_lo_ss(
+            const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl1 = reinterpret_cast<const simd<T, N/2>*>(&s1);
+            const auto simpl2 = reinterpret_cast<const simd<T, N/2>*>(&s2);
+            rimpl[0] = tue::unpack_lo(simpl1[0], simpl2[0]);
+            rimpl[1] = tue::unpack_hi(simpl1[0], simpl2[0]);
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> unpack_hi_ss(
+            const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+        {
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
+            const auto simpl1 = reinterpret_cast<const simd<T, N/2>*>(&s1);
+            const auto simpl2 = reinterpret_cast<const simd<T, N/2>*>(&s2);
+            rimpl[0] = tue::unpack_lo(simpl1[1], simpl2[1]);
+            rimpl[1] = tue::unpack_hi(simpl1[1], simpl2[1]);
+            return result;
+        }
+
+        template<int K, typename T, int N, int... I>
+        inline simd<T, N> broadcast_s(
+            const simd<T, N>& s, std::integer_sequence<int, I...>) noexcept
+        {
+            return tue::shuffle<(I * 0 + K)...>(s);
+        }
+
+        template<int K, typename T, int N, int... I>
+        inline simd<T, N> rotate_s(
+            const simd<T, N>& s, std::integer_sequence<int, I...>) noexcept
+        {
+            return tue::shuffle<((I + K) % N + N) % N...>(s);
+        }
+
         template<typename T, int N>
         inline simd<sized_bool_t<sizeof(T)>, N> less_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
@@ -54,5 +54,38 @@ namespace tue
 #include "simd/sse2/uint32x4.sse2.hpp"
 #include "simd/sse2/uint64x2.sse2.hpp"
 
+// AVX
+#ifdef TUE_AVX
+#include "simd/avx/bool32x8.avx.hpp"
+#include "simd/avx/bool64x4.avx.hpp"
+#include "simd/avx/float32x8.avx.hpp"
+#include "simd/avx/float64x4.avx.hpp"
+
+#ifdef TUE_AVX2
+#include "simd/avx2/bool8x32.avx2.hpp"
+#include "simd/avx2/bool16x16.avx2.hpp"
+#include "simd/avx2/int8x32.avx2.hpp"
+#include "simd/avx2/int16x16.avx2.hpp"
+#include "simd/avx2/int32x8.avx2.hpp"
+#include "simd/avx2/int64x4.avx2.hpp"
+#include "simd/avx2/uint8x32.avx2.hpp"
+#include "simd/avx2/uint16x16.avx2.hpp"
+#include "simd/avx2/uint32x8.avx2.hpp"
+#include "simd/avx2/uint64x4.avx2.hpp"
+
+// AVX-512
+#ifdef TUE_AVX512
+#include "simd/avx512/bool32x16.avx512.hpp"
+#include "simd/avx512/bool64x8.avx512.hpp"
+#include "simd/avx512/float32x16.avx512.hpp"
+#include "simd/avx512/float64x8.avx512.hpp"
+#include "simd/avx512/int32x16.avx512.hpp"
+#include "simd/avx512/int64x8.avx512.hpp"
+#include "simd/avx512/uint32x16.avx512.hpp"
+#include "simd/avx512/uint64x8.avx512.hpp"
+#endif
+#endif
+#endif
+
 #endif
 #endif
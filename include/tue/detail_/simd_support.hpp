@@ -32,4 +32,44 @@
 #define TUE_SSE2
 #endif
 
+#if defined(__SSSE3__) || defined(__AVX__)
+/*!
+ * \brief Defined if the current compiler configuration supports SSSE3
+ *        intrinsics.
+ */
+#define TUE_SSSE3
+#endif
+
+#if defined(__SSE4_1__) || defined(__AVX__)
+/*!
+ * \brief Defined if the current compiler configuration supports SSE4.1
+ *        intrinsics.
+ */
+#define TUE_SSE41
+#endif
+
+#if defined(__AVX__)
+/*!
+ * \brief Defined if the current compiler configuration supports AVX
+ *        intrinsics.
+ */
+#define TUE_AVX
+#endif
+
+#if defined(__AVX2__)
+/*!
+ * \brief Defined if the current compiler configuration supports AVX2
+ *        intrinsics.
+ */
+#define TUE_AVX2
+#endif
+
+#if defined(__AVX512F__)
+/*!
+ * \brief Defined if the current compiler configuration supports AVX-512
+ *        Foundation intrinsics.
+ */
+#define TUE_AVX512
+#endif
+
 /*!@}*/
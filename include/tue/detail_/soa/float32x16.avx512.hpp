@@ -0,0 +1,171 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include "../../simd.hpp"
+#include "../../soa.hpp"
+#include "../../vec.hpp"
+
+// GCC's 512-bit cast, insert, extract and unpack intrinsics start from
+// _mm512_undefined_ps(), which -Wuninitialized and -Wmaybe-uninitialized
+// report wherever these conversions are inlined.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace tue
+{
+    namespace detail_
+    {
+        // Loads p[k*stride..k*stride+3] into 128-bit lane k. Each lane is
+        // then transposed the same way as in the float32x4 conversions, so
+        // lane k ends up with elements 4k to 4k+3.
+        inline __m512 soa_load_lanes_avx512(
+            const float* p, int stride) noexcept
+        {
+            auto result = _mm512_castps128_ps512(_mm_loadu_ps(p));
+            result = _mm512_insertf32x4(
+                result, _mm_loadu_ps(p + stride), 1);
+            result = _mm512_insertf32x4(
+                result, _mm_loadu_ps(p + 2*stride), 2);
+            return _mm512_insertf32x4(
+                result, _mm_loadu_ps(p + 3*stride), 3);
+        }
+
+        inline void soa_store_lanes_avx512(
+            float* p, int stride, const __m512& v) noexcept
+        {
+            _mm_storeu_ps(p, _mm512_castps512_ps128(v));
+            _mm_storeu_ps(p + stride, _mm512_extractf32x4_ps(v, 1));
+            _mm_storeu_ps(p + 2*stride, _mm512_extractf32x4_ps(v, 2));
+            _mm_storeu_ps(p + 3*stride, _mm512_extractf32x4_ps(v, 3));
+        }
+
+        template<>
+        struct soa_s<float, 16, 2>
+        {
+            static vec2<float32x16> load(const vec2<float>* src) noexcept
+            {
+                const auto p = reinterpret_cast<const float*>(src);
+                const auto m0 = soa_load_lanes_avx512(p + 0, 8);
+                const auto m1 = soa_load_lanes_avx512(p + 4, 8);
+                return {
+                    _mm512_shuffle_ps(m0, m1, _MM_SHUFFLE(2, 0, 2, 0)),
+                    _mm512_shuffle_ps(m0, m1, _MM_SHUFFLE(3, 1, 3, 1)),
+                };
+            }
+
+            static void store(
+                const vec2<float32x16>& src, vec2<float>* dst) noexcept
+            {
+                const auto p = reinterpret_cast<float*>(dst);
+                const __m512 x = src[0];
+                const __m512 y = src[1];
+                soa_store_lanes_avx512(p + 0, 8, _mm512_unpacklo_ps(x, y));
+                soa_store_lanes_avx512(p + 4, 8, _mm512_unpackhi_ps(x, y));
+            }
+        };
+
+        template<>
+        struct soa_s<float, 16, 3>
+        {
+            static vec3<float32x16> load(const vec3<float>* src) noexcept
+            {
+                const auto p = reinterpret_cast<const float*>(src);
+                const auto m0 = soa_load_lanes_avx512(p + 0, 12);
+                const auto m1 = soa_load_lanes_avx512(p + 4, 12);
+                const auto m2 = soa_load_lanes_avx512(p + 8, 12);
+                return {
+                    _mm512_shuffle_ps(
+                        m0,
+                        _mm512_shuffle_ps(m1, m2, _MM_SHUFFLE(1, 1, 2, 2)),
+                        _MM_SHUFFLE(2, 0, 3, 0)),
+                    _mm512_shuffle_ps(
+                        _mm512_shuffle_ps(m0, m1, _MM_SHUFFLE(0, 0, 1, 1)),
+                        _mm512_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 2, 3, 3)),
+                        _MM_SHUFFLE(2, 0, 2, 0)),
+                    _mm512_shuffle_ps(
+                        _mm512_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 1, 2, 2)),
+                        m2,
+                        _MM_SHUFFLE(3, 0, 2, 0)),
+                };
+            }
+
+            static void store(
+                const vec3<float32x16>& src, vec3<float>* dst) noexcept
+            {
+                const auto p = reinterpret_cast<float*>(dst);
+                const __m512 x = src[0];
+                const __m512 y = src[1];
+                const __m512 z = src[2];
+                soa_store_lanes_avx512(p + 0, 12, _mm512_shuffle_ps(
+                    _mm512_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+                    _mm512_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)),
+                    _MM_SHUFFLE(2, 0, 2, 0)));
+                soa_store_lanes_avx512(p + 4, 12, _mm512_shuffle_ps(
+                    _mm512_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+                    _mm512_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)),
+                    _MM_SHUFFLE(2, 0, 2, 0)));
+                soa_store_lanes_avx512(p + 8, 12, _mm512_shuffle_ps(
+                    _mm512_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+                    _mm512_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)),
+                    _MM_SHUFFLE(2, 0, 2, 0)));
+            }
+        };
+
+        template<>
+        struct soa_s<float, 16, 4>
+        {
+            static vec4<float32x16> load(const vec4<float>* src) noexcept
+            {
+                const auto p = reinterpret_cast<const float*>(src);
+                const auto m0 = soa_load_lanes_avx512(p + 0, 16);
+                const auto m1 = soa_load_lanes_avx512(p + 4, 16);
+                const auto m2 = soa_load_lanes_avx512(p + 8, 16);
+                const auto m3 = soa_load_lanes_avx512(p + 12, 16);
+                const auto t0 = _mm512_unpacklo_ps(m0, m1);
+                const auto t1 = _mm512_unpacklo_ps(m2, m3);
+                const auto t2 = _mm512_unpackhi_ps(m0, m1);
+                const auto t3 = _mm512_unpackhi_ps(m2, m3);
+                return {
+                    _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0)),
+                    _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2)),
+                    _mm512_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0)),
+                    _mm512_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2)),
+                };
+            }
+
+            static void store(
+                const vec4<float32x16>& src, vec4<float>* dst) noexcept
+            {
+                const auto p = reinterpret_cast<float*>(dst);
+                const auto t0 = _mm512_unpacklo_ps(src[0], src[1]);
+                const auto t1 = _mm512_unpacklo_ps(src[2], src[3]);
+                const auto t2 = _mm512_unpackhi_ps(src[0], src[1]);
+                const auto t3 = _mm512_unpackhi_ps(src[2], src[3]);
+                soa_store_lanes_avx512(p + 0, 16,
+                    _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0)));
+                soa_store_lanes_avx512(p + 4, 16,
+                    _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2)));
+                soa_store_lanes_avx512(p + 8, 16,
+                    _mm512_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0)));
+                soa_store_lanes_avx512(p + 12, 16,
+                    _mm512_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2)));
+            }
+        };
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
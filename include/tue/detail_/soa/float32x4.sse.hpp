@@ -0,0 +1,123 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <xmmintrin.h>
+
+#include "../../simd.hpp"
+#include "../../soa.hpp"
+#include "../../vec.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        template<>
+        struct soa_s<float, 4, 2>
+        {
+            static vec2<float32x4> load(const vec2<float>* src) noexcept
+            {
+                const auto p = reinterpret_cast<const float*>(src);
+                const auto m0 = _mm_loadu_ps(p + 0); // x0 y0 x1 y1
+                const auto m1 = _mm_loadu_ps(p + 4); // x2 y2 x3 y3
+                return {
+                    _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(2, 0, 2, 0)),
+                    _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(3, 1, 3, 1)),
+                };
+            }
+
+            static void store(
+                const vec2<float32x4>& src, vec2<float>* dst) noexcept
+            {
+                const auto p = reinterpret_cast<float*>(dst);
+                const __m128 x = src[0];
+                const __m128 y = src[1];
+                _mm_storeu_ps(p + 0, _mm_unpacklo_ps(x, y));
+                _mm_storeu_ps(p + 4, _mm_unpackhi_ps(x, y));
+            }
+        };
+
+        template<>
+        struct soa_s<float, 4, 3>
+        {
+            static vec3<float32x4> load(const vec3<float>* src) noexcept
+            {
+                const auto p = reinterpret_cast<const float*>(src);
+                const auto m0 = _mm_loadu_ps(p + 0); // x0 y0 z0 x1
+                const auto m1 = _mm_loadu_ps(p + 4); // y1 z1 x2 y2
+                const auto m2 = _mm_loadu_ps(p + 8); // z2 x3 y3 z3
+                return {
+                    _mm_shuffle_ps(
+                        m0,
+                        _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(1, 1, 2, 2)),
+                        _MM_SHUFFLE(2, 0, 3, 0)),
+                    _mm_shuffle_ps(
+                        _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(0, 0, 1, 1)),
+                        _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 2, 3, 3)),
+                        _MM_SHUFFLE(2, 0, 2, 0)),
+                    _mm_shuffle_ps(
+                        _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 1, 2, 2)),
+                        m2,
+                        _MM_SHUFFLE(3, 0, 2, 0)),
+                };
+            }
+
+            static void store(
+                const vec3<float32x4>& src, vec3<float>* dst) noexcept
+            {
+                const auto p = reinterpret_cast<float*>(dst);
+                const __m128 x = src[0];
+                const __m128 y = src[1];
+                const __m128 z = src[2];
+                _mm_storeu_ps(p + 0, _mm_shuffle_ps(
+                    _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+                    _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)),
+                    _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm_storeu_ps(p + 4, _mm_shuffle_ps(
+                    _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+                    _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)),
+                    _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm_storeu_ps(p + 8, _mm_shuffle_ps(
+                    _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+                    _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)),
+                    _MM_SHUFFLE(2, 0, 2, 0)));
+            }
+        };
+
+        template<>
+        struct soa_s<float, 4, 4>
+        {
+            static vec4<float32x4> load(const vec4<float>* src) noexcept
+            {
+                const auto p = reinterpret_cast<const float*>(src);
+                auto m0 = _mm_loadu_ps(p + 0);
+                auto m1 = _mm_loadu_ps(p + 4);
+                auto m2 = _mm_loadu_ps(p + 8);
+                auto m3 = _mm_loadu_ps(p + 12);
+                _MM_TRANSPOSE4_PS(m0, m1, m2, m3);
+                return { m0, m1, m2, m3 };
+            }
+
+            static void store(
+                const vec4<float32x4>& src, vec4<float>* dst) noexcept
+            {
+                const auto p = reinterpret_cast<float*>(dst);
+                __m128 m0 = src[0];
+                __m128 m1 = src[1];
+                __m128 m2 = src[2];
+                __m128 m3 = src[3];
+                _MM_TRANSPOSE4_PS(m0, m1, m2, m3);
+                _mm_storeu_ps(p + 0, m0);
+                _mm_storeu_ps(p + 4, m1);
+                _mm_storeu_ps(p + 8, m2);
+                _mm_storeu_ps(p + 12, m3);
+            }
+        };
+    }
+}
@@ -0,0 +1,153 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include "../../simd.hpp"
+#include "../../soa.hpp"
+#include "../../vec.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        // Loads p[0..3] into the low lane and p[offset..offset+3] into the
+        // high lane. Each lane is then transposed the same way as in the
+        // float32x4 conversions, so lane 0 ends up with elements 0-3 and
+        // lane 1 with elements 4-7.
+        inline __m256 soa_load_lanes_avx(
+            const float* p, int offset) noexcept
+        {
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm_loadu_ps(p)),
+                _mm_loadu_ps(p + offset), 1);
+        }
+
+        inline void soa_store_lanes_avx(
+            float* p, int offset, const __m256& v) noexcept
+        {
+            _mm_storeu_ps(p, _mm256_castps256_ps128(v));
+            _mm_storeu_ps(p + offset, _mm256_extractf128_ps(v, 1));
+        }
+
+        template<>
+        struct soa_s<float, 8, 2>
+        {
+            static vec2<float32x8> load(const vec2<float>* src) noexcept
+            {
+                const auto p = reinterpret_cast<const float*>(src);
+                const auto m0 = soa_load_lanes_avx(p + 0, 8);
+                const auto m1 = soa_load_lanes_avx(p + 4, 8);
+                return {
+                    _mm256_shuffle_ps(m0, m1, _MM_SHUFFLE(2, 0, 2, 0)),
+                    _mm256_shuffle_ps(m0, m1, _MM_SHUFFLE(3, 1, 3, 1)),
+                };
+            }
+
+            static void store(
+                const vec2<float32x8>& src, vec2<float>* dst) noexcept
+            {
+                const auto p = reinterpret_cast<float*>(dst);
+                const __m256 x = src[0];
+                const __m256 y = src[1];
+                soa_store_lanes_avx(p + 0, 8, _mm256_unpacklo_ps(x, y));
+                soa_store_lanes_avx(p + 4, 8, _mm256_unpackhi_ps(x, y));
+            }
+        };
+
+        template<>
+        struct soa_s<float, 8, 3>
+        {
+            static vec3<float32x8> load(const vec3<float>* src) noexcept
+            {
+                const auto p = reinterpret_cast<const float*>(src);
+                const auto m0 = soa_load_lanes_avx(p + 0, 12);
+                const auto m1 = soa_load_lanes_avx(p + 4, 12);
+                const auto m2 = soa_load_lanes_avx(p + 8, 12);
+                return {
+                    _mm256_shuffle_ps(
+                        m0,
+                        _mm256_shuffle_ps(m1, m2, _MM_SHUFFLE(1, 1, 2, 2)),
+                        _MM_SHUFFLE(2, 0, 3, 0)),
+                    _mm256_shuffle_ps(
+                        _mm256_shuffle_ps(m0, m1, _MM_SHUFFLE(0, 0, 1, 1)),
+                        _mm256_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 2, 3, 3)),
+                        _MM_SHUFFLE(2, 0, 2, 0)),
+                    _mm256_shuffle_ps(
+                        _mm256_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 1, 2, 2)),
+                        m2,
+                        _MM_SHUFFLE(3, 0, 2, 0)),
+                };
+            }
+
+            static void store(
+                const vec3<float32x8>& src, vec3<float>* dst) noexcept
+            {
+                const auto p = reinterpret_cast<float*>(dst);
+                const __m256 x = src[0];
+                const __m256 y = src[1];
+                const __m256 z = src[2];
+                soa_store_lanes_avx(p + 0, 12, _mm256_shuffle_ps(
+                    _mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+                    _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)),
+                    _MM_SHUFFLE(2, 0, 2, 0)));
+                soa_store_lanes_avx(p + 4, 12, _mm256_shuffle_ps(
+                    _mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+                    _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)),
+                    _MM_SHUFFLE(2, 0, 2, 0)));
+                soa_store_lanes_avx(p + 8, 12, _mm256_shuffle_ps(
+                    _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+                    _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)),
+                    _MM_SHUFFLE(2, 0, 2, 0)));
+            }
+        };
+
+        template<>
+        struct soa_s<float, 8, 4>
+        {
+            static vec4<float32x8> load(const vec4<float>* src) noexcept
+            {
+                const auto p = reinterpret_cast<const float*>(src);
+                const auto m0 = soa_load_lanes_avx(p + 0, 16);
+                const auto m1 = soa_load_lanes_avx(p + 4, 16);
+                const auto m2 = soa_load_lanes_avx(p + 8, 16);
+                const auto m3 = soa_load_lanes_avx(p + 12, 16);
+                const auto t0 = _mm256_unpacklo_ps(m0, m1);
+                const auto t1 = _mm256_unpacklo_ps(m2, m3);
+                const auto t2 = _mm256_unpackhi_ps(m0, m1);
+                const auto t3 = _mm256_unpackhi_ps(m2, m3);
+                return {
+                    _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0)),
+                    _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2)),
+                    _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0)),
+                    _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2)),
+                };
+            }
+
+            static void store(
+                const vec4<float32x8>& src, vec4<float>* dst) noexcept
+            {
+                const auto p = reinterpret_cast<float*>(dst);
+                const auto t0 = _mm256_unpacklo_ps(src[0], src[1]);
+                const auto t1 = _mm256_unpacklo_ps(src[2], src[3]);
+                const auto t2 = _mm256_unpackhi_ps(src[0], src[1]);
+                const auto t3 = _mm256_unpackhi_ps(src[2], src[3]);
+                soa_store_lanes_avx(p + 0, 16,
+                    _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0)));
+                soa_store_lanes_avx(p + 4, 16,
+                    _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2)));
+                soa_store_lanes_avx(p + 8, 16,
+                    _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0)));
+                soa_store_lanes_avx(p + 12, 16,
+                    _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2)));
+            }
+        };
+    }
+}
@@ -838,6 +838,52 @@ namespace tue
             tue::math::sincos(v[1], sin_out[1], cos_out[1]);
         }
 
+        template<typename T>
+        inline vec<T, 2> tan_v(const vec<T, 2>& v) noexcept
+        {
+            return {
+                tue::math::tan(v[0]),
+                tue::math::tan(v[1]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 2> asin_v(const vec<T, 2>& v) noexcept
+        {
+            return {
+                tue::math::asin(v[0]),
+                tue::math::asin(v[1]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 2> acos_v(const vec<T, 2>& v) noexcept
+        {
+            return {
+                tue::math::acos(v[0]),
+                tue::math::acos(v[1]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 2> atan_v(const vec<T, 2>& v) noexcept
+        {
+            return {
+                tue::math::atan(v[0]),
+                tue::math::atan(v[1]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 2> atan2_vv(
+            const vec<T, 2>& y, const vec<T, 2>& x) noexcept
+        {
+            return {
+                tue::math::atan2(y[0], x[0]),
+                tue::math::atan2(y[1], x[1]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 2> exp_v(const vec<T, 2>& v) noexcept
         {
@@ -856,6 +902,24 @@ namespace tue
             };
         }
 
+        template<typename T>
+        inline vec<T, 2> exp2_v(const vec<T, 2>& v) noexcept
+        {
+            return {
+                tue::math::exp2(v[0]),
+                tue::math::exp2(v[1]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 2> log2_v(const vec<T, 2>& v) noexcept
+        {
+            return {
+                tue::math::log2(v[0]),
+                tue::math::log2(v[1]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 2> abs_v(const vec<T, 2>& v) noexcept
         {
@@ -999,6 +999,57 @@ namespace tue
             tue::math::sincos(v[2], sin_out[2], cos_out[2]);
         }
 
+        template<typename T>
+        inline vec<T, 3> tan_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::tan(v[0]),
+                tue::math::tan(v[1]),
+                tue::math::tan(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> asin_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::asin(v[0]),
+                tue::math::asin(v[1]),
+                tue::math::asin(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> acos_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::acos(v[0]),
+                tue::math::acos(v[1]),
+                tue::math::acos(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> atan_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::atan(v[0]),
+                tue::math::atan(v[1]),
+                tue::math::atan(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> atan2_vv(
+            const vec<T, 3>& y, const vec<T, 3>& x) noexcept
+        {
+            return {
+                tue::math::atan2(y[0], x[0]),
+                tue::math::atan2(y[1], x[1]),
+                tue::math::atan2(y[2], x[2]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 3> exp_v(const vec<T, 3>& v) noexcept
         {
@@ -1019,6 +1070,26 @@ namespace tue
             };
         }
 
+        template<typename T>
+        inline vec<T, 3> exp2_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::exp2(v[0]),
+                tue::math::exp2(v[1]),
+                tue::math::exp2(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> log2_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::log2(v[0]),
+                tue::math::log2(v[1]),
+                tue::math::log2(v[2]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 3> abs_v(const vec<T, 3>& v) noexcept
         {
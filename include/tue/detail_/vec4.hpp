@@ -1168,6 +1168,62 @@ namespace tue
             tue::math::sincos(v[3], sin_out[3], cos_out[3]);
         }
 
+        template<typename T>
+        inline vec<T, 4> tan_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::tan(v[0]),
+                tue::math::tan(v[1]),
+                tue::math::tan(v[2]),
+                tue::math::tan(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> asin_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::asin(v[0]),
+                tue::math::asin(v[1]),
+                tue::math::asin(v[2]),
+                tue::math::asin(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> acos_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::acos(v[0]),
+                tue::math::acos(v[1]),
+                tue::math::acos(v[2]),
+                tue::math::acos(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> atan_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::atan(v[0]),
+                tue::math::atan(v[1]),
+                tue::math::atan(v[2]),
+                tue::math::atan(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> atan2_vv(
+            const vec<T, 4>& y, const vec<T, 4>& x) noexcept
+        {
+            return {
+                tue::math::atan2(y[0], x[0]),
+                tue::math::atan2(y[1], x[1]),
+                tue::math::atan2(y[2], x[2]),
+                tue::math::atan2(y[3], x[3]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 4> exp_v(const vec<T, 4>& v) noexcept
         {
@@ -1190,6 +1246,28 @@ namespace tue
             };
         }
 
+        template<typename T>
+        inline vec<T, 4> exp2_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::exp2(v[0]),
+                tue::math::exp2(v[1]),
+                tue::math::exp2(v[2]),
+                tue::math::exp2(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> log2_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::log2(v[0]),
+                tue::math::log2(v[1]),
+                tue::math::log2(v[2]),
+                tue::math::log2(v[3]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 4> abs_v(const vec<T, 4>& v) noexcept
         {
@@ -0,0 +1,517 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "mat.hpp"
+#include "math.hpp"
+#include "quat.hpp"
+#include "simd.hpp"
+#include "transform.hpp"
+#include "vec.hpp"
+
+namespace tue
+{
+    namespace detail_
+    {
+        // quat only defines the products it needs for rotations, so the
+        // component-wise arithmetic of dual quaternions lives here.
+
+        template<typename T>
+        inline constexpr T dot_qq(
+            const quat<T>& lhs, const quat<T>& rhs) noexcept
+        {
+            return lhs[0]*rhs[0] + lhs[1]*rhs[1]
+                 + lhs[2]*rhs[2] + lhs[3]*rhs[3];
+        }
+
+        template<typename T>
+        inline constexpr quat<T> add_qq(
+            const quat<T>& lhs, const quat<T>& rhs) noexcept
+        {
+            return {
+                lhs[0] + rhs[0],
+                lhs[1] + rhs[1],
+                lhs[2] + rhs[2],
+                lhs[3] + rhs[3],
+            };
+        }
+
+        template<typename T>
+        inline constexpr quat<T> mul_qs(const quat<T>& q, const T& s) noexcept
+        {
+            return { q[0] * s, q[1] * s, q[2] * s, q[3] * s };
+        }
+    }
+
+    /*!
+     * \defgroup  dual_quat_hpp <tue/dual_quat.hpp>
+     *
+     * \brief     The `dual_quat` class template and its associated functions.
+     *
+     * @{
+     */
+
+    /*!
+     * \brief     A unit dual quaternion representing a rigid transformation.
+     * \details   `dual_quat` has the same size and alignment requirements as
+     *            `T[8]`. The real part is the rotation and the dual part is
+     *            half the translation times the rotation. A `dual_quat`
+     *            built from rotation `q` and translation `t` transforms a
+     *            point the same way as
+     *            `transform::rotation_mat(q) * transform::translation_mat(t)`.
+     *
+     *            `T` may be a `simd` type such as `float32x4` or `float32x8`,
+     *            in which case each lane holds a separate transformation.
+     *            None of the functions below branch on component values, so
+     *            `math::blend()` skins one vertex per lane.
+     *
+     * \tparam T  The component type. `is_vec_component<T>::value` must be
+     *            `true`.
+     */
+    template<typename T>
+    class dual_quat;
+
+    /*!
+     * \brief  A `dual_quat` with `float` components.
+     */
+    using fdual_quat = dual_quat<float>;
+
+    /*!
+     * \brief  A `dual_quat` with `double` components.
+     */
+    using ddual_quat = dual_quat<double>;
+
+    /**/
+    template<typename T>
+    class dual_quat
+    {
+        quat<T> real_;
+
+        quat<T> dual_;
+
+    public:
+        /*!
+         * \brief  This `dual_quat` type's component type.
+         */
+        using component_type = T;
+
+        /*!
+         * \name Constructors, Conversions, and Factory Functions
+         * @{
+         */
+        /*!
+         * \brief  Default constructs each component.
+         */
+        dual_quat() noexcept = default;
+
+        /*!
+         * \brief       Constructs a `dual_quat` from its real and dual parts.
+         *
+         * \param real  The real part.
+         * \param dual  The dual part.
+         */
+        constexpr dual_quat(
+            const quat<T>& real,
+            const quat<T>& dual) noexcept
+        :
+            real_(real),
+            dual_(dual)
+        {
+        }
+
+        /*!
+         * \brief              Constructs a `dual_quat` that rotates by
+         *                     `rotation` and then translates by
+         *                     `translation`.
+         *
+         * \param rotation     A unit rotation `quat`.
+         * \param translation  The translation.
+         */
+        constexpr dual_quat(
+            const quat<T>& rotation,
+            const vec3<T>& translation) noexcept
+        :
+            real_(rotation),
+            dual_(
+                T(0.5) * (rotation.s()*translation
+                    + tue::math::cross(translation, rotation.v())),
+                T(-0.5) * tue::math::dot(translation, rotation.v()))
+        {
+        }
+
+        /*!
+         * \brief    Explicitly casts a `mat<T, 4, 4>` to a `dual_quat`.
+         * \details  The upper 3x3 block of `m` must be a rotation matrix and
+         *           its last row is the translation, as produced by
+         *           <tue/transform.hpp>. The last column is ignored.
+         *
+         * \param m  The matrix to cast from.
+         */
+        explicit dual_quat(const mat<T, 4, 4>& m) noexcept
+        :
+            dual_quat(
+                rotation_from(m),
+                vec3<T>(m[0][3], m[1][3], m[2][3]))
+        {
+        }
+
+        /*!
+         * \brief     Explicitly casts another `dual_quat` to a new component
+         *            type.
+         *
+         * \tparam U  The component type of `dq`.
+         *
+         * \param dq  The `dual_quat` to cast from.
+         */
+        template<typename U>
+        explicit constexpr dual_quat(const dual_quat<U>& dq) noexcept
+        :
+            real_(dq.real()),
+            dual_(dq.dual())
+        {
+        }
+
+        /*!
+         * \brief   Returns the identity transformation.
+         *
+         * \return  The identity transformation.
+         */
+        static constexpr dual_quat<T> identity() noexcept
+        {
+            return {
+                quat<T>::identity(),
+                quat<T>(T(0), T(0), T(0), T(0)),
+            };
+        }
+
+        /*!@}*/
+        /*!
+         * \brief   Returns a copy of this `dual_quat`'s real part.
+         *
+         * \return  A copy of this `dual_quat`'s real part.
+         */
+        constexpr quat<T> real() const noexcept
+        {
+            return this->real_;
+        }
+
+        /*!
+         * \brief   Returns a copy of this `dual_quat`'s dual part.
+         *
+         * \return  A copy of this `dual_quat`'s dual part.
+         */
+        constexpr quat<T> dual() const noexcept
+        {
+            return this->dual_;
+        }
+
+        /*!
+         * \brief   Returns this `dual_quat`'s rotation.
+         *
+         * \return  The same as `real()`.
+         */
+        constexpr quat<T> rotation() const noexcept
+        {
+            return this->real_;
+        }
+
+        /*!
+         * \brief   Returns this `dual_quat`'s translation.
+         *
+         * \return  The translation applied after the rotation.
+         */
+        constexpr vec3<T> translation() const noexcept
+        {
+            const auto d = tue::math::conjugate(this->real_) * this->dual_;
+            return T(2) * d.v();
+        }
+
+        /*!
+         * \brief   Returns this `dual_quat` as a `mat<T, 4, 4>`.
+         *
+         * \return  The rotation matrix of `rotation()` with `translation()`
+         *          in its last row.
+         */
+        mat<T, 4, 4> to_mat4x4() const noexcept
+        {
+            const auto r = tue::transform::rotation_mat<T, 3, 3>(this->real_);
+            const auto t = this->translation();
+            return {
+                vec4<T>(r[0], t[0]),
+                vec4<T>(r[1], t[1]),
+                vec4<T>(r[2], t[2]),
+                vec4<T>(T(0), T(0), T(0), T(1)),
+            };
+        }
+
+        /*!
+         * \brief       Sets this `dual_quat`'s real part.
+         *
+         * \param real  The new real part.
+         */
+        void set_real(const quat<T>& real) noexcept
+        {
+            this->real_ = real;
+        }
+
+        /*!
+         * \brief       Sets this `dual_quat`'s dual part.
+         *
+         * \param dual  The new dual part.
+         */
+        void set_dual(const quat<T>& dual) noexcept
+        {
+            this->dual_ = dual;
+        }
+
+        /*!
+         * \brief     Composes this `dual_quat` with `dq`.
+         * \details   The operand order might be the opposite of what you expect
+         *            from other libraries. This library generally prefers
+         *            compound transformations be written from left-to-right
+         *            instead of right-to-left.
+         *
+         * \tparam U  The component type of `dq`.
+         *
+         * \param dq  The transformation to apply after this one.
+         *
+         * \return    A reference to this `dual_quat`.
+         */
+        template<typename U>
+        dual_quat<T>& operator*=(const dual_quat<U>& dq) noexcept
+        {
+            return (*this) = (*this) * dq;
+        }
+
+    private:
+        // Shepperd's method: the largest of 4ww, 4xx, 4yy and 4zz is picked
+        // with selects instead of branches so simd lanes can disagree.
+        static quat<T> rotation_from(const mat<T, 4, 4>& m) noexcept
+        {
+            const auto tw = T(1) + m[0][0] + m[1][1] + m[2][2];
+            const auto tx = T(1) + m[0][0] - m[1][1] - m[2][2];
+            const auto ty = T(1) - m[0][0] + m[1][1] - m[2][2];
+            const auto tz = T(1) - m[0][0] - m[1][1] + m[2][2];
+            const auto xy = m[1][0] + m[0][1];
+            const auto xz = m[0][2] + m[2][0];
+            const auto yz = m[2][1] + m[1][2];
+            const auto xw = m[2][1] - m[1][2];
+            const auto yw = m[0][2] - m[2][0];
+            const auto zw = m[1][0] - m[0][1];
+
+            using M = decltype(tue::math::less(tw, tx));
+            auto t = tw;
+            auto q = vec4<T>(xw, yw, zw, tw);
+            auto pick = tue::math::less(t, tx);
+            t = tue::math::select(pick, tx, t);
+            q = tue::math::select(vec4<M>(pick), vec4<T>(tx, xy, xz, xw), q);
+            pick = tue::math::less(t, ty);
+            t = tue::math::select(pick, ty, t);
+            q = tue::math::select(vec4<M>(pick), vec4<T>(xy, ty, yz, yw), q);
+            pick = tue::math::less(t, tz);
+            t = tue::math::select(pick, tz, t);
+            q = tue::math::select(vec4<M>(pick), vec4<T>(xz, yz, tz, zw), q);
+            return quat<T>(q * (T(0.5) * tue::math::rsqrt(t)));
+        }
+    };
+
+    /*!
+     * \brief      Composes `lhs` and `rhs`.
+     * \details    The result transforms a point the same way as transforming
+     *             it by `lhs` and then by `rhs`.
+     *
+     * \tparam T   The component type of `lhs`.
+     * \tparam U   The component type of `rhs`.
+     *
+     * \param lhs  The first transformation.
+     * \param rhs  The second transformation.
+     *
+     * \return     The composition of `lhs` and `rhs`.
+     */
+    template<typename T, typename U>
+    inline constexpr
+        dual_quat<decltype(std::declval<T>() * std::declval<U>())>
+    operator*(const dual_quat<T>& lhs, const dual_quat<U>& rhs) noexcept
+    {
+        return {
+            lhs.real() * rhs.real(),
+            tue::detail_::add_qq(
+                lhs.real() * rhs.dual(),
+                lhs.dual() * rhs.real()),
+        };
+    }
+
+    /*!
+     * \brief      Determines whether or not two `dual_quat`'s compare equal.
+     *
+     * \tparam T   The component type of `lhs`.
+     * \tparam U   The component type of `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `true` if all the corresponding pairs of components compare
+     *             equal and `false` otherwise.
+     */
+    template<typename T, typename U>
+    inline constexpr bool
+    operator==(const dual_quat<T>& lhs, const dual_quat<U>& rhs) noexcept
+    {
+        return lhs.real() == rhs.real() && lhs.dual() == rhs.dual();
+    }
+
+    /*!
+     * \brief      Determines whether or not two `dual_quat`'s compare not
+     *             equal.
+     *
+     * \tparam T   The component type of `lhs`.
+     * \tparam U   The component type of `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `true` if at least one of the corresponding pairs of
+     *             components compares not equal and `false` otherwise.
+     */
+    template<typename T, typename U>
+    inline constexpr bool
+    operator!=(const dual_quat<T>& lhs, const dual_quat<U>& rhs) noexcept
+    {
+        return lhs.real() != rhs.real() || lhs.dual() != rhs.dual();
+    }
+
+    /*!@}*/
+    namespace math
+    {
+        /*!
+         * \addtogroup  dual_quat_hpp
+         * @{
+         */
+
+        /*!
+         * \brief        Transforms a point by `dq`.
+         * \details      `dq` must be normalized. The result is the same as
+         *               `(vec4<T>(point, 1) * dq.to_mat4x4()).xyz()`.
+         *
+         * \tparam T     The component type of `point`.
+         * \tparam U     The component type of `dq`.
+         *
+         * \param point  The point to transform.
+         * \param dq     The transformation.
+         *
+         * \return       `point` transformed by `dq`.
+         */
+        template<typename T, typename U>
+        inline constexpr
+            vec3<decltype(std::declval<T>() * std::declval<U>())>
+        transform_point(const vec3<T>& point, const dual_quat<U>& dq) noexcept
+        {
+            return tue::math::rotate(point, tue::math::conjugate(dq.real()))
+                + dq.translation();
+        }
+
+        /*!
+         * \brief         Transforms a direction vector by `dq`.
+         * \details       `dq` must be normalized. Only the rotation is
+         *                applied.
+         *
+         * \tparam T      The component type of `vector`.
+         * \tparam U      The component type of `dq`.
+         *
+         * \param vector  The vector to transform.
+         * \param dq      The transformation.
+         *
+         * \return        `vector` rotated by `dq`.
+         */
+        template<typename T, typename U>
+        inline constexpr
+            vec3<decltype(std::declval<T>() * std::declval<U>())>
+        transform_vector(
+            const vec3<T>& vector, const dual_quat<U>& dq) noexcept
+        {
+            return tue::math::rotate(vector, tue::math::conjugate(dq.real()));
+        }
+
+        /*!
+         * \brief     Computes a normalized copy of `dq`.
+         * \details   The real part is scaled to unit length and the dual part
+         *            is made orthogonal to it, so the result is a rigid
+         *            transformation again.
+         *
+         * \tparam T  The component type of `dq`.
+         *
+         * \param dq  A `dual_quat` with a non-zero real part.
+         *
+         * \return    A normalized copy of `dq`.
+         */
+        template<typename T>
+        inline dual_quat<T> normalize(const dual_quat<T>& dq) noexcept
+        {
+            const auto real = dq.real();
+            const auto dual = dq.dual();
+            const auto rlength = tue::math::rsqrt(
+                tue::detail_::dot_qq(real, real));
+            const auto unit_real = tue::detail_::mul_qs(real, rlength);
+            const auto unit_dual = tue::detail_::mul_qs(dual, rlength);
+            return {
+                unit_real,
+                tue::detail_::add_qq(unit_dual, tue::detail_::mul_qs(
+                    unit_real,
+                    T(0) - tue::detail_::dot_qq(unit_real, unit_dual))),
+            };
+        }
+
+        /*!
+         * \brief          Blends `count` transformations with dual quaternion
+         *                 linear blending.
+         * \details        Each `dual_quat` is flipped into the same hemisphere
+         *                 as `dqs[0]` before it's weighted so the blend takes
+         *                 the shortest path. The weighted sum is then
+         *                 normalized. Unlike blending matrices, this never
+         *                 shrinks or shears the result.
+         *
+         *                 With a `simd` component type, each lane blends
+         *                 independently, so one call skins as many vertices
+         *                 as there are lanes.
+         *
+         * \tparam T       The component type.
+         *
+         * \param dqs      The normalized transformations to blend.
+         * \param weights  The weight of each transformation.
+         * \param count    The number of transformations. Must be at least 1.
+         *
+         * \return         The normalized blend of `dqs`.
+         */
+        template<typename T>
+        inline dual_quat<T> blend(
+            const dual_quat<T>* dqs, const T* weights, int count) noexcept
+        {
+            const auto pivot = dqs[0].real();
+            auto real = tue::detail_::mul_qs(pivot, weights[0]);
+            auto dual = tue::detail_::mul_qs(dqs[0].dual(), weights[0]);
+            for (int i = 1; i < count; ++i)
+            {
+                const auto flip = tue::math::less(
+                    tue::detail_::dot_qq(pivot, dqs[i].real()), T(0));
+                const auto w = tue::math::select(
+                    flip, T(0) - weights[i], weights[i]);
+                real = tue::detail_::add_qq(
+                    real, tue::detail_::mul_qs(dqs[i].real(), w));
+                dual = tue::detail_::add_qq(
+                    dual, tue::detail_::mul_qs(dqs[i].dual(), w));
+            }
+            return tue::math::normalize(dual_quat<T>(real, dual));
+        }
+
+        /*!@}*/
+    }
+}
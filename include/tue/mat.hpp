@@ -825,6 +825,7 @@ namespace tue
 #include "detail_/mat3xR.hpp"
 #include "detail_/mat4xR.hpp"
 #include "detail_/matmult.hpp"
+#include "detail_/mat_inverse.hpp"
 
 #define shift_left <<
 #define shift_right >> // Because ">>" inside template args confuses Doxygen
@@ -1724,6 +1725,95 @@ namespace tue
             tue::detail_::sincos_m(m, sin_out, cos_out);
         }
 
+        /*!
+         * \brief     Computes `tue::math::tan()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::tan()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> tan(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::tan_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::asin()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::asin()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> asin(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::asin_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::acos()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::acos()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> acos(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::acos_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::atan()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::atan()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> atan(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::atan_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::atan2()` for each component of `y`
+         *            and each corresponding component of `x`.
+         *
+         * \tparam T  The component type of both `y` and `x`.
+         * \tparam C  The column count of both `y` and `x`.
+         * \tparam R  The row count of both `y` and `x`.
+         *
+         * \param y   The numerators.
+         * \param x   The denominators.
+         *
+         * \return    `tue::math::atan2()` for each component of `y` and each
+         *            corresponding component of `x`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> atan2(
+            const mat<T, C, R>& y, const mat<T, C, R>& x) noexcept
+        {
+            return tue::detail_::atan2_mm(y, x);
+        }
+
         /*!
          * \brief     Computes `tue::math::exp()` for each component of `m`.
          *
@@ -1758,6 +1848,40 @@ namespace tue
             return tue::detail_::log_m(m);
         }
 
+        /*!
+         * \brief     Computes `tue::math::exp2()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::exp2()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> exp2(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::exp2_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::log2()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::log2()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> log2(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::log2_m(m);
+        }
+
         /*!
          * \brief     Computes `tue::math::abs()` for each component of `m`.
          *
@@ -2129,6 +2253,72 @@ namespace tue
             return tue::detail_::transpose_m(m);
         }
 
+        /*!
+         * \brief     Computes the determinant of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam N  The column and row count of `m`.
+         *
+         * \param m   A square `mat`.
+         *
+         * \return    The determinant of `m`.
+         */
+        template<typename T, int N>
+        inline T determinant(const mat<T, N, N>& m) noexcept
+        {
+            return tue::detail_::determinant_m(m);
+        }
+
+        /*!
+         * \brief     Computes the inverse of `m`.
+         *
+         * \details   If `m` is singular, the result is undefined. `T` can be
+         *            a `simd` type to invert several matrices at once. The
+         *            `mat<float, 4, 4>` version uses SSE when it's enabled.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam N  The column and row count of `m`.
+         *
+         * \param m   A square `mat`.
+         *
+         * \return    The inverse of `m`.
+         */
+        template<typename T, int N>
+        inline mat<T, N, N> inverse(const mat<T, N, N>& m) noexcept
+        {
+            return tue::detail_::mat_inverse_s<T, N>::inverse(m);
+        }
+
+        /*!
+         * \brief     Computes the inverse of an affine transformation
+         *            matrix.
+         *
+         * \details   `m` must be laid out like the matrices in
+         *            <tue/transform.hpp>, with its translation in the last
+         *            row. If `C == R`, the last column must be
+         *            `(0, ..., 0, 1)`. If `C == R - 1`, that column is
+         *            implied. This is cheaper than `inverse()` because only
+         *            the upper-left `(R - 1)`x`(R - 1)` block needs to be
+         *            inverted. If that block is singular, the result is
+         *            undefined.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`. Must be `R` or `R - 1`.
+         * \tparam R  The row count of `m`. Must be 3 or 4.
+         *
+         * \param m   An affine transformation matrix.
+         *
+         * \return    The inverse of `m`.
+         */
+        template<typename T, int C, int R>
+        inline std::enable_if_t<
+            (R == 3 || R == 4) && (C == R || C == R - 1),
+            mat<T, C, R>>
+        inverse_affine(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::inverse_affine_m(m);
+        }
+
         /*!@}*/
     }
 }
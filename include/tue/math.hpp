@@ -43,6 +43,59 @@ namespace tue
         {
             return x;
         }
+
+        // Square-and-multiply with the exponent known at compile time. The
+        // recursion unrolls completely, so pow_i<5>(x) is just three
+        // multiplications. T can be a scalar or an simd.
+        template<int E, typename T>
+        inline std::enable_if_t<E == 0, T> pow_i(const T&) noexcept
+        {
+            return T(1);
+        }
+
+        template<int E, typename T>
+        inline std::enable_if_t<E == 1, T> pow_i(const T& x) noexcept
+        {
+            return x;
+        }
+
+        template<int E, typename T>
+        inline std::enable_if_t<(E > 1), T> pow_i(const T& x) noexcept
+        {
+            const T half = tue::detail_::pow_i<E / 2>(x);
+            return E % 2 == 0 ? half * half : half * half * x;
+        }
+
+        template<int E, typename T>
+        inline std::enable_if_t<(E < 0), T> pow_i(const T& x) noexcept
+        {
+            return T(1) / tue::detail_::pow_i<-E>(x);
+        }
+
+        // Square-and-multiply with the same exponent for every component.
+        template<typename T, typename I>
+        inline T pow_n(const T& x, I n) noexcept
+        {
+            using U = std::make_unsigned_t<I>;
+            const bool negative = std::is_signed<I>::value && n < I(0);
+            U e = negative ? U(0) - static_cast<U>(n) : static_cast<U>(n);
+
+            T result = T(1);
+            T base = x;
+            while (e != U(0))
+            {
+                if (e & U(1))
+                {
+                    result = result * base;
+                }
+                e >>= 1;
+                if (e != U(0))
+                {
+                    base = base * base;
+                }
+            }
+            return negative ? T(1) / result : result;
+        }
     }
 
     namespace math
@@ -104,6 +157,160 @@ namespace tue
             cos_out = std::cos(x);
         }
 
+        /*!
+         * \brief     Computes the sine of `x` (measured in radians) to within
+         *            a few ulps, however large `x` is.
+         * \details   For scalars, this is the same as `tue::math::sin()`.
+         *            The `simd` overload is where the accuracy difference
+         *            matters.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The sine of `x` (measured in radians).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        sin_accurate(T x) noexcept
+        {
+            return std::sin(x);
+        }
+
+        /*!
+         * \brief     Computes the cosine of `x` (measured in radians) to
+         *            within a few ulps, however large `x` is.
+         * \details   For scalars, this is the same as `tue::math::cos()`.
+         *            The `simd` overload is where the accuracy difference
+         *            matters.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The cosine of `x` (measured in radians).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        cos_accurate(T x) noexcept
+        {
+            return std::cos(x);
+        }
+
+        /*!
+         * \brief          Computes the sine and cosine of `x` (measured in
+         *                 radians) to within a few ulps, however large `x`
+         *                 is.
+         * \details        For scalars, this is the same as
+         *                 `tue::math::sincos()`. The `simd` overload is where
+         *                 the accuracy difference matters.
+         *
+         * \tparam T       The type of parameter `x`.
+         *
+         * \param x        A floating-point number.
+         * \param sin_out  A reference to the value where the sine of `x`
+         *                 (measured in radians) will be stored.
+         * \param cos_out  A reference to the value where the cosine of `x`
+         *                 (measured in radians) will be stored.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value>
+        sincos_accurate(T x, T& sin_out, T& cos_out) noexcept
+        {
+            sin_out = std::sin(x);
+            cos_out = std::cos(x);
+        }
+
+        /*!
+         * \brief     Computes the tangent of `x` (measured in radians).
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The tangent of `x` (measured in radians).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        tan(T x) noexcept
+        {
+            return std::tan(x);
+        }
+
+        /*!
+         * \brief     Computes the arc sine of `x`.
+         * \details   If `x` is outside the range [-1, 1], behavior is
+         *            undefined.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The arc sine of `x` in the range [-pi/2, pi/2]
+         *            (measured in radians).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        asin(T x) noexcept
+        {
+            return std::asin(x);
+        }
+
+        /*!
+         * \brief     Computes the arc cosine of `x`.
+         * \details   If `x` is outside the range [-1, 1], behavior is
+         *            undefined.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The arc cosine of `x` in the range [0, pi] (measured in
+         *            radians).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        acos(T x) noexcept
+        {
+            return std::acos(x);
+        }
+
+        /*!
+         * \brief     Computes the arc tangent of `x`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The arc tangent of `x` in the range [-pi/2, pi/2]
+         *            (measured in radians).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        atan(T x) noexcept
+        {
+            return std::atan(x);
+        }
+
+        /*!
+         * \brief     Computes the arc tangent of `y / x`, using the signs of
+         *            both arguments to determine the quadrant.
+         *
+         * \tparam T  The type of parameters `y` and `x`.
+         *
+         * \param y   A floating-point number.
+         * \param x   A floating-point number.
+         *
+         * \return    The arc tangent of `y / x` in the range [-pi, pi]
+         *            (measured in radians).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        atan2(T y, T x) noexcept
+        {
+            return std::atan2(y, x);
+        }
+
         /*!
          * \brief     Computes the base-e exponential of `x`.
          *
@@ -137,6 +344,39 @@ namespace tue
             return std::log(x);
         }
 
+        /*!
+         * \brief     Computes 2 raised to the power `x`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    2 raised to the power `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        exp2(T x) noexcept
+        {
+            return std::exp2(x);
+        }
+
+        /*!
+         * \brief     Computes the base-2 logarithm of `x`.
+         * \details   If `x` is negative, behavior is undefined.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The base-2 logarithm of `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        log2(T x) noexcept
+        {
+            return std::log2(x);
+        }
+
         /*!
          * \brief     Computes the absolute value of `x`.
          *
@@ -171,6 +411,50 @@ namespace tue
             return std::pow(x, y);
         }
 
+        /*!
+         * \brief     Computes `x` raised to the integer power `E`.
+         * \details   The result is computed with repeated multiplication,
+         *            which is unrolled at compile time. Unlike
+         *            `tue::math::pow(T, T)`, `x` may be negative.
+         *
+         * \tparam E  The exponent.
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    `x` raised to the power `E`.
+         */
+        template<int E, typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        pow(T x) noexcept
+        {
+            return tue::detail_::pow_i<E>(x);
+        }
+
+        /*!
+         * \brief     Computes `x` raised to the integer power `n`.
+         * \details   The result is computed with repeated squaring and
+         *            multiplication. Unlike `tue::math::pow(T, T)`, `x` may
+         *            be negative.
+         *
+         * \tparam T  The type of parameter `x`.
+         * \tparam I  The type of parameter `n`.
+         *
+         * \param x   A floating-point number.
+         * \param n   An integer.
+         *
+         * \return    `x` raised to the power `n`.
+         */
+        template<typename T, typename I>
+        inline std::enable_if_t<
+            is_floating_point_simd_component<T>::value
+                && std::is_integral<I>::value,
+            T>
+        pow(T x, I n) noexcept
+        {
+            return tue::detail_::pow_n(x, n);
+        }
+
         /*!
          * \brief     Computes the reciprocal of `x`.
          * \details   If `x` equals `0`, behavior is undefined.
@@ -188,6 +472,42 @@ namespace tue
             return 1 / x;
         }
 
+        /*!
+         * \brief     Computes a fast approximation of the reciprocal of `x`.
+         * \details   For scalars, this is the same as `tue::math::recip()`.
+         *            The `simd` overload is where the speed difference
+         *            matters.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The reciprocal of `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        recip_fast(T x) noexcept
+        {
+            return 1 / x;
+        }
+
+        /*!
+         * \brief     Computes the correctly rounded reciprocal of `x`.
+         * \details   For scalars, this is the same as `tue::math::recip()`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The reciprocal of `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        recip_exact(T x) noexcept
+        {
+            return 1 / x;
+        }
+
         /*!
          * \brief     Computes the nonnegative square root of `x`.
          * \details   If `x` is negative, behavior is undefined.
@@ -224,6 +544,44 @@ namespace tue
             return 1 / std::sqrt(x);
         }
 
+        /*!
+         * \brief     Computes a fast approximation of the reciprocal of the
+         *            nonnegative square root of `x`.
+         * \details   For scalars, this is the same as `tue::math::rsqrt()`.
+         *            The `simd` overload is where the speed difference
+         *            matters.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The reciprocal of the nonnegative square root of `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        rsqrt_fast(T x) noexcept
+        {
+            return 1 / std::sqrt(x);
+        }
+
+        /*!
+         * \brief     Computes the reciprocal of the nonnegative square root of
+         *            `x` as `1 / sqrt(x)`.
+         * \details   For scalars, this is the same as `tue::math::rsqrt()`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The reciprocal of the nonnegative square root of `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        rsqrt_exact(T x) noexcept
+        {
+            return 1 / std::sqrt(x);
+        }
+
         /*!
          * \brief     Determines the minimum numeric value of the arguments.
          *
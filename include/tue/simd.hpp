@@ -12,7 +12,10 @@ static_assert(sizeof(float) == 4, "float is not 32-bits wide");
 static_assert(sizeof(double) == 8, "double is not 64-bits wide");
 
 #include <cstdint>
+#include <initializer_list>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 #include "sized_bool.hpp"
 
@@ -156,6 +159,40 @@ namespace tue
      *            `float32x4` | `__m128`
      *            `float64x2` | `__m128d`
      *
+     *            <b>AVX</b>
+     *            `simd` Type | SIMD Intrinsic
+     *            ----------- | --------------
+     *            `bool32x8`  | `__m256` and `__m256i`
+     *            `bool64x4`  | `__m256d` and `__m256i`
+     *            `float32x8` | `__m256`
+     *            `float64x4` | `__m256d`
+     *
+     *            <b>AVX2</b>
+     *            `simd` Type  | SIMD Intrinsic
+     *            ------------ | --------------
+     *            `bool8x32`   | `__m256i`
+     *            `bool16x16`  | `__m256i`
+     *            `int8x32`    | `__m256i`
+     *            `int16x16`   | `__m256i`
+     *            `int32x8`    | `__m256i`
+     *            `int64x4`    | `__m256i`
+     *            `uint8x32`   | `__m256i`
+     *            `uint16x16`  | `__m256i`
+     *            `uint32x8`   | `__m256i`
+     *            `uint64x4`   | `__m256i`
+     *
+     *            <b>AVX-512</b>
+     *            `simd` Type  | SIMD Intrinsic
+     *            ------------ | --------------
+     *            `bool32x16`  | `__m512` and `__m512i`
+     *            `bool64x8`   | `__m512d` and `__m512i`
+     *            `float32x16` | `__m512`
+     *            `float64x8`  | `__m512d`
+     *            `int32x16`   | `__m512i`
+     *            `int64x8`    | `__m512i`
+     *            `uint32x16`  | `__m512i`
+     *            `uint64x8`   | `__m512i`
+     *
      * \tparam T  The component type. `is_simd_component<T>::value` must be
      *            `true`.
      * \tparam N  The component count. Must be `2`, `4`, `8`, `16`, `32`, or
@@ -529,6 +566,219 @@ namespace tue
             return (sizeof(T) * N);
 #endif
         }
+
+        inline int popcount(std::uint64_t x) noexcept
+        {
+            x = x - ((x >> 1) & UINT64_C(0x5555555555555555));
+            x = (x & UINT64_C(0x3333333333333333))
+                + ((x >> 2) & UINT64_C(0x3333333333333333));
+            x = (x + (x >> 4)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+            return static_cast<int>((x * UINT64_C(0x0101010101010101)) >> 56);
+        }
+
+        template<int N>
+        inline constexpr bool are_lane_indices(
+            std::initializer_list<int> indices) noexcept
+        {
+            for (const int i : indices)
+            {
+                if (i < 0 || i >= N)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<typename T, int N, int... I>
+        inline simd<T, N> gather_lanes_s(
+            const T* base,
+            const std::int32_t* indices,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            const T data[] = { base[indices[I]]... };
+            return simd<T, N>::loadu(data);
+        }
+
+        template<typename T, int N, typename B, int... I>
+        inline simd<T, N> gather_lanes_s(
+            const T* base,
+            const std::int32_t* indices,
+            const B* conditions,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            const T data[] = {
+                (conditions[I] ? base[indices[I]] : static_cast<T>(0))...
+            };
+            return simd<T, N>::loadu(data);
+        }
+
+        template<typename T, int... I>
+        inline void scatter_lanes_s(
+            const T* data,
+            T* base,
+            const std::int32_t* indices,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            // Braced initializers are evaluated in order, so the highest of
+            // several components sharing an offset is the one stored last.
+            const int order[] = { (base[indices[I]] = data[I], 0)... };
+            static_cast<void>(order);
+        }
+
+        template<typename T, typename B, int... I>
+        inline void scatter_lanes_s(
+            const T* data,
+            T* base,
+            const std::int32_t* indices,
+            const B* conditions,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            const int order[] = {
+                (conditions[I] ? void(base[indices[I]] = data[I]) : void(),
+                    0)...
+            };
+            static_cast<void>(order);
+        }
+
+        // The index and condition simds are only ever accessed through
+        // std::addressof() so that the backend specializations can call
+        // these before those simd types are complete.
+        template<typename T, int N, typename I>
+        inline simd<T, N> gather_s(const T* base, const I& indices) noexcept
+        {
+            return gather_lanes_s<T, N>(
+                base,
+                reinterpret_cast<const std::int32_t*>(std::addressof(indices)),
+                std::make_integer_sequence<int, N>());
+        }
+
+        template<typename T, int N, typename I, typename B>
+        inline simd<T, N> gather_s(
+            const T* base, const I& indices, const B& conditions) noexcept
+        {
+            return gather_lanes_s<T, N>(
+                base,
+                reinterpret_cast<const std::int32_t*>(std::addressof(indices)),
+                reinterpret_cast<const sized_bool_t<sizeof(T)>*>(
+                    std::addressof(conditions)),
+                std::make_integer_sequence<int, N>());
+        }
+
+        template<int N, typename T, typename I>
+        inline void scatter_s(
+            const T* data, T* base, const I& indices) noexcept
+        {
+            scatter_lanes_s(
+                data,
+                base,
+                reinterpret_cast<const std::int32_t*>(std::addressof(indices)),
+                std::make_integer_sequence<int, N>());
+        }
+
+        template<int N, typename T, typename I, typename B>
+        inline void scatter_s(
+            const T* data,
+            T* base,
+            const I& indices,
+            const B& conditions) noexcept
+        {
+            scatter_lanes_s(
+                data,
+                base,
+                reinterpret_cast<const std::int32_t*>(std::addressof(indices)),
+                reinterpret_cast<const sized_bool_t<sizeof(T)>*>(
+                    std::addressof(conditions)),
+                std::make_integer_sequence<int, N>());
+        }
+
+        template<int N>
+        inline int partial_count_s(int count) noexcept
+        {
+            return count < 0 ? 0 : count < N ? count : N;
+        }
+
+        template<typename B, int... I>
+        inline const B* partial_mask_table_s(
+            std::integer_sequence<int, I...>) noexcept
+        {
+            static const B masks[] = {
+                (I < int(sizeof...(I)) / 2 ? B(~0LL) : B(0LL))...
+            };
+            return masks;
+        }
+
+        // Returns N conditions, the first `count` of which are true.
+        template<typename B, int N>
+        inline const B* partial_mask_s(int count) noexcept
+        {
+            const auto masks = partial_mask_table_s<B>(
+                std::make_integer_sequence<int, 2 * N>());
+            return masks + N - partial_count_s<N>(count);
+        }
+
+        template<typename T, int N, typename B>
+        inline simd<T, N> maskload_lanes_s(
+            const T* data, const B* conditions) noexcept
+        {
+            T components[N];
+            for (int i = 0; i < N; ++i)
+            {
+                components[i] = conditions[i] ? data[i] : static_cast<T>(0);
+            }
+            return simd<T, N>::loadu(components);
+        }
+
+        template<int N, typename T, typename B>
+        inline void maskstore_lanes_s(
+            const T* components, T* data, const B* conditions) noexcept
+        {
+            for (int i = 0; i < N; ++i)
+            {
+                if (conditions[i])
+                {
+                    data[i] = components[i];
+                }
+            }
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> load_partial_s(const T* data, int count) noexcept
+        {
+            return maskload_lanes_s<T, N>(
+                data, partial_mask_s<sized_bool_t<sizeof(T)>, N>(count));
+        }
+
+        template<typename T, int N, typename C>
+        inline simd<T, N> maskload_s(
+            const T* data, const C& conditions) noexcept
+        {
+            return maskload_lanes_s<T, N>(
+                data,
+                reinterpret_cast<const sized_bool_t<sizeof(T)>*>(
+                    std::addressof(conditions)));
+        }
+
+        template<int N, typename T>
+        inline void store_partial_s(
+            const T* components, T* data, int count) noexcept
+        {
+            maskstore_lanes_s<N>(
+                components,
+                data,
+                partial_mask_s<sized_bool_t<sizeof(T)>, N>(count));
+        }
+
+        template<int N, typename T, typename C>
+        inline void maskstore_s(
+            const T* components, T* data, const C& conditions) noexcept
+        {
+            maskstore_lanes_s<N>(
+                components,
+                data,
+                reinterpret_cast<const sized_bool_t<sizeof(T)>*>(
+                    std::addressof(conditions)));
+        }
     }
 }
 
@@ -736,6 +986,103 @@ namespace tue
             return s;
         }
 
+        /*!
+         * \brief          Gathers the components at the given offsets from a
+         *                 base pointer into a new `simd`.
+         * \details        Component `i` of the result is set to
+         *                 `base[indices[i]]`. If any of the addressed
+         *                 components is out of bounds, behavior is undefined.
+         *
+         * \param base     The base component pointer.
+         * \param indices  The component offsets from `base`.
+         *
+         * \return         The new `simd`.
+         */
+        static simd<T, N> gather(
+            const T* base, const simd<std::int32_t, N>& indices) noexcept
+        {
+            const auto iimpl
+                = reinterpret_cast<const simd<std::int32_t, N/2>*>(&indices);
+            simd<T, N> s;
+            s.impl_[0] = simd<T, N/2>::gather(base, iimpl[0]);
+            s.impl_[1] = simd<T, N/2>::gather(base, iimpl[1]);
+            return s;
+        }
+
+        /*!
+         * \brief             Gathers the components at the given offsets from
+         *                    a base pointer into a new `simd` wherever the
+         *                    corresponding condition is `true`.
+         * \details           Component `i` of the result is set to
+         *                    `base[indices[i]]` if `conditions[i]` is `true`
+         *                    and to `0` otherwise. Components whose condition
+         *                    is `false` aren't read and may be out of bounds.
+         *
+         * \param base        The base component pointer.
+         * \param indices     The component offsets from `base`.
+         * \param conditions  The per-component conditions.
+         *
+         * \return            The new `simd`.
+         */
+        static simd<T, N> gather(
+            const T* base,
+            const simd<std::int32_t, N>& indices,
+            const simd<sized_bool_t<sizeof(T)>, N>& conditions) noexcept
+        {
+            const auto iimpl
+                = reinterpret_cast<const simd<std::int32_t, N/2>*>(&indices);
+            const auto cimpl = reinterpret_cast<
+                const simd<sized_bool_t<sizeof(T)>, N/2>*>(&conditions);
+            simd<T, N> s;
+            s.impl_[0] = simd<T, N/2>::gather(base, iimpl[0], cimpl[0]);
+            s.impl_[1] = simd<T, N/2>::gather(base, iimpl[1], cimpl[1]);
+            return s;
+        }
+
+        /*!
+         * \brief        Loads the first `count` components of the given
+         *               unaligned component array into a new `simd`.
+         * \details      The remaining components are set to `0` and their
+         *               memory isn't read. `count` is clamped to the range
+         *               `[0, N]`.
+         *
+         * \param data   The source component array.
+         * \param count  The number of components to load.
+         *
+         * \return       The new `simd`.
+         */
+        static simd<T, N> load_partial(const T* data, int count) noexcept
+        {
+            simd<T, N> s;
+            s.impl_[0] = simd<T, N/2>::load_partial(data, count);
+            s.impl_[1] = simd<T, N/2>::load_partial(data + N/2, count - N/2);
+            return s;
+        }
+
+        /*!
+         * \brief             Loads the components of the given unaligned
+         *                    component array whose corresponding condition is
+         *                    `true` into a new `simd`.
+         * \details           The remaining components are set to `0` and
+         *                    their memory isn't read.
+         *
+         * \param data        The source component array.
+         * \param conditions  The per-component conditions.
+         *
+         * \return            The new `simd`.
+         */
+        static simd<T, N> maskload(
+            const T* data,
+            const simd<sized_bool_t<sizeof(T)>, N>& conditions) noexcept
+        {
+            const auto cimpl = reinterpret_cast<
+                const simd<sized_bool_t<sizeof(T)>, N/2>*>(&conditions);
+            simd<T, N> s;
+            s.impl_[0] = simd<T, N/2>::maskload(data, cimpl[0]);
+            s.impl_[1] = simd<T, N/2>::maskload(data + N/2, cimpl[1]);
+            return s;
+        }
+
         /*!@}*/
         /*!
          * \brief       Store's this `simd`'s underlying component array in
@@ -767,6 +1114,108 @@ namespace tue
             this->impl_[1].storeu(data + N/2);
         }
 
+        /*!
+         * \brief       Store's this `simd`'s underlying component array in
+         *              the given aligned component array using non-temporal
+         *              stores where supported.
+         * \details     Non-temporal stores bypass the cache, which avoids
+         *              evicting useful data when writing large arrays that
+         *              won't be read again soon. They're weakly-ordered, so
+         *              call `tue::stream_fence()` before other threads read
+         *              the destination. Alignment requirements are the same
+         *              as `store()`.
+         *
+         * \param data  The destination component array.
+         */
+        void store_stream(T* data) const noexcept
+        {
+            this->impl_[0].store_stream(data);
+            this->impl_[1].store_stream(data + N/2);
+        }
+
+        /*!
+         * \brief          Scatters this `simd`'s components to the given
+         *                 offsets from a base pointer.
+         * \details        Component `i` is stored in `base[indices[i]]`. If
+         *                 several components share the same offset, the
+         *                 highest of them is the one left in memory. If any
+         *                 of the addressed components is out of bounds,
+         *                 behavior is undefined.
+         *
+         * \param base     The base component pointer.
+         * \param indices  The component offsets from `base`.
+         */
+        void scatter(
+            T* base, const simd<std::int32_t, N>& indices) const noexcept
+        {
+            const auto iimpl
+                = reinterpret_cast<const simd<std::int32_t, N/2>*>(&indices);
+            this->impl_[0].scatter(base, iimpl[0]);
+            this->impl_[1].scatter(base, iimpl[1]);
+        }
+
+        /*!
+         * \brief             Scatters this `simd`'s components to the given
+         *                    offsets from a base pointer wherever the
+         *                    corresponding condition is `true`.
+         * \details           Component `i` is stored in `base[indices[i]]`
+         *                    only if `conditions[i]` is `true`. Components
+         *                    whose condition is `false` aren't written and
+         *                    may be out of bounds. Otherwise behaves like the
+         *                    unconditional overload.
+         *
+         * \param base        The base component pointer.
+         * \param indices     The component offsets from `base`.
+         * \param conditions  The per-component conditions.
+         */
+        void scatter(
+            T* base,
+            const simd<std::int32_t, N>& indices,
+            const simd<sized_bool_t<sizeof(T)>, N>& conditions) const noexcept
+        {
+            const auto iimpl
+                = reinterpret_cast<const simd<std::int32_t, N/2>*>(&indices);
+            const auto cimpl = reinterpret_cast<
+                const simd<sized_bool_t<sizeof(T)>, N/2>*>(&conditions);
+            this->impl_[0].scatter(base, iimpl[0], cimpl[0]);
+            this->impl_[1].scatter(base, iimpl[1], cimpl[1]);
+        }
+
+        /*!
+         * \brief        Stores the first `count` of this `simd`'s components
+         *               in the given unaligned component array.
+         * \details      The memory of the remaining components isn't
+         *               written. `count` is clamped to the range `[0, N]`.
+         *
+         * \param data   The destination component array.
+         * \param count  The number of components to store.
+         */
+        void store_partial(T* data, int count) const noexcept
+        {
+            this->impl_[0].store_partial(data, count);
+            this->impl_[1].store_partial(data + N/2, count - N/2);
+        }
+
+        /*!
+         * \brief             Stores this `simd`'s components whose
+         *                    corresponding condition is `true` in the given
+         *                    unaligned component array.
+         * \details           The memory of the remaining components isn't
+         *                    written.
+         *
+         * \param data        The destination component array.
+         * \param conditions  The per-component conditions.
+         */
+        void maskstore(
+            T* data,
+            const simd<sized_bool_t<sizeof(T)>, N>& conditions) const noexcept
+        {
+            const auto cimpl = reinterpret_cast<
+                const simd<sized_bool_t<sizeof(T)>, N/2>*>(&conditions);
+            this->impl_[0].maskstore(data, cimpl[0]);
+            this->impl_[1].maskstore(data + N/2, cimpl[1]);
+        }
+
         /*!
          * \brief   Returns a pointer to this `simd`'s underlying component
          *          array.
@@ -797,6 +1246,10 @@ namespace tue
 #include "detail_/simd_support.hpp"
 #include "detail_/simd_specializations.hpp"
 
+#ifdef TUE_SSE
+#include <xmmintrin.h>
+#endif
+
 namespace tue
 {
     /*!
@@ -1344,6 +1797,185 @@ namespace tue
         return tue::detail_::inequality_operator_ss(lhs, rhs);
     }
 
+    /*!
+     * \brief     Rearranges the components of `s`.
+     *
+     * \tparam I  For each component of the result, the index of the
+     *            component of `s` to copy into it. There must be exactly `N`
+     *            indices, each in the range `[0, N)`.
+     * \tparam T  The component type of `s`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   An `simd`.
+     *
+     * \return    An `simd` whose `i`th component is the component of `s` at
+     *            the `i`th index in `I`.
+     */
+    template<int... I, typename T, int N>
+    inline simd<T, N> shuffle(const simd<T, N>& s) noexcept
+    {
+        static_assert(sizeof...(I) == N, "wrong number of shuffle indices");
+        static_assert(tue::detail_::are_lane_indices<N>({ I... }),
+            "shuffle index out of range");
+        return tue::detail_::shuffle_s<I...>(s);
+    }
+
+    /*!
+     * \brief     Interleaves the lower halves of `s1` and `s2`.
+     *
+     * \tparam T  The component type of both `s1` and `s2`.
+     * \tparam N  The component count of both `s1` and `s2`.
+     *
+     * \param s1  An `simd`.
+     * \param s2  Another `simd`.
+     *
+     * \return    `{ s1[0], s2[0], s1[1], s2[1], ..., s1[N/2-1], s2[N/2-1] }`.
+     */
+    template<typename T, int N>
+    inline simd<T, N> unpack_lo(
+        const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+    {
+        return tue::detail_::unpack_lo_ss(s1, s2);
+    }
+
+    /*!
+     * \brief     Interleaves the upper halves of `s1` and `s2`.
+     *
+     * \tparam T  The component type of both `s1` and `s2`.
+     * \tparam N  The component count of both `s1` and `s2`.
+     *
+     * \param s1  An `simd`.
+     * \param s2  Another `simd`.
+     *
+     * \return    `{ s1[N/2], s2[N/2], s1[N/2+1], s2[N/2+1], ..., s1[N-1],
+     *            s2[N-1] }`.
+     */
+    template<typename T, int N>
+    inline simd<T, N> unpack_hi(
+        const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+    {
+        return tue::detail_::unpack_hi_ss(s1, s2);
+    }
+
+    /*!
+     * \brief     Copies one component of `s` into every component.
+     *
+     * \tparam K  The index of the component to copy, in the range `[0, N)`.
+     * \tparam T  The component type of `s`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   An `simd`.
+     *
+     * \return    An `simd` whose components all equal the `K`th component
+     *            of `s`.
+     */
+    template<int K, typename T, int N>
+    inline simd<T, N> broadcast(const simd<T, N>& s) noexcept
+    {
+        static_assert(K >= 0 && K < N, "broadcast index out of range");
+        return tue::detail_::broadcast_s<K>(
+            s, std::make_integer_sequence<int, N>());
+    }
+
+    /*!
+     * \brief     Rotates the components of `s` towards index 0.
+     *
+     * \tparam K  The number of positions to rotate by. Negative values
+     *            rotate the other way.
+     * \tparam T  The component type of `s`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   An `simd`.
+     *
+     * \return    An `simd` whose `i`th component is the `(i+K) mod N`th
+     *            component of `s`.
+     */
+    template<int K, typename T, int N>
+    inline simd<T, N> rotate(const simd<T, N>& s) noexcept
+    {
+        return tue::detail_::rotate_s<K>(
+            s, std::make_integer_sequence<int, N>());
+    }
+
+    /*!
+     * \brief  A cache level hint for `tue::prefetch()`.
+     */
+    enum class prefetch_hint
+    {
+        /*!
+         * \brief  Prefetch into all levels of the cache hierarchy.
+         */
+        t0,
+
+        /*!
+         * \brief  Prefetch into level 2 cache and higher.
+         */
+        t1,
+
+        /*!
+         * \brief  Prefetch into level 3 cache and higher.
+         */
+        t2,
+
+        /*!
+         * \brief  Prefetch into a non-temporal buffer, minimizing cache
+         *         pollution.
+         */
+        nta,
+    };
+
+    /*!
+     * \brief          Hints that the memory at `address` will be read soon.
+     *
+     * \details        This never faults, even if `address` is invalid. If
+     *                 the current compiler configuration has no prefetch
+     *                 instruction, this does nothing.
+     *
+     * \tparam Hint    The cache level to prefetch into.
+     *
+     * \param address  The address to prefetch.
+     */
+    template<prefetch_hint Hint = prefetch_hint::t0>
+    inline void prefetch(const void* address) noexcept
+    {
+#ifdef TUE_SSE
+        const auto p = static_cast<const char*>(address);
+        switch (Hint)
+        {
+        case prefetch_hint::t0:
+            _mm_prefetch(p, _MM_HINT_T0);
+            break;
+        case prefetch_hint::t1:
+            _mm_prefetch(p, _MM_HINT_T1);
+            break;
+        case prefetch_hint::t2:
+            _mm_prefetch(p, _MM_HINT_T2);
+            break;
+        case prefetch_hint::nta:
+            _mm_prefetch(p, _MM_HINT_NTA);
+            break;
+        }
+#elif defined(__GNUC__)
+        __builtin_prefetch(address, 0, 3 - static_cast<int>(Hint));
+#else
+        static_cast<void>(address);
+#endif
+    }
+
+    /*!
+     * \brief    Orders all preceding non-temporal stores before any
+     *           subsequent stores.
+     *
+     * \details  Call this after a sequence of `simd::store_stream()` calls
+     *           and before publishing the destination to other threads.
+     */
+    inline void stream_fence() noexcept
+    {
+#ifdef TUE_SSE
+        _mm_sfence();
+#endif
+    }
+
     /*!@}*/
     namespace math
     {
@@ -1417,71 +2049,278 @@ namespace tue
         }
 
         /*!
-         * \brief     Computes `tue::math::exp()` for each component of `s`.
-         * \details   The results may not match `tue::math::exp()` exactly, but
-         *            will at least approximate the same values.
+         * \brief     Computes `tue::math::sin_accurate()` for each component
+         *            of `s`.
+         * \details   Unlike `tue::math::sin()`, the results are within a few
+         *            ulps of `tue::math::sin_accurate()` however large the
+         *            components of `s` are. This is slower than
+         *            `tue::math::sin()`.
          *
          * \tparam T  The component type of `s`.
          * \tparam N  The component count of `s`.
          *
          * \param s   An `simd`.
          *
-         * \return    `tue::math::exp()` for each component of `s`.
+         * \return    `tue::math::sin_accurate()` for each component of `s`.
          */
         template<typename T, int N>
         inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
-        exp(const simd<T, N>& s) noexcept
+        sin_accurate(const simd<T, N>& s) noexcept
         {
-            return tue::detail_::exp_s(s);
+            return tue::detail_::sin_accurate_s(s);
         }
 
         /*!
-         * \brief     Computes `tue::math::log()` for each component of `s`.
-         * \details   The results may not match `tue::math::log()` exactly, but
-         *            will at least approximate the same values.
+         * \brief     Computes `tue::math::cos_accurate()` for each component
+         *            of `s`.
+         * \details   Unlike `tue::math::cos()`, the results are within a few
+         *            ulps of `tue::math::cos_accurate()` however large the
+         *            components of `s` are. This is slower than
+         *            `tue::math::cos()`.
          *
          * \tparam T  The component type of `s`.
          * \tparam N  The component count of `s`.
          *
          * \param s   An `simd`.
          *
-         * \return    `tue::math::log()` for each component of `s`.
+         * \return    `tue::math::cos_accurate()` for each component of `s`.
          */
         template<typename T, int N>
         inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
-        log(const simd<T, N>& s) noexcept
+        cos_accurate(const simd<T, N>& s) noexcept
         {
-            return tue::detail_::log_s(s);
+            return tue::detail_::cos_accurate_s(s);
         }
 
         /*!
-         * \brief     Computes `tue::math::abs()` for each component of `s`.
+         * \brief          Computes `tue::math::sincos_accurate()` for each
+         *                 component of `s`.
+         * \details        Unlike `tue::math::sincos()`, the results are
+         *                 within a few ulps of `tue::math::sincos_accurate()`
+         *                 however large the components of `s` are. This is
+         *                 slower than `tue::math::sincos()`.
+         *
+         * \tparam T       The component type of `s`.
+         * \tparam N       The component count of `s`.
+         *
+         * \param s        An `simd`.
+         * \param sin_out  A reference to the `simd` to store the
+         *                 `sin_accurate()` results in.
+         * \param cos_out  A reference to the `simd` to store the
+         *                 `cos_accurate()` results in.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value>
+        sincos_accurate(
+            const simd<T, N>& s,
+            simd<T, N>& sin_out,
+            simd<T, N>& cos_out) noexcept
+        {
+            tue::detail_::sincos_accurate_s(s, sin_out, cos_out);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::tan()` for each component of `s`.
+         * \details   The results may not match `tue::math::tan()` exactly,
+         *            but will at least approximate the same values.
          *
          * \tparam T  The component type of `s`.
          * \tparam N  The component count of `s`.
          *
          * \param s   An `simd`.
          *
-         * \return    `tue::math::abs()` for each component of `s`.
+         * \return    `tue::math::tan()` for each component of `s`.
          */
         template<typename T, int N>
-        inline std::enable_if_t<std::is_arithmetic<T>::value, simd<T, N>>
-        abs(const simd<T, N>& s) noexcept
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        tan(const simd<T, N>& s) noexcept
         {
-            return tue::detail_::abs_s(s);
+            return tue::detail_::tan_s(s);
         }
 
         /*!
-         * \brief            Computes `tue::math::pow()` for each component of
-         *                   `bases` and each corresponding component of
-         *                   `exponents`.
-         * \details          The results may not match `tue::math::pow()`
-         *                   exactly, but will at least approximate the same
-         *                   values.
+         * \brief     Computes `tue::math::asin()` for each component of `s`.
+         * \details   The results may not match `tue::math::asin()` exactly,
+         *            but will at least approximate the same values.
          *
-         * \tparam T         The component type of both `bases` and `exponents`.
-         * \tparam N         The component count of both `bases` and
-         *                   `exponents`.
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::asin()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        asin(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::asin_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::acos()` for each component of `s`.
+         * \details   The results may not match `tue::math::acos()` exactly,
+         *            but will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::acos()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        acos(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::acos_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::atan()` for each component of `s`.
+         * \details   The results may not match `tue::math::atan()` exactly,
+         *            but will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::atan()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        atan(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::atan_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::atan2()` for each component of `y`
+         *            and each corresponding component of `x`.
+         * \details   The results may not match `tue::math::atan2()` exactly,
+         *            but will at least approximate the same values.
+         *
+         * \tparam T  The component type of both `y` and `x`.
+         * \tparam N  The component count of both `y` and `x`.
+         *
+         * \param y   The numerators.
+         * \param x   The denominators.
+         *
+         * \return    `tue::math::atan2()` for each component of `y` and each
+         *            corresponding component of `x`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        atan2(const simd<T, N>& y, const simd<T, N>& x) noexcept
+        {
+            return tue::detail_::atan2_ss(y, x);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::exp()` for each component of `s`.
+         * \details   The results may not match `tue::math::exp()` exactly, but
+         *            will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::exp()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        exp(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::exp_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::log()` for each component of `s`.
+         * \details   The results may not match `tue::math::log()` exactly, but
+         *            will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::log()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        log(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::log_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::exp2()` for each component of `s`.
+         * \details   The results may not match `tue::math::exp2()` exactly,
+         *            but will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::exp2()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        exp2(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::exp2_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::log2()` for each component of `s`.
+         * \details   The results may not match `tue::math::log2()` exactly,
+         *            but will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::log2()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        log2(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::log2_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::abs()` for each component of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::abs()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, simd<T, N>>
+        abs(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::abs_s(s);
+        }
+
+        /*!
+         * \brief            Computes `tue::math::pow()` for each component of
+         *                   `bases` and each corresponding component of
+         *                   `exponents`.
+         * \details          The results may not match `tue::math::pow()`
+         *                   exactly, but will at least approximate the same
+         *                   values.
+         *
+         * \tparam T         The component type of both `bases` and `exponents`.
+         * \tparam N         The component count of both `bases` and
+         *                   `exponents`.
          *
          * \param bases      The bases.
          * \param exponents  The exponents.
@@ -1496,10 +2335,62 @@ namespace tue
             return tue::detail_::pow_ss(bases, exponents);
         }
 
+        /*!
+         * \brief     Computes `tue::math::pow<E>()` for each component of `s`.
+         * \details   The result is computed with repeated multiplication,
+         *            which is unrolled at compile time. Unlike
+         *            `tue::math::pow()` with a `simd` of exponents, negative
+         *            components are allowed.
+         *
+         * \tparam E  The exponent.
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::pow<E>()` for each component of `s`.
+         */
+        template<int E, typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        pow(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::pow_i<E>(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::pow()` for each component of `s`
+         *            and the integer exponent `n`.
+         * \details   The result is computed with repeated squaring and
+         *            multiplication, which is much cheaper than
+         *            `tue::math::pow()` with a `simd` of exponents. Negative
+         *            components are allowed.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         * \tparam I  The type of parameter `n`.
+         *
+         * \param s   An `simd`.
+         * \param n   The exponent shared by every component.
+         *
+         * \return    `tue::math::pow()` for each component of `s` and `n`.
+         */
+        template<typename T, int N, typename I>
+        inline std::enable_if_t<
+            std::is_floating_point<T>::value && std::is_integral<I>::value,
+            simd<T, N>>
+        pow(const simd<T, N>& s, I n) noexcept
+        {
+            return tue::detail_::pow_n(s, n);
+        }
+
         /*!
          * \brief     Computes `tue::math::recip()` for each component of `s`.
-         * \details   The results may not match `tue::math::recip()` exactly,
-         *            but will at least approximate the same values.
+         * \details   Where the hardware only provides a reciprocal estimate,
+         *            the estimate is refined with a Newton-Raphson step. The
+         *            results are within a few ulps of `tue::math::recip()`
+         *            for finite, nonzero components. Use
+         *            `tue::math::recip_fast()` or `tue::math::recip_exact()`
+         *            to trade accuracy for speed or vice versa.
          *
          * \tparam T  The component type of `s`.
          * \tparam N  The component count of `s`.
@@ -1515,6 +2406,46 @@ namespace tue
             return tue::detail_::recip_s(s);
         }
 
+        /*!
+         * \brief     Computes `tue::math::recip_fast()` for each component
+         *            of `s`.
+         * \details   Uses the hardware reciprocal estimate where there is one,
+         *            so the results may only be accurate to about 12 bits.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::recip_fast()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        recip_fast(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::recip_fast_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::recip_exact()` for each component
+         *            of `s`.
+         * \details   Always uses a full division, so the results match
+         *            `tue::math::recip_exact()`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::recip_exact()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        recip_exact(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::recip_exact_s(s);
+        }
+
         /*!
          * \brief     Computes `tue::math::sqrt()` for each component of `s`.
          * \details   The results may not match `tue::math::sqrt()` exactly, but
@@ -1536,8 +2467,13 @@ namespace tue
 
         /*!
          * \brief     Computes `tue::math::rsqrt()` for each component of `s`.
-         * \details   The results may not match `tue::math::rsqrt()` exactly,
-         *            but will at least approximate the same values.
+         * \details   Where the hardware only provides a reciprocal square
+         *            root estimate, the estimate is refined with a
+         *            Newton-Raphson step. The results are within a few ulps
+         *            of `tue::math::rsqrt()` for finite, positive components.
+         *            Use `tue::math::rsqrt_fast()` or
+         *            `tue::math::rsqrt_exact()` to trade accuracy for speed or
+         *            vice versa.
          *
          * \tparam T  The component type of `s`.
          * \tparam N  The component count of `s`.
@@ -1553,6 +2489,47 @@ namespace tue
             return tue::detail_::rsqrt_s(s);
         }
 
+        /*!
+         * \brief     Computes `tue::math::rsqrt_fast()` for each component
+         *            of `s`.
+         * \details   Uses the hardware reciprocal square root estimate where
+         *            there is one, so the results may only be accurate to
+         *            about 12 bits.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::rsqrt_fast()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        rsqrt_fast(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::rsqrt_fast_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::rsqrt_exact()` for each component
+         *            of `s`.
+         * \details   Always uses a full square root and division, so the
+         *            results match `tue::math::rsqrt_exact()`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::rsqrt_exact()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        rsqrt_exact(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::rsqrt_exact_s(s);
+        }
+
         /*!
          * \brief     Computes `tue::math::min()` for each corresponding pair of
          *            components from `s1` and `s2`.
@@ -1593,6 +2570,94 @@ namespace tue
             return tue::detail_::max_ss(s1, s2);
         }
 
+        /*!
+         * \brief     Computes the sum of every component of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    The sum of every component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        hsum(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::hsum_s(s);
+        }
+
+        /*!
+         * \brief     Computes the product of every component of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    The product of every component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        hprod(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::hprod_s(s);
+        }
+
+        /*!
+         * \brief     Computes the minimum of every component of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    The minimum of every component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        hmin(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::hmin_s(s);
+        }
+
+        /*!
+         * \brief     Computes the maximum of every component of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    The maximum of every component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        hmax(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::hmax_s(s);
+        }
+
+        /*!
+         * \brief     Computes the sum of the products of each corresponding
+         *            pair of components from `s1` and `s2`.
+         *
+         * \tparam T  The component type of both `s1` and `s2`.
+         * \tparam N  The component count of both `s1` and `s2`.
+         *
+         * \param s1  An `simd`.
+         * \param s2  Another `simd`.
+         *
+         * \return    The sum of the products of each corresponding pair of
+         *            components from `s1` and `s2`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        dot(const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+        {
+            return tue::math::hsum(s1 * s2);
+        }
+
         /*!
          * \brief             Computes `tue::math::mask()` for each
          *                    corresponding pair of components from `conditions`
@@ -1647,6 +2712,93 @@ namespace tue
             return tue::detail_::select_sss(conditions, values, otherwise);
         }
 
+        /*!
+         * \brief     Gathers the truth of each component of `s` into a
+         *            bitmask.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    A bitmask whose `i`th bit is set if and only if the
+         *            `i`th component of `s` is true.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<is_sized_bool<T>::value, std::uint64_t>
+        movemask(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::movemask_s(s);
+        }
+
+        /*!
+         * \brief     Determines whether any component of `s` is true.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `true` if any component of `s` is true.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<is_sized_bool<T>::value, bool>
+        any(const simd<T, N>& s) noexcept
+        {
+            return tue::math::movemask(s) != 0;
+        }
+
+        /*!
+         * \brief     Determines whether every component of `s` is true.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `true` if every component of `s` is true.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<is_sized_bool<T>::value, bool>
+        all(const simd<T, N>& s) noexcept
+        {
+            return tue::math::movemask(s) == ~std::uint64_t(0) >> (64 - N);
+        }
+
+        /*!
+         * \brief     Determines whether no component of `s` is true.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `true` if no component of `s` is true.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<is_sized_bool<T>::value, bool>
+        none(const simd<T, N>& s) noexcept
+        {
+            return tue::math::movemask(s) == 0;
+        }
+
+        /*!
+         * \brief     Counts the true components of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    The number of true components of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<is_sized_bool<T>::value, int>
+        count(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::popcount(tue::math::movemask(s));
+        }
+
         /*!
          * \brief      Computes `tue::math::less()` for each corresponding pair
          *             of components from `lhs` and `rhs`.
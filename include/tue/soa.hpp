@@ -0,0 +1,173 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include "quat.hpp"
+#include "simd.hpp"
+#include "vec.hpp"
+
+/*!
+ * \defgroup  soa_hpp <tue/soa.hpp>
+ *
+ * \brief     Conversions between arrays of vectors and vectors of `simd`'s.
+ *
+ * \details   An array of `N` `vec<T, M>`'s (array of structures, or AoS)
+ *            holds the same data as one `vec<simd<T, N>, M>` (structure of
+ *            arrays, or SoA), with component `j` of element `i` stored in
+ *            lane `i` of component `j`. The functions in this header
+ *            convert between the two. Where the current compiler
+ *            configuration supports it, `float` conversions use shuffle-based
+ *            transposes instead of copying one component at a time.
+ */
+namespace tue
+{
+    namespace detail_
+    {
+        template<typename T, int N, int M>
+        struct soa_s
+        {
+            static vec<simd<T, N>, M> load(const vec<T, M>* src) noexcept
+            {
+                vec<simd<T, N>, M> result;
+                for (int j = 0; j < M; ++j)
+                {
+                    for (int i = 0; i < N; ++i)
+                    {
+                        result[j].data()[i] = src[i][j];
+                    }
+                }
+                return result;
+            }
+
+            static void store(
+                const vec<simd<T, N>, M>& src, vec<T, M>* dst) noexcept
+            {
+                for (int j = 0; j < M; ++j)
+                {
+                    for (int i = 0; i < N; ++i)
+                    {
+                        dst[i][j] = src[j].data()[i];
+                    }
+                }
+            }
+        };
+    }
+}
+
+#ifdef TUE_SSE
+#include "detail_/soa/float32x4.sse.hpp"
+#endif
+
+#ifdef TUE_AVX
+#include "detail_/soa/float32x8.avx.hpp"
+#endif
+
+#ifdef TUE_AVX512
+#include "detail_/soa/float32x16.avx512.hpp"
+#endif
+
+namespace tue
+{
+    namespace soa
+    {
+        /*!
+         * \addtogroup  soa_hpp
+         * @{
+         */
+
+        /*!
+         * \brief      Loads `N` consecutive vectors into a vector of
+         *             `simd`'s.
+         *
+         * \details    The source array doesn't need to be aligned. If it
+         *             doesn't contain at least `N` vectors, behavior is
+         *             undefined.
+         *
+         * \tparam N   The number of vectors to load.
+         * \tparam T   The component type of each source vector.
+         * \tparam M   The component count of each source vector.
+         *
+         * \param src  The source vectors.
+         *
+         * \return     A vector whose component `j` holds component `j` of
+         *             each of `src[0]`, `src[1]`, ..., `src[N-1]`.
+         */
+        template<int N, typename T, int M>
+        inline vec<simd<T, N>, M> load(const vec<T, M>* src) noexcept
+        {
+            return tue::detail_::soa_s<T, N, M>::load(src);
+        }
+
+        /*!
+         * \brief      Stores a vector of `simd`'s as `N` consecutive
+         *             vectors.
+         *
+         * \details    This is the inverse of `load()`. The destination array
+         *             doesn't need to be aligned. If it doesn't contain room
+         *             for at least `N` vectors, behavior is undefined.
+         *
+         * \tparam T   The component type of each destination vector.
+         * \tparam N   The number of vectors to store.
+         * \tparam M   The component count of each destination vector.
+         *
+         * \param src  The vector of `simd`'s to store.
+         * \param dst  The destination vectors.
+         */
+        template<typename T, int N, int M>
+        inline void store(
+            const vec<simd<T, N>, M>& src, vec<T, M>* dst) noexcept
+        {
+            tue::detail_::soa_s<T, N, M>::store(src, dst);
+        }
+
+        /*!
+         * \brief      Loads `N` consecutive `quat`'s into a `quat` of
+         *             `simd`'s.
+         *
+         * \details    Works the same way as loading `vec4`'s.
+         *
+         * \tparam N   The number of `quat`'s to load.
+         * \tparam T   The component type of each source `quat`.
+         *
+         * \param src  The source `quat`'s.
+         *
+         * \return     A `quat` whose component `j` holds component `j` of
+         *             each of `src[0]`, `src[1]`, ..., `src[N-1]`.
+         */
+        template<int N, typename T>
+        inline quat<simd<T, N>> load(const quat<T>* src) noexcept
+        {
+            static_assert(sizeof(quat<T>) == sizeof(vec4<T>),
+                "quat<T> and vec4<T> must have the same layout");
+            return quat<simd<T, N>>(tue::detail_::soa_s<T, N, 4>::load(
+                reinterpret_cast<const vec4<T>*>(src)));
+        }
+
+        /*!
+         * \brief      Stores a `quat` of `simd`'s as `N` consecutive
+         *             `quat`'s.
+         *
+         * \details    This is the inverse of `load()`.
+         *
+         * \tparam T   The component type of each destination `quat`.
+         * \tparam N   The number of `quat`'s to store.
+         *
+         * \param src  The `quat` of `simd`'s to store.
+         * \param dst  The destination `quat`'s.
+         */
+        template<typename T, int N>
+        inline void store(const quat<simd<T, N>>& src, quat<T>* dst) noexcept
+        {
+            tue::detail_::soa_s<T, N, 4>::store(
+                src.xyzw(), reinterpret_cast<vec4<T>*>(dst));
+        }
+
+        /*!@}*/
+    }
+}
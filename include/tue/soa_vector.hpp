@@ -0,0 +1,505 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "detail_/aligned_allocator.hpp"
+#include "simd.hpp"
+#include "vec.hpp"
+
+/*!
+ * \defgroup  soa_vector_hpp <tue/soa_vector.hpp>
+ *
+ * \brief     The `soa_vector` class template.
+ */
+namespace tue
+{
+    /*!
+     * \addtogroup  soa_vector_hpp
+     * @{
+     */
+
+    /*!
+     * \brief     A dynamically-sized array of `V`'s stored in structure of
+     *            arrays (SoA) layout.
+     * \details   Only `vec` element types are supported. See
+     *            `soa_vector<vec<T, M>, N>`.
+     *
+     * \tparam V  The element type.
+     * \tparam N  The number of elements per block.
+     */
+    template<typename V, int N = 4>
+    class soa_vector;
+
+    /*!
+     * \brief     A dynamically-sized array of `vec<T, M>`'s stored in
+     *            aligned `vec<simd<T, N>, M>` blocks.
+     * \details   Element `i` is stored in lane `i % N` of block `i / N`, so
+     *            whole blocks can be handed to any function that operates
+     *            on `vec<simd<T, N>, M>`'s. The lanes of the last block past
+     *            `size()` are padding. Every member function that adds or
+     *            removes elements sets them to zero.
+     *
+     * \tparam T  The component type of each element.
+     * \tparam M  The component count of each element.
+     * \tparam N  The number of elements per block.
+     */
+    template<typename T, int M, int N>
+    class soa_vector<vec<T, M>, N>
+    {
+    public:
+        /*!
+         * \brief  The element type.
+         */
+        using value_type = vec<T, M>;
+
+        /*!
+         * \brief  The type each block of `N` elements is stored as.
+         */
+        using block_type = vec<simd<T, N>, M>;
+
+        /*!
+         * \brief  An unsigned integer type for sizes and indices.
+         */
+        using size_type = std::size_t;
+
+    private:
+        using storage_type = std::vector<
+            block_type, tue::detail_::aligned_allocator<block_type>>;
+
+        storage_type blocks_;
+
+        size_type size_ = 0;
+
+        static block_type zero_block() noexcept
+        {
+            return block_type(simd<T, N>(T(0)));
+        }
+
+        static size_type block_count_for(size_type count) noexcept
+        {
+            return (count + N - 1) / N;
+        }
+
+        void clear_lane(size_type i) noexcept
+        {
+            auto& block = blocks_[i / N];
+            for (int j = 0; j < M; ++j)
+            {
+                block[j].data()[i % N] = T(0);
+            }
+        }
+
+        void clear_padding() noexcept
+        {
+            for (auto i = size_; i < blocks_.size() * N; ++i)
+            {
+                this->clear_lane(i);
+            }
+        }
+
+    public:
+        /*!
+         * \brief  A proxy reference to one element of a `soa_vector`.
+         */
+        class reference
+        {
+            block_type* block_;
+
+            int lane_;
+
+        public:
+            /*!
+             * \brief        Constructs a reference to lane `lane` of
+             *               `block`.
+             *
+             * \param block  The block that contains the element.
+             * \param lane   The lane of `block` the element is stored in.
+             */
+            reference(block_type& block, int lane) noexcept
+            :
+                block_(&block),
+                lane_(lane)
+            {
+            }
+
+            /*!
+             * \brief  Copy constructs a `reference` to the same element.
+             */
+            reference(const reference&) noexcept = default;
+
+            /*!
+             * \brief   Returns a copy of the referenced element.
+             *
+             * \return  A copy of the referenced element.
+             */
+            operator vec<T, M>() const noexcept
+            {
+                vec<T, M> result;
+                for (int j = 0; j < M; ++j)
+                {
+                    result[j] = (*block_)[j].data()[lane_];
+                }
+                return result;
+            }
+
+            /*!
+             * \brief    Returns a reference to a component of the referenced
+             *           element.
+             *
+             * \param j  The index of the component.
+             *
+             * \return   A reference to component `j`.
+             */
+            T& operator[](int j) const noexcept
+            {
+                return (*block_)[j].data()[lane_];
+            }
+
+            /*!
+             * \brief    Assigns `v` to the referenced element.
+             *
+             * \param v  The new value.
+             *
+             * \return   A reference to this `reference`.
+             */
+            const reference& operator=(const vec<T, M>& v) const noexcept
+            {
+                for (int j = 0; j < M; ++j)
+                {
+                    (*block_)[j].data()[lane_] = v[j];
+                }
+                return *this;
+            }
+
+            /*!
+             * \brief    Assigns the element `r` refers to to the element this
+             *           `reference` refers to.
+             *
+             * \param r  A reference to the new value.
+             *
+             * \return   A reference to this `reference`.
+             */
+            const reference& operator=(const reference& r) const noexcept
+            {
+                return *this = static_cast<vec<T, M>>(r);
+            }
+        };
+
+        /*!
+         * \brief  An iterator over the blocks of a `soa_vector`.
+         */
+        using block_iterator = typename storage_type::iterator;
+
+        /*!
+         * \brief  A const iterator over the blocks of a `soa_vector`.
+         */
+        using const_block_iterator = typename storage_type::const_iterator;
+
+        /*!
+         * \name Constructors
+         * @{
+         */
+        /*!
+         * \brief  Constructs an empty `soa_vector`.
+         */
+        soa_vector() noexcept = default;
+
+        /*!
+         * \brief        Constructs a `soa_vector` with `count` zero elements.
+         *
+         * \param count  The number of elements.
+         */
+        explicit soa_vector(size_type count)
+        :
+            blocks_(block_count_for(count), zero_block()),
+            size_(count)
+        {
+        }
+
+        /*!
+         * \brief         Constructs a `soa_vector` with a copy of each
+         *                element of `values`.
+         *
+         * \param values  The elements to copy.
+         */
+        soa_vector(std::initializer_list<vec<T, M>> values)
+        {
+            this->reserve(values.size());
+            for (const auto& v : values)
+            {
+                this->push_back(v);
+            }
+        }
+        /*!@}*/
+
+        /*!
+         * \name Element Access
+         * @{
+         */
+        /*!
+         * \brief    Returns a proxy reference to the element at index `i`.
+         *
+         * \param i  The index of the element. Must be less than `size()`.
+         *
+         * \return   A proxy reference to the element at index `i`.
+         */
+        reference operator[](size_type i) noexcept
+        {
+            return { blocks_[i / N], static_cast<int>(i % N) };
+        }
+
+        /*!
+         * \brief    Returns a copy of the element at index `i`.
+         *
+         * \param i  The index of the element. Must be less than `size()`.
+         *
+         * \return   A copy of the element at index `i`.
+         */
+        vec<T, M> operator[](size_type i) const noexcept
+        {
+            vec<T, M> result;
+            for (int j = 0; j < M; ++j)
+            {
+                result[j] = blocks_[i / N][j].data()[i % N];
+            }
+            return result;
+        }
+
+        /*!
+         * \brief    Returns a reference to the block at index `i`.
+         *
+         * \param i  The index of the block. Must be less than
+         *           `block_count()`.
+         *
+         * \return   A reference to the block at index `i`.
+         */
+        block_type& block(size_type i) noexcept
+        {
+            return blocks_[i];
+        }
+
+        /*!
+         * \brief    Returns a reference to the block at index `i`.
+         *
+         * \param i  The index of the block. Must be less than
+         *           `block_count()`.
+         *
+         * \return   A reference to the block at index `i`.
+         */
+        const block_type& block(size_type i) const noexcept
+        {
+            return blocks_[i];
+        }
+        /*!@}*/
+
+        /*!
+         * \name Block Iterators
+         * @{
+         */
+        /*!
+         * \brief   Returns an iterator to the first block.
+         *
+         * \return  An iterator to the first block.
+         */
+        block_iterator block_begin() noexcept
+        {
+            return blocks_.begin();
+        }
+
+        /*!
+         * \brief   Returns an iterator to the first block.
+         *
+         * \return  An iterator to the first block.
+         */
+        const_block_iterator block_begin() const noexcept
+        {
+            return blocks_.begin();
+        }
+
+        /*!
+         * \brief   Returns an iterator past the last block.
+         *
+         * \return  An iterator past the last block.
+         */
+        block_iterator block_end() noexcept
+        {
+            return blocks_.end();
+        }
+
+        /*!
+         * \brief   Returns an iterator past the last block.
+         *
+         * \return  An iterator past the last block.
+         */
+        const_block_iterator block_end() const noexcept
+        {
+            return blocks_.end();
+        }
+        /*!@}*/
+
+        /*!
+         * \name Capacity
+         * @{
+         */
+        /*!
+         * \brief   Returns whether or not this `soa_vector` has no elements.
+         *
+         * \return  `true` if `size()` is `0`.
+         */
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        /*!
+         * \brief   Returns the number of elements.
+         *
+         * \return  The number of elements.
+         */
+        size_type size() const noexcept
+        {
+            return size_;
+        }
+
+        /*!
+         * \brief   Returns the number of blocks.
+         *
+         * \return  `size()` divided by `N`, rounded up.
+         */
+        size_type block_count() const noexcept
+        {
+            return blocks_.size();
+        }
+
+        /*!
+         * \brief        Reserves room for at least `count` elements.
+         *
+         * \param count  The number of elements to reserve room for.
+         */
+        void reserve(size_type count)
+        {
+            blocks_.reserve(block_count_for(count));
+        }
+        /*!@}*/
+
+        /*!
+         * \name Modifiers
+         * @{
+         */
+        /*!
+         * \brief  Removes all elements.
+         */
+        void clear() noexcept
+        {
+            blocks_.clear();
+            size_ = 0;
+        }
+
+        /*!
+         * \brief    Appends a copy of `v`.
+         *
+         * \param v  The element to append.
+         */
+        void push_back(const vec<T, M>& v)
+        {
+            if (size_ % N == 0)
+            {
+                blocks_.push_back(zero_block());
+            }
+            (*this)[size_++] = v;
+        }
+
+        /*!
+         * \brief  Removes the last element. `size()` must not be `0`.
+         */
+        void pop_back() noexcept
+        {
+            this->clear_lane(--size_);
+            if (size_ % N == 0)
+            {
+                blocks_.pop_back();
+            }
+        }
+
+        /*!
+         * \brief        Changes the number of elements to `count`.
+         * \details      Any new elements are zero.
+         *
+         * \param count  The new number of elements.
+         */
+        void resize(size_type count)
+        {
+            this->clear_padding();
+            blocks_.resize(block_count_for(count), zero_block());
+            size_ = count;
+            this->clear_padding();
+        }
+
+        /*!
+         * \brief        Swaps the contents of this `soa_vector` with
+         *               `other`.
+         *
+         * \param other  The `soa_vector` to swap with.
+         */
+        void swap(soa_vector& other) noexcept
+        {
+            blocks_.swap(other.blocks_);
+            std::swap(size_, other.size_);
+        }
+        /*!@}*/
+
+        /*!
+         * \name Block Algorithms
+         * @{
+         */
+        /*!
+         * \brief     Calls `f` with a reference to each block in order.
+         * \details   The padding lanes of the last block are set back to
+         *            zero afterwards, so `f` can write to every lane.
+         *
+         * \tparam F  The type of `f`.
+         *
+         * \param f   A function object callable with a `block_type&`.
+         */
+        template<typename F>
+        void for_each_block(F&& f)
+        {
+            for (auto& block : blocks_)
+            {
+                f(block);
+            }
+            this->clear_padding();
+        }
+
+        /*!
+         * \brief     Calls `f` with a const reference to each block in
+         *            order.
+         *
+         * \tparam F  The type of `f`.
+         *
+         * \param f   A function object callable with a `const block_type&`.
+         */
+        template<typename F>
+        void for_each_block(F&& f) const
+        {
+            for (const auto& block : blocks_)
+            {
+                f(block);
+            }
+        }
+        /*!@}*/
+    };
+
+    /*!@}*/
+}
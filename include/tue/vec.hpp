@@ -1947,6 +1947,89 @@ namespace tue
             tue::detail_::sincos_v(v, sin_out, cos_out);
         }
 
+        /*!
+         * \brief     Computes `tue::math::tan()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::tan()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> tan(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::tan_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::asin()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::asin()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> asin(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::asin_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::acos()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::acos()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> acos(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::acos_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::atan()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::atan()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> atan(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::atan_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::atan2()` for each component of `y`
+         *            and each corresponding component of `x`.
+         *
+         * \tparam T  The component type of both `y` and `x`.
+         * \tparam N  The component count of both `y` and `x`.
+         *
+         * \param y   The numerators.
+         * \param x   The denominators.
+         *
+         * \return    `tue::math::atan2()` for each component of `y` and each
+         *            corresponding component of `x`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> atan2(const vec<T, N>& y, const vec<T, N>& x) noexcept
+        {
+            return tue::detail_::atan2_vv(y, x);
+        }
+
         /*!
          * \brief     Computes `tue::math::exp()` for each component of `v`.
          *
@@ -1979,6 +2062,38 @@ namespace tue
             return tue::detail_::log_v(v);
         }
 
+        /*!
+         * \brief     Computes `tue::math::exp2()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::exp2()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> exp2(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::exp2_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::log2()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::log2()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> log2(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::log2_v(v);
+        }
+
         /*!
          * \brief     Computes `tue::math::abs()` for each component of `v`.
          *
@@ -0,0 +1,144 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/affine.hpp>
+#include "tue.tests.hpp"
+
+#include <type_traits>
+
+#include <tue/mat.hpp>
+#include <tue/transform.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    const dmat4x4 dm1 =
+        transform::scale_mat(2.0, 0.5, 4.0)
+        * transform::rotation_mat(0.3, -0.4, 0.5)
+        * transform::translation_mat(1.5, -2.0, 3.0);
+
+    const dmat4x4 dm2 =
+        transform::rotation_mat(-0.6, 0.1, 0.2)
+        * transform::translation_mat(-4.0, 0.5, 2.5);
+
+    const dvec3 dv(1.2, -3.4, 5.6);
+
+    TEST_CASE(size)
+    {
+        test_assert(sizeof(faffine) == sizeof(float[12]));
+        test_assert(sizeof(daffine) == sizeof(double[12]));
+    }
+
+    TEST_CASE(linear_and_translation_constructor)
+    {
+        CONST_OR_CONSTEXPR dmat3x3 linear(
+            dvec3(1.0, 2.0, 3.0),
+            dvec3(4.0, 5.0, 6.0),
+            dvec3(7.0, 8.0, 9.0));
+        CONST_OR_CONSTEXPR dvec3 translation(1.0, 2.0, 3.0);
+        CONST_OR_CONSTEXPR daffine a(linear, translation);
+        test_assert(a.linear() == linear);
+        test_assert(a.translation() == translation);
+    }
+
+    TEST_CASE(mat_constructors)
+    {
+        const daffine a(dm1);
+        test_assert(a.to_mat3x4() == dmat3x4(dm1));
+        test_assert(a.to_mat4x4() == dm1);
+        test_assert(daffine(dmat3x4(dm1)) == a);
+        test_assert(a.translation() == dvec3(dm1[0][3], dm1[1][3], dm1[2][3]));
+    }
+
+    TEST_CASE(explicit_conversion_constructor)
+    {
+        const daffine a(dm1);
+        const faffine f(a);
+        test_assert(f.to_mat3x4() == fmat3x4(a.to_mat3x4()));
+    }
+
+    TEST_CASE(identity)
+    {
+        CONST_OR_CONSTEXPR auto a = daffine::identity();
+        test_assert(a.to_mat4x4() == dmat4x4::identity());
+    }
+
+    TEST_CASE(setters)
+    {
+        auto a = daffine::identity();
+        a.set_linear(dmat3x3(dm2));
+        a.set_translation(dv);
+        test_assert(a.linear() == dmat3x3(dm2));
+        test_assert(a.translation() == dv);
+    }
+
+    TEST_CASE(composition)
+    {
+        const daffine a(dm1);
+        const daffine b(dm2);
+        test_assert(nearly_equal((a * b).to_mat4x4(), dm1 * dm2));
+
+        auto c = a;
+        c *= b;
+        test_assert(c == a * b);
+
+        const faffine f(a);
+        const auto mixed = f * b;
+        test_assert((std::is_same<decltype(mixed), const daffine>::value));
+    }
+
+    TEST_CASE(vec4_multiplication_operator)
+    {
+        const daffine a(dm1);
+        const dvec4 point(dv, 1.0);
+        const dvec4 vector(dv, 0.0);
+        test_assert((point * a).w() == 1.0);
+        test_assert((vector * a).w() == 0.0);
+        test_assert(nearly_equal((point * a).xyz(), (point * dm1).xyz()));
+        test_assert(nearly_equal((vector * a).xyz(), (vector * dm1).xyz()));
+    }
+
+    TEST_CASE(transform_point)
+    {
+        const daffine a(dm1);
+        test_assert(nearly_equal(
+            math::transform_point(dv, a), (dvec4(dv, 1.0) * dm1).xyz()));
+    }
+
+    TEST_CASE(transform_vector)
+    {
+        const daffine a(dm1);
+        test_assert(nearly_equal(
+            math::transform_vector(dv, a), (dvec4(dv, 0.0) * dm1).xyz()));
+    }
+
+    TEST_CASE(inverse)
+    {
+        const daffine a(dm1);
+        const auto inv = math::inverse(a);
+        test_assert(nearly_equal(inv.to_mat4x4(), math::inverse(dm1)));
+        test_assert(nearly_equal(
+            math::transform_point(math::transform_point(dv, a), inv), dv));
+
+        const faffine f(a);
+        test_assert(nearly_equal(
+            (f * math::inverse(f)).to_mat4x4(), fmat4x4::identity()));
+    }
+
+    TEST_CASE(equality_operator)
+    {
+        const daffine a(dm1);
+        const daffine b(dm2);
+        test_assert(a == a);
+        test_assert(!(a == b));
+        test_assert(a != b);
+        test_assert(!(a != a));
+    }
+}
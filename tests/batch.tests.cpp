@@ -0,0 +1,413 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/batch.hpp>
+#include "tue.tests.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <tue/mat.hpp>
+#include <tue/math.hpp>
+#include <tue/quat.hpp>
+#include <tue/transform.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    const batch::isa isas[] = {
+        batch::isa::generic,
+        batch::isa::sse2,
+        batch::isa::avx2,
+        batch::isa::avx512,
+    };
+
+    // Enough elements to cover every kernel's main loop and tail.
+    constexpr std::size_t max_count = 41;
+
+    bool close(const fvec3& actual, const fvec3& expected) noexcept
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            const auto tolerance = 0.0001f * (1.0f + std::abs(expected[i]));
+            if (std::abs(actual[i] - expected[i]) > tolerance)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<fvec3> make_vectors(std::size_t count)
+    {
+        std::vector<fvec3> result;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto f = static_cast<float>(i);
+            result.emplace_back(
+                1.5f + 0.25f * f,
+                -2.0f + 0.5f * math::sin(f),
+                0.75f - 0.125f * f);
+        }
+        return result;
+    }
+
+    std::vector<fquat> make_rotations(std::size_t count)
+    {
+        std::vector<fquat> result;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto f = static_cast<float>(i);
+            const fvec3 axis = math::normalize(fvec3(
+                1.0f + math::cos(f), 0.5f * f - 3.0f, 2.0f));
+            result.push_back(transform::rotation_quat(axis, 0.3f * f));
+        }
+        return result;
+    }
+
+    // Repeats values until there are count of them, keeping big arrays
+    // within the magnitudes close() is tuned for.
+    template<typename T>
+    std::vector<T> repeat(const std::vector<T>& values, std::size_t count)
+    {
+        std::vector<T> result;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result.push_back(values[i % values.size()]);
+        }
+        return result;
+    }
+
+    template<typename T>
+    mat<T, 4, 4> make_transform() noexcept
+    {
+        return {
+            vec4<T>(T(1.1), T(-0.2), T(0.3), T(4.0)),
+            vec4<T>(T(0.4), T(0.9), T(-0.6), T(-5.0)),
+            vec4<T>(T(-0.7), T(0.8), T(1.2), T(6.0)),
+            vec4<T>(T(0.0), T(0.0), T(0.0), T(1.0)),
+        };
+    }
+
+    // A perspective projection-like matrix whose w output isn't 1.
+    template<typename T>
+    mat<T, 4, 4> make_projection() noexcept
+    {
+        return {
+            vec4<T>(T(1.5), T(0.1), T(0.0), T(0.5)),
+            vec4<T>(T(0.0), T(2.0), T(-0.3), T(-1.0)),
+            vec4<T>(T(0.2), T(0.0), T(-1.1), T(-0.4)),
+            vec4<T>(T(0.05), T(-0.02), T(0.1), T(40.0)),
+        };
+    }
+
+    TEST_CASE(set_active_isa)
+    {
+        const auto supported = batch::supported_isa();
+        for (const auto isa : isas)
+        {
+            const auto selected = batch::set_active_isa(isa);
+            test_assert(batch::active_isa() == selected);
+            test_assert(static_cast<int>(selected)
+                <= static_cast<int>(supported));
+            test_assert(selected == isa || selected == supported);
+        }
+        test_assert(batch::set_active_isa(batch::isa::avx512) == supported);
+    }
+
+    TEST_CASE(transform_points)
+    {
+        const auto m = make_transform<float>();
+
+        for (const auto isa : isas)
+        {
+            batch::set_active_isa(isa);
+            for (std::size_t count = 0; count <= max_count; ++count)
+            {
+                const auto in = make_vectors(count);
+                std::vector<fvec3> out(count);
+                batch::transform_points(m, in.data(), out.data(), count);
+
+                auto in_place = in;
+                batch::transform_points(
+                    m, in_place.data(), in_place.data(), count);
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const auto expected = (fvec4(in[i], 1.0f) * m).xyz();
+                    test_assert(close(out[i], expected));
+                    test_assert(close(in_place[i], expected));
+                }
+            }
+        }
+        batch::set_active_isa(batch::supported_isa());
+    }
+
+    TEST_CASE(transform_vectors)
+    {
+        const auto m = make_transform<float>();
+        for (const auto isa : isas)
+        {
+            batch::set_active_isa(isa);
+            for (std::size_t count = 0; count <= max_count; ++count)
+            {
+                const auto in = make_vectors(count);
+                std::vector<fvec3> out(count);
+                batch::transform_vectors(m, in.data(), out.data(), count);
+
+                auto in_place = in;
+                batch::transform_vectors(
+                    m, in_place.data(), in_place.data(), count);
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const auto expected = (fvec4(in[i], 0.0f) * m).xyz();
+                    test_assert(close(out[i], expected));
+                    test_assert(close(in_place[i], expected));
+                }
+            }
+        }
+        batch::set_active_isa(batch::supported_isa());
+    }
+
+    TEST_CASE(transform_homogeneous)
+    {
+        const auto m = make_projection<float>();
+        for (const auto isa : isas)
+        {
+            batch::set_active_isa(isa);
+            for (std::size_t count = 0; count <= max_count; ++count)
+            {
+                const auto in = make_vectors(count);
+                std::vector<fvec3> out(count);
+                batch::transform_homogeneous(
+                    m, in.data(), out.data(), count);
+
+                auto in_place = in;
+                batch::transform_homogeneous(
+                    m, in_place.data(), in_place.data(), count);
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const auto r = fvec4(in[i], 1.0f) * m;
+                    const auto expected = r.xyz() / r[3];
+                    test_assert(close(out[i], expected));
+                    test_assert(close(in_place[i], expected));
+                }
+            }
+        }
+        batch::set_active_isa(batch::supported_isa());
+    }
+
+    TEST_CASE(transform_double)
+    {
+        const auto m = make_transform<double>();
+        const auto p = make_projection<double>();
+        for (std::size_t count = 0; count <= max_count; ++count)
+        {
+            std::vector<dvec3> in;
+            for (const auto& v : make_vectors(count))
+            {
+                in.push_back(dvec3(v));
+            }
+            std::vector<dvec3> points(count);
+            std::vector<dvec3> vectors(count);
+            std::vector<dvec3> homogeneous(count);
+            batch::transform_points(m, in.data(), points.data(), count);
+            batch::transform_vectors(m, in.data(), vectors.data(), count);
+            batch::transform_homogeneous(
+                p, in.data(), homogeneous.data(), count);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const auto r = dvec4(in[i], 1.0) * p;
+                test_assert(math::length(
+                    points[i] - (dvec4(in[i], 1.0) * m).xyz()) < 1e-9);
+                test_assert(math::length(
+                    vectors[i] - (dvec4(in[i], 0.0) * m).xyz()) < 1e-9);
+                test_assert(math::length(
+                    homogeneous[i] - r.xyz() / r[3]) < 1e-9);
+            }
+        }
+    }
+
+    TEST_CASE(normalize)
+    {
+        for (const auto isa : isas)
+        {
+            batch::set_active_isa(isa);
+            for (std::size_t count = 0; count <= max_count; ++count)
+            {
+                const auto in = make_vectors(count);
+                std::vector<fvec3> out(count);
+                batch::normalize(in.data(), out.data(), count);
+
+                auto in_place = in;
+                batch::normalize(in_place.data(), in_place.data(), count);
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const auto expected = math::normalize(in[i]);
+                    test_assert(close(out[i], expected));
+                    test_assert(close(in_place[i], expected));
+                }
+            }
+        }
+        batch::set_active_isa(batch::supported_isa());
+    }
+
+    TEST_CASE(rotate)
+    {
+        for (const auto isa : isas)
+        {
+            batch::set_active_isa(isa);
+            for (std::size_t count = 0; count <= max_count; ++count)
+            {
+                const auto rotations = make_rotations(count);
+                const auto in = make_vectors(count);
+                std::vector<fvec3> out(count);
+                batch::rotate(rotations.data(), in.data(), out.data(), count);
+
+                auto in_place = in;
+                batch::rotate(
+                    rotations.data(), in_place.data(), in_place.data(),
+                    count);
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const auto expected = in[i] * rotations[i];
+                    test_assert(close(out[i], expected));
+                    test_assert(close(in_place[i], expected));
+                }
+            }
+        }
+        batch::set_active_isa(batch::supported_isa());
+    }
+
+    TEST_CASE(rotate_double)
+    {
+        for (std::size_t count = 0; count <= max_count; ++count)
+        {
+            std::vector<dquat> rotations;
+            for (const auto& q : make_rotations(count))
+            {
+                rotations.push_back(math::normalize(dquat(q)));
+            }
+            std::vector<dvec3> in;
+            for (const auto& v : make_vectors(count))
+            {
+                in.push_back(dvec3(v));
+            }
+            std::vector<dvec3> out(count);
+            batch::rotate(rotations.data(), in.data(), out.data(), count);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                test_assert(
+                    math::length(out[i] - in[i] * rotations[i]) < 1e-9);
+            }
+        }
+    }
+
+    TEST_CASE(compose)
+    {
+        for (std::size_t count = 0; count <= max_count; ++count)
+        {
+            const auto lhs = make_rotations(count);
+            auto rhs = make_rotations(count + 3);
+            rhs.erase(rhs.begin(), rhs.begin() + 3);
+            std::vector<fquat> out(count);
+            batch::compose(lhs.data(), rhs.data(), out.data(), count);
+
+            auto in_place = lhs;
+            batch::compose(
+                in_place.data(), rhs.data(), in_place.data(), count);
+
+            std::vector<dquat> dlhs;
+            std::vector<dquat> drhs;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                dlhs.push_back(dquat(lhs[i]));
+                drhs.push_back(dquat(rhs[i]));
+            }
+            std::vector<dquat> dout(count);
+            batch::compose(dlhs.data(), drhs.data(), dout.data(), count);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const auto expected = lhs[i] * rhs[i];
+                test_assert(close(out[i].v(), expected.v()));
+                test_assert(close(fvec3(out[i].s()), fvec3(expected.s())));
+                test_assert(out[i] == in_place[i]);
+                test_assert(math::length(
+                    dout[i].xyzw() - (dlhs[i] * drhs[i]).xyzw()) < 1e-12);
+            }
+        }
+    }
+
+    TEST_CASE(stream)
+    {
+        const auto m = make_transform<float>();
+        const auto p = make_projection<float>();
+
+        // Big enough to be streamed, with an odd tail.
+        const auto count = batch::stream_threshold / sizeof(fvec3) + 5;
+        const auto rotations = repeat(make_rotations(max_count), count);
+        const auto in = repeat(make_vectors(max_count), count);
+        std::vector<fvec3> buffer(count + 3);
+
+        for (const auto isa : isas)
+        {
+            batch::set_active_isa(isa);
+
+            // Each offset needs a different number of unstreamed elements
+            // before the output is 16-byte aligned.
+            for (std::size_t offset = 0; offset < 4; ++offset)
+            {
+                const auto out = buffer.data() + offset;
+
+                batch::transform_points(m, in.data(), out, count);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    test_assert(close(
+                        out[i], (fvec4(in[i], 1.0f) * m).xyz()));
+                }
+
+                batch::transform_vectors(m, in.data(), out, count);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    test_assert(close(
+                        out[i], (fvec4(in[i], 0.0f) * m).xyz()));
+                }
+
+                batch::transform_homogeneous(p, in.data(), out, count);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const auto r = fvec4(in[i], 1.0f) * p;
+                    test_assert(close(out[i], r.xyz() / r[3]));
+                }
+
+                batch::normalize(in.data(), out, count);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    test_assert(close(out[i], math::normalize(in[i])));
+                }
+
+                batch::rotate(rotations.data(), in.data(), out, count);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    test_assert(close(out[i], in[i] * rotations[i]));
+                }
+            }
+        }
+        batch::set_active_isa(batch::supported_isa());
+    }
+}
@@ -0,0 +1,256 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/dual_quat.hpp>
+#include "tue.tests.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+#include <tue/mat.hpp>
+#include <tue/quat.hpp>
+#include <tue/simd.hpp>
+#include <tue/transform.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    const dquat dq1 = transform::rotation_quat(0.3, -0.4, 0.5);
+    const dquat dq2 = transform::rotation_quat(-0.6, 0.1, 0.2);
+    const dvec3 dt1(1.5, -2.0, 3.0);
+    const dvec3 dt2(-4.0, 0.5, 2.5);
+
+    const dmat4x4 dm1 =
+        transform::rotation_mat(dq1) * transform::translation_mat(dt1);
+
+    const dmat4x4 dm2 =
+        transform::rotation_mat(dq2) * transform::translation_mat(dt2);
+
+    const dvec3 dv(1.2, -3.4, 5.6);
+
+    template<typename T>
+    bool nearly_equal(
+        const dual_quat<T>& actual, const dual_quat<T>& expected) noexcept
+    {
+        return nearly_equal(actual.real().xyzw(), expected.real().xyzw())
+            && nearly_equal(actual.dual().xyzw(), expected.dual().xyzw());
+    }
+
+    TEST_CASE(size)
+    {
+        test_assert(sizeof(fdual_quat) == sizeof(float[8]));
+        test_assert(sizeof(ddual_quat) == sizeof(double[8]));
+        test_assert(
+            sizeof(dual_quat<float32x4>) == sizeof(float32x4[8]));
+    }
+
+    TEST_CASE(real_and_dual_constructor)
+    {
+        CONST_OR_CONSTEXPR dquat real(1.0, 2.0, 3.0, 4.0);
+        CONST_OR_CONSTEXPR dquat dual(5.0, 6.0, 7.0, 8.0);
+        CONST_OR_CONSTEXPR ddual_quat dq(real, dual);
+        test_assert(dq.real() == real);
+        test_assert(dq.dual() == dual);
+    }
+
+    TEST_CASE(rotation_and_translation_constructor)
+    {
+        const ddual_quat dq(dq1, dt1);
+        test_assert(dq.rotation() == dq1);
+        test_assert(nearly_equal(dq.translation(), dt1));
+        test_assert(nearly_equal(dq.to_mat4x4(), dm1));
+    }
+
+    TEST_CASE(mat_constructor)
+    {
+        test_assert(nearly_equal(ddual_quat(dm1), ddual_quat(dq1, dt1)));
+        test_assert(nearly_equal(ddual_quat(dm2), ddual_quat(dq2, dt2)));
+
+        // Each rotation below makes a different diagonal entry the largest.
+        const dvec3 axes[] = {
+            dvec3(1.0, 0.0, 0.0),
+            dvec3(0.0, 1.0, 0.0),
+            dvec3(0.0, 0.0, 1.0),
+            math::normalize(dvec3(1.0, 1.0, 0.0)),
+        };
+        for (const auto& axis : axes)
+        {
+            const auto q = transform::rotation_quat(axis, 3.0);
+            const auto m = transform::rotation_mat(q);
+            test_assert(nearly_equal(ddual_quat(m).to_mat4x4(), m));
+        }
+    }
+
+    TEST_CASE(explicit_conversion_constructor)
+    {
+        const ddual_quat dq(dq1, dt1);
+        const fdual_quat f(dq);
+        test_assert(f.real() == fquat(dq.real()));
+        test_assert(f.dual() == fquat(dq.dual()));
+    }
+
+    TEST_CASE(identity)
+    {
+        CONST_OR_CONSTEXPR auto dq = ddual_quat::identity();
+        test_assert(dq.to_mat4x4() == dmat4x4::identity());
+    }
+
+    TEST_CASE(setters)
+    {
+        auto dq = ddual_quat::identity();
+        dq.set_real(dq1);
+        dq.set_dual(dq2);
+        test_assert(dq.real() == dq1);
+        test_assert(dq.dual() == dq2);
+    }
+
+    TEST_CASE(composition)
+    {
+        const ddual_quat a(dq1, dt1);
+        const ddual_quat b(dq2, dt2);
+        test_assert(nearly_equal((a * b).to_mat4x4(), dm1 * dm2));
+
+        auto c = a;
+        c *= b;
+        test_assert(c == a * b);
+
+        const fdual_quat f(a);
+        const auto mixed = f * b;
+        test_assert((std::is_same<decltype(mixed), const ddual_quat>::value));
+    }
+
+    TEST_CASE(transform_point)
+    {
+        const ddual_quat dq(dq1, dt1);
+        test_assert(nearly_equal(
+            math::transform_point(dv, dq), (dvec4(dv, 1.0) * dm1).xyz()));
+    }
+
+    TEST_CASE(transform_vector)
+    {
+        const ddual_quat dq(dq1, dt1);
+        test_assert(nearly_equal(
+            math::transform_vector(dv, dq), (dvec4(dv, 0.0) * dm1).xyz()));
+    }
+
+    TEST_CASE(normalize)
+    {
+        const ddual_quat dq(dq1, dt1);
+        const ddual_quat scaled(
+            dquat(dq.real().v() * 3.0, dq.real().s() * 3.0),
+            dquat(dq.dual().v() * 3.0 + dvec3(0.1), dq.dual().s() * 3.0));
+        const auto n = math::normalize(scaled);
+        test_assert(nearly_equal(math::length(dvec4(
+            n.real()[0], n.real()[1], n.real()[2], n.real()[3])), 1.0));
+        test_assert(std::abs(
+            n.real()[0]*n.dual()[0] + n.real()[1]*n.dual()[1]
+            + n.real()[2]*n.dual()[2] + n.real()[3]*n.dual()[3]) < 1e-12);
+        test_assert(nearly_equal(math::normalize(dq), dq));
+    }
+
+    TEST_CASE(blend)
+    {
+        const ddual_quat a(dq1, dt1);
+        const ddual_quat b(dq2, dt2);
+
+        const ddual_quat single[] = { a };
+        const double one[] = { 1.0 };
+        test_assert(nearly_equal(math::blend(single, one, 1), a));
+
+        const ddual_quat same[] = { a, a };
+        const double halves[] = { 0.5, 0.5 };
+        test_assert(nearly_equal(math::blend(same, halves, 2), a));
+
+        // The negation of a dual_quat is the same transformation, so it
+        // must not cancel out the other one.
+        const ddual_quat flipped[] = {
+            a,
+            ddual_quat(
+                dquat(-a.real()[0], -a.real()[1], -a.real()[2], -a.real()[3]),
+                dquat(-a.dual()[0], -a.dual()[1], -a.dual()[2], -a.dual()[3])),
+        };
+        test_assert(nearly_equal(math::blend(flipped, halves, 2), a));
+
+        const ddual_quat pair[] = { a, b };
+        const double weights[] = { 0.25, 0.75 };
+        const auto blended = math::blend(pair, weights, 2);
+        test_assert(nearly_equal(math::length(dvec4(
+            blended.real()[0], blended.real()[1],
+            blended.real()[2], blended.real()[3])), 1.0));
+        test_assert(nearly_equal(
+            math::transform_point(dv, blended),
+            (dvec4(dv, 1.0) * blended.to_mat4x4()).xyz()));
+    }
+
+    TEST_CASE(blend_simd)
+    {
+        // Each lane blends its own pair of bones, as in vertex skinning.
+        const fdual_quat bones[] = {
+            fdual_quat(ddual_quat(dq1, dt1)),
+            fdual_quat(ddual_quat(dq2, dt2)),
+            fdual_quat(ddual_quat(dq2 * dq1, dt1 + dt2)),
+            fdual_quat::identity(),
+        };
+        const float lane_weights[] = { 0.0f, 0.3f, 0.5f, 1.0f };
+
+        dual_quat<float32x4> dqs[2];
+        float32x4 weights[2];
+        vec3<float32x4> points;
+        for (int k = 0; k < 4; ++k)
+        {
+            const auto& b0 = bones[k];
+            const auto& b1 = bones[(k + 1) % 4];
+            for (int i = 0; i < 4; ++i)
+            {
+                auto r0 = dqs[0].real();
+                auto d0 = dqs[0].dual();
+                auto r1 = dqs[1].real();
+                auto d1 = dqs[1].dual();
+                r0[i].data()[k] = b0.real()[i];
+                d0[i].data()[k] = b0.dual()[i];
+                r1[i].data()[k] = b1.real()[i];
+                d1[i].data()[k] = b1.dual()[i];
+                dqs[0] = dual_quat<float32x4>(r0, d0);
+                dqs[1] = dual_quat<float32x4>(r1, d1);
+            }
+            weights[0].data()[k] = 1.0f - lane_weights[k];
+            weights[1].data()[k] = lane_weights[k];
+            for (int i = 0; i < 3; ++i)
+            {
+                points[i].data()[k] = float(dv[i]) + float(k);
+            }
+        }
+
+        const auto blended = math::blend(dqs, weights, 2);
+        const auto skinned = math::transform_point(points, blended);
+        for (int k = 0; k < 4; ++k)
+        {
+            const fdual_quat pair[] = { bones[k], bones[(k + 1) % 4] };
+            const float w[] = { 1.0f - lane_weights[k], lane_weights[k] };
+            const auto expected = math::transform_point(
+                fvec3(dv) + fvec3(float(k)), math::blend(pair, w, 2));
+            const fvec3 actual(
+                skinned[0].data()[k],
+                skinned[1].data()[k],
+                skinned[2].data()[k]);
+            test_assert(nearly_equal(actual, expected));
+        }
+    }
+
+    TEST_CASE(equality_operator)
+    {
+        const ddual_quat a(dq1, dt1);
+        const ddual_quat b(dq2, dt2);
+        test_assert(a == a);
+        test_assert(!(a == b));
+        test_assert(a != b);
+        test_assert(!(a != a));
+    }
+}
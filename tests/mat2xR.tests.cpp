@@ -883,6 +883,43 @@ namespace
         test_assert(c[1] == math::cos(dm22[1]));
     }
 
+    TEST_CASE(tan)
+    {
+        const auto m = math::tan(dm22);
+        test_assert(m[0] == math::tan(dm22[0]));
+        test_assert(m[1] == math::tan(dm22[1]));
+    }
+
+    TEST_CASE(asin)
+    {
+        const auto x = dm22 * 0.2;
+        const auto m = math::asin(x);
+        test_assert(m[0] == math::asin(x[0]));
+        test_assert(m[1] == math::asin(x[1]));
+    }
+
+    TEST_CASE(acos)
+    {
+        const auto x = dm22 * 0.2;
+        const auto m = math::acos(x);
+        test_assert(m[0] == math::acos(x[0]));
+        test_assert(m[1] == math::acos(x[1]));
+    }
+
+    TEST_CASE(atan)
+    {
+        const auto m = math::atan(dm22);
+        test_assert(m[0] == math::atan(dm22[0]));
+        test_assert(m[1] == math::atan(dm22[1]));
+    }
+
+    TEST_CASE(atan2)
+    {
+        const auto m = math::atan2(dm22, dm222);
+        test_assert(m[0] == math::atan2(dm22[0], dm222[0]));
+        test_assert(m[1] == math::atan2(dm22[1], dm222[1]));
+    }
+
     TEST_CASE(exp)
     {
         const auto m = math::exp(dm22);
@@ -897,6 +934,20 @@ namespace
         test_assert(m[1] == math::log(dm22[1]));
     }
 
+    TEST_CASE(exp2)
+    {
+        const auto m = math::exp2(dm22);
+        test_assert(m[0] == math::exp2(dm22[0]));
+        test_assert(m[1] == math::exp2(dm22[1]));
+    }
+
+    TEST_CASE(log2)
+    {
+        const auto m = math::log2(dm22);
+        test_assert(m[0] == math::log2(dm22[0]));
+        test_assert(m[1] == math::log2(dm22[1]));
+    }
+
     TEST_CASE(abs)
     {
         const auto m = math::abs(dm222);
@@ -1002,6 +1002,48 @@ namespace
         test_assert(c[2] == math::cos(dm32[2]));
     }
 
+    TEST_CASE(tan)
+    {
+        const auto m = math::tan(dm32);
+        test_assert(m[0] == math::tan(dm32[0]));
+        test_assert(m[1] == math::tan(dm32[1]));
+        test_assert(m[2] == math::tan(dm32[2]));
+    }
+
+    TEST_CASE(asin)
+    {
+        const auto x = dm32 * 0.2;
+        const auto m = math::asin(x);
+        test_assert(m[0] == math::asin(x[0]));
+        test_assert(m[1] == math::asin(x[1]));
+        test_assert(m[2] == math::asin(x[2]));
+    }
+
+    TEST_CASE(acos)
+    {
+        const auto x = dm32 * 0.2;
+        const auto m = math::acos(x);
+        test_assert(m[0] == math::acos(x[0]));
+        test_assert(m[1] == math::acos(x[1]));
+        test_assert(m[2] == math::acos(x[2]));
+    }
+
+    TEST_CASE(atan)
+    {
+        const auto m = math::atan(dm32);
+        test_assert(m[0] == math::atan(dm32[0]));
+        test_assert(m[1] == math::atan(dm32[1]));
+        test_assert(m[2] == math::atan(dm32[2]));
+    }
+
+    TEST_CASE(atan2)
+    {
+        const auto m = math::atan2(dm32, dm322);
+        test_assert(m[0] == math::atan2(dm32[0], dm322[0]));
+        test_assert(m[1] == math::atan2(dm32[1], dm322[1]));
+        test_assert(m[2] == math::atan2(dm32[2], dm322[2]));
+    }
+
     TEST_CASE(exp)
     {
         const auto m = math::exp(dm32);
@@ -1018,6 +1060,22 @@ namespace
         test_assert(m[2] == math::log(dm32[2]));
     }
 
+    TEST_CASE(exp2)
+    {
+        const auto m = math::exp2(dm32);
+        test_assert(m[0] == math::exp2(dm32[0]));
+        test_assert(m[1] == math::exp2(dm32[1]));
+        test_assert(m[2] == math::exp2(dm32[2]));
+    }
+
+    TEST_CASE(log2)
+    {
+        const auto m = math::log2(dm32);
+        test_assert(m[0] == math::log2(dm32[0]));
+        test_assert(m[1] == math::log2(dm32[1]));
+        test_assert(m[2] == math::log2(dm32[2]));
+    }
+
     TEST_CASE(abs)
     {
         const auto m = math::abs(dm322);
@@ -1137,6 +1137,53 @@ namespace
         test_assert(c[3] == math::cos(dm42[3]));
     }
 
+    TEST_CASE(tan)
+    {
+        const auto m = math::tan(dm42);
+        test_assert(m[0] == math::tan(dm42[0]));
+        test_assert(m[1] == math::tan(dm42[1]));
+        test_assert(m[2] == math::tan(dm42[2]));
+        test_assert(m[3] == math::tan(dm42[3]));
+    }
+
+    TEST_CASE(asin)
+    {
+        const auto x = dm42 * 0.2;
+        const auto m = math::asin(x);
+        test_assert(m[0] == math::asin(x[0]));
+        test_assert(m[1] == math::asin(x[1]));
+        test_assert(m[2] == math::asin(x[2]));
+        test_assert(m[3] == math::asin(x[3]));
+    }
+
+    TEST_CASE(acos)
+    {
+        const auto x = dm42 * 0.2;
+        const auto m = math::acos(x);
+        test_assert(m[0] == math::acos(x[0]));
+        test_assert(m[1] == math::acos(x[1]));
+        test_assert(m[2] == math::acos(x[2]));
+        test_assert(m[3] == math::acos(x[3]));
+    }
+
+    TEST_CASE(atan)
+    {
+        const auto m = math::atan(dm42);
+        test_assert(m[0] == math::atan(dm42[0]));
+        test_assert(m[1] == math::atan(dm42[1]));
+        test_assert(m[2] == math::atan(dm42[2]));
+        test_assert(m[3] == math::atan(dm42[3]));
+    }
+
+    TEST_CASE(atan2)
+    {
+        const auto m = math::atan2(dm42, dm422);
+        test_assert(m[0] == math::atan2(dm42[0], dm422[0]));
+        test_assert(m[1] == math::atan2(dm42[1], dm422[1]));
+        test_assert(m[2] == math::atan2(dm42[2], dm422[2]));
+        test_assert(m[3] == math::atan2(dm42[3], dm422[3]));
+    }
+
     TEST_CASE(exp)
     {
         const auto m = math::exp(dm42);
@@ -1155,6 +1202,24 @@ namespace
         test_assert(m[3] == math::log(dm42[3]));
     }
 
+    TEST_CASE(exp2)
+    {
+        const auto m = math::exp2(dm42);
+        test_assert(m[0] == math::exp2(dm42[0]));
+        test_assert(m[1] == math::exp2(dm42[1]));
+        test_assert(m[2] == math::exp2(dm42[2]));
+        test_assert(m[3] == math::exp2(dm42[3]));
+    }
+
+    TEST_CASE(log2)
+    {
+        const auto m = math::log2(dm42);
+        test_assert(m[0] == math::log2(dm42[0]));
+        test_assert(m[1] == math::log2(dm42[1]));
+        test_assert(m[2] == math::log2(dm42[2]));
+        test_assert(m[3] == math::log2(dm42[3]));
+    }
+
     TEST_CASE(abs)
     {
         const auto m = math::abs(dm422);
@@ -0,0 +1,127 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/mat.hpp>
+#include "tue.tests.hpp"
+
+#include <tue/simd.hpp>
+#include <tue/transform.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    const dmat4x4 dm44 = {
+        { 2.0, 0.5, -1.0, 0.25 },
+        { 1.0, 3.0, 0.5, -2.0 },
+        { -0.5, 1.5, 4.0, 1.0 },
+        { 0.75, -1.0, 2.0, 5.0 },
+    };
+
+    const dmat3x3 dm33(dm44);
+    const dmat2x2 dm22(dm44);
+
+    TEST_CASE(determinant)
+    {
+        test_assert(nearly_equal(math::determinant(dm22), 5.5));
+        test_assert(nearly_equal(math::determinant(dm33), 17.375));
+        test_assert(nearly_equal(math::determinant(
+            transform::rotation_mat(0.3, -0.4, 0.5)), 1.0));
+        test_assert(nearly_equal(math::determinant(
+            transform::scale_mat(2.0, 3.0, 4.0)), 24.0));
+        test_assert(nearly_equal(
+            math::determinant(fmat4x4(dm44)),
+            float(math::determinant(dm44))));
+    }
+
+    TEST_CASE(inverse)
+    {
+        test_assert(nearly_equal(
+            dm22 * math::inverse(dm22), dmat2x2::identity(), 1e-12));
+        test_assert(nearly_equal(
+            math::inverse(dm22) * dm22, dmat2x2::identity(), 1e-12));
+        test_assert(nearly_equal(
+            dm33 * math::inverse(dm33), dmat3x3::identity(), 1e-12));
+        test_assert(nearly_equal(
+            math::inverse(dm33) * dm33, dmat3x3::identity(), 1e-12));
+        test_assert(nearly_equal(
+            dm44 * math::inverse(dm44), dmat4x4::identity(), 1e-12));
+        test_assert(nearly_equal(
+            math::inverse(dm44) * dm44, dmat4x4::identity(), 1e-12));
+    }
+
+    TEST_CASE(inverse_float4x4)
+    {
+        const fmat4x4 fm44(dm44);
+        test_assert(nearly_equal(
+            math::inverse(fm44), fmat4x4(math::inverse(dm44)), 1e-5f));
+        test_assert(nearly_equal(
+            fm44 * math::inverse(fm44), fmat4x4::identity(), 1e-5f));
+    }
+
+    TEST_CASE(inverse_simd)
+    {
+        fmat4x4 lanes[4];
+        mat<float32x4, 4, 4> m;
+        for (int k = 0; k < 4; ++k)
+        {
+            lanes[k] = fmat4x4(dm44) + fmat4x4(static_cast<float>(k));
+            for (int i = 0; i < 4; ++i)
+            {
+                for (int j = 0; j < 4; ++j)
+                {
+                    m[i][j].data()[k] = lanes[k][i][j];
+                }
+            }
+        }
+
+        const auto det = math::determinant(m);
+        const auto inv = math::inverse(m);
+        for (int k = 0; k < 4; ++k)
+        {
+            test_assert(nearly_equal(
+                det.data()[k], math::determinant(lanes[k])));
+
+            fmat4x4 lane;
+            for (int i = 0; i < 4; ++i)
+            {
+                for (int j = 0; j < 4; ++j)
+                {
+                    lane[i][j] = inv[i][j].data()[k];
+                }
+            }
+            test_assert(nearly_equal(lane, math::inverse(lanes[k]), 1e-5f));
+        }
+    }
+
+    TEST_CASE(inverse_affine)
+    {
+        const auto m44 =
+            transform::scale_mat(2.0, 0.5, 4.0)
+            * transform::rotation_mat(0.3, -0.4, 0.5)
+            * transform::translation_mat(1.5, -2.0, 3.0);
+        test_assert(nearly_equal(
+            math::inverse_affine(m44), math::inverse(m44), 1e-12));
+
+        const dmat3x4 m34(m44);
+        test_assert(nearly_equal(
+            math::inverse_affine(m34), dmat3x4(math::inverse(m44)), 1e-12));
+
+        const auto m33 =
+            transform::scale_mat<double, 3, 3>(2.0, 0.5)
+            * transform::rotation_mat<double, 3, 3>(0.7)
+            * transform::translation_mat<double, 3, 3>(1.5, -2.0);
+        test_assert(nearly_equal(
+            math::inverse_affine(m33), math::inverse(m33), 1e-12));
+
+        const dmat2x3 m23(m33);
+        test_assert(nearly_equal(
+            math::inverse_affine(m23), dmat2x3(math::inverse(m33)), 1e-12));
+    }
+}
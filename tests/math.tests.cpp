@@ -33,6 +33,50 @@ namespace
         test_assert(nearly_equal(c, std::cos(1.2)));
     }
 
+    TEST_CASE(sin_accurate)
+    {
+        test_assert(math::sin_accurate(1.2e9) == std::sin(1.2e9));
+    }
+
+    TEST_CASE(cos_accurate)
+    {
+        test_assert(math::cos_accurate(1.2e9) == std::cos(1.2e9));
+    }
+
+    TEST_CASE(sincos_accurate)
+    {
+        double s, c;
+        math::sincos_accurate(1.2e9, s, c);
+        test_assert(s == std::sin(1.2e9));
+        test_assert(c == std::cos(1.2e9));
+    }
+
+    TEST_CASE(tan)
+    {
+        test_assert(nearly_equal(math::tan(1.2), std::tan(1.2)));
+    }
+
+    TEST_CASE(asin)
+    {
+        test_assert(nearly_equal(math::asin(0.12), std::asin(0.12)));
+    }
+
+    TEST_CASE(acos)
+    {
+        test_assert(nearly_equal(math::acos(0.12), std::acos(0.12)));
+    }
+
+    TEST_CASE(atan)
+    {
+        test_assert(nearly_equal(math::atan(1.2), std::atan(1.2)));
+    }
+
+    TEST_CASE(atan2)
+    {
+        test_assert(nearly_equal(
+            math::atan2(1.2, -3.4), std::atan2(1.2, -3.4)));
+    }
+
     TEST_CASE(exp)
     {
         test_assert(nearly_equal(math::exp(1.2), std::exp(1.2)));
@@ -43,6 +87,16 @@ namespace
         test_assert(nearly_equal(math::log(1.2), std::log(1.2)));
     }
 
+    TEST_CASE(exp2)
+    {
+        test_assert(nearly_equal(math::exp2(1.2), std::exp2(1.2)));
+    }
+
+    TEST_CASE(log2)
+    {
+        test_assert(nearly_equal(math::log2(1.2), std::log2(1.2)));
+    }
+
     TEST_CASE(abs)
     {
         test_assert(math::abs(1.2) == 1.2);
@@ -57,6 +111,21 @@ namespace
         test_assert(nearly_equal(math::pow(1.2, 3.4), std::pow(1.2, 3.4)));
     }
 
+    TEST_CASE(pow_int)
+    {
+        test_assert(math::pow<0>(1.2) == 1.0);
+        test_assert(math::pow<1>(1.2) == 1.2);
+        test_assert(math::pow<2>(-1.5) == 2.25);
+        test_assert(math::pow<3>(-1.5) == -3.375);
+        test_assert(math::pow<-2>(2.0) == 0.25);
+        test_assert(nearly_equal(math::pow<7>(1.2), std::pow(1.2, 7)));
+        test_assert(math::pow(-1.5, 3) == -3.375);
+        test_assert(math::pow(2.0f, -3) == 0.125f);
+        test_assert(math::pow(2.0, 10u) == 1024.0);
+        test_assert(math::pow(1.2, 0) == 1.0);
+        test_assert(nearly_equal(math::pow(1.2, 13), std::pow(1.2, 13)));
+    }
+
     TEST_CASE(recip)
     {
         test_assert(nearly_equal(math::recip(1.2), 1 / 1.2));
@@ -819,4 +819,84 @@ namespace
         test_assert(nearly_equal(
             m[3][3], math::dot(fm44.row(3), dm44.column(3))));
     }
+
+    template<typename T, int N, int R, int C>
+    bool is_product(
+        const mat<T, C, R>& m,
+        const mat<T, N, R>& lhs,
+        const mat<T, C, N>& rhs) noexcept
+    {
+        for (int i = 0; i < C; ++i)
+        {
+            for (int j = 0; j < R; ++j)
+            {
+                if (!nearly_equal(
+                    m[i][j], math::dot(lhs.row(j), rhs.column(i))))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Same-type products may take a SIMD path at run time, so these check
+    // both a run time product and one from a constant expression.
+    template<typename T>
+    void test_same_type_products(
+        const mat<T, 4, 4>& m44, const vec4<T>& v4)
+    {
+        const mat<T, 3, 4> m34(m44);
+        const mat<T, 4, 3> m43(m44);
+
+        test_assert(is_product(m44 * m44, m44, m44));
+        test_assert(is_product(m44 * m34, m44, m34));
+        test_assert(is_product(m34 * m43, m34, m43));
+
+        const auto mv = m44 * v4;
+        const auto vm = v4 * m44;
+        for (int i = 0; i < 4; ++i)
+        {
+            test_assert(nearly_equal(mv[i], math::dot(m44.row(i), v4)));
+            test_assert(nearly_equal(vm[i], math::dot(v4, m44.column(i))));
+        }
+    }
+
+    TEST_CASE(float_same_type_products)
+    {
+        test_same_type_products(fm44, fv4);
+
+        CONST_OR_CONSTEXPR auto m1 = fm44 * fm44;
+        CONST_OR_CONSTEXPR auto m2 = fm44 * fm34;
+        CONST_OR_CONSTEXPR auto m3 = fm34 * fm43;
+        CONST_OR_CONSTEXPR auto v1 = fm44 * fv4;
+        CONST_OR_CONSTEXPR auto v2 = fv4 * fm44;
+        test_assert(is_product(m1, fm44, fm44));
+        test_assert(is_product(m2, fm44, fm34));
+        test_assert(is_product(m3, fm34, fm43));
+        for (int i = 0; i < 4; ++i)
+        {
+            test_assert(nearly_equal(v1[i], math::dot(fm44.row(i), fv4)));
+            test_assert(nearly_equal(v2[i], math::dot(fv4, fm44[i])));
+        }
+    }
+
+    TEST_CASE(double_same_type_products)
+    {
+        test_same_type_products(dm44, dv4);
+
+        CONST_OR_CONSTEXPR auto m1 = dm44 * dm44;
+        CONST_OR_CONSTEXPR auto m2 = dm44 * dm34;
+        CONST_OR_CONSTEXPR auto m3 = dm34 * dm43;
+        CONST_OR_CONSTEXPR auto v1 = dm44 * dv4;
+        CONST_OR_CONSTEXPR auto v2 = dv4 * dm44;
+        test_assert(is_product(m1, dm44, dm44));
+        test_assert(is_product(m2, dm44, dm34));
+        test_assert(is_product(m3, dm34, dm43));
+        for (int i = 0; i < 4; ++i)
+        {
+            test_assert(nearly_equal(v1[i], math::dot(dm44.row(i), dv4)));
+            test_assert(nearly_equal(v2[i], math::dot(dv4, dm44[i])));
+        }
+    }
 }
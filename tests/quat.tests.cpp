@@ -357,4 +357,16 @@ namespace
         CONST_OR_CONSTEXPR auto q = math::conjugate(dquat(1.2, 3.4, 5.6, 7.8));
         test_assert(q == dquat(-1.2, -3.4, -5.6, 7.8));
     }
+
+    TEST_CASE(rotate)
+    {
+        CONST_OR_CONSTEXPR dvec3 v1(1.2, 3.4, 5.6);
+        CONST_OR_CONSTEXPR fquat q(0.3f, -0.1f, 0.5f, 0.806226f);
+        CONST_OR_CONSTEXPR auto v2 = math::rotate(v1, q);
+        test_assert((std::is_same<decltype(v2), const dvec3>::value));
+        const auto expected = v1 * q;
+        test_assert(nearly_equal(v2[0], expected[0]));
+        test_assert(nearly_equal(v2[1], expected[1]));
+        test_assert(nearly_equal(v2[2], expected[2]));
+    }
 }
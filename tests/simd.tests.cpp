@@ -9,10 +9,14 @@
 #include <tue/simd.hpp>
 #include "tue.tests.hpp"
 
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <type_traits>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include <tue/math.hpp>
 #include <tue/sized_bool.hpp>
 #include <tue/unused.hpp>
@@ -122,6 +126,18 @@ namespace
             is_integral_simd_component<simd<float, 4>>::value == false));
     }
 
+    TEST_CASE(prefetch)
+    {
+        const float data[16] = {};
+        prefetch(data);
+        prefetch<prefetch_hint::t0>(data);
+        prefetch<prefetch_hint::t1>(data + 4);
+        prefetch<prefetch_hint::t2>(data + 8);
+        prefetch<prefetch_hint::nta>(data + 12);
+        stream_fence();
+        test_assert(data[0] == 0.0f);
+    }
+
     /*
      * Common SIMD Tests
      */
@@ -494,6 +510,66 @@ namespace
             }
         }
 
+        static void TEST_CASE_store_stream()
+        {
+            const auto s = test_simd();
+            alignas(simd<T, N>) T data[N];
+            s.store_stream(data);
+            stream_fence();
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(data[i] == s.data()[i]);
+            }
+        }
+
+        static simd<sized_bool_t<sizeof(T)>, N> alternating_conditions()
+            noexcept
+        {
+            simd<sized_bool_t<sizeof(T)>, N> c;
+            for (int i = 0; i < N; ++i)
+            {
+                c.data()[i] = static_cast<sized_bool_t<sizeof(T)>>(
+                    i%2==0 ? 0LL : ~0LL);
+            }
+            return c;
+        }
+
+        static void TEST_CASE_load_partial()
+        {
+            T data[N + 1];
+            for (int i = 0; i < N; ++i)
+            {
+                data[i + 1] = static_cast<T>(i + 1);
+            }
+
+            for (int count = -1; count <= N + 1; ++count)
+            {
+                const auto s = simd<T, N>::load_partial(data + 1, count);
+                for (int i = 0; i < N; ++i)
+                {
+                    test_assert(s.data()[i] ==
+                        (i < count ? data[i + 1] : static_cast<T>(0)));
+                }
+            }
+        }
+
+        static void TEST_CASE_maskload()
+        {
+            T data[N + 1];
+            for (int i = 0; i < N; ++i)
+            {
+                data[i + 1] = static_cast<T>(i + 1);
+            }
+
+            const auto conditions = alternating_conditions();
+            const auto s = simd<T, N>::maskload(data + 1, conditions);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s.data()[i] ==
+                    (conditions.data()[i] ? data[i + 1] : static_cast<T>(0)));
+            }
+        }
+
         static void TEST_CASE_data()
         {
             const auto cs = test_simd();
@@ -505,6 +581,36 @@ namespace
             test_assert(data == static_cast<void*>(&s));
         }
 
+        static void TEST_CASE_store_partial()
+        {
+            const auto s = test_simd();
+            for (int count = -1; count <= N + 1; ++count)
+            {
+                T data[N + 1] = {};
+                s.store_partial(data + 1, count);
+                test_assert(data[0] == static_cast<T>(0));
+                for (int i = 0; i < N; ++i)
+                {
+                    test_assert(data[i + 1] ==
+                        (i < count ? s.data()[i] : static_cast<T>(0)));
+                }
+            }
+        }
+
+        static void TEST_CASE_maskstore()
+        {
+            const auto s = test_simd();
+            const auto conditions = alternating_conditions();
+            T data[N + 1] = {};
+            s.maskstore(data + 1, conditions);
+            test_assert(data[0] == static_cast<T>(0));
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(data[i + 1] ==
+                    (conditions.data()[i] ? s.data()[i] : static_cast<T>(0)));
+            }
+        }
+
         static void TEST_CASE_equality_operator()
         {
             const simd<T, N> cs1 = test_simd();
@@ -605,6 +711,83 @@ namespace
             }
         }
 
+        template<int... I>
+        static simd<T, N> reversed(
+            const simd<T, N>& s, std::integer_sequence<int, I...>) noexcept
+        {
+            return shuffle<(N - 1 - I)...>(s);
+        }
+
+        template<int... I>
+        static simd<T, N> pairs_swapped(
+            const simd<T, N>& s, std::integer_sequence<int, I...>) noexcept
+        {
+            return shuffle<(I ^ 1)...>(s);
+        }
+
+        static void TEST_CASE_shuffle()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = reversed(s1, std::make_integer_sequence<int, N>());
+            const auto s3 = pairs_swapped(
+                s1, std::make_integer_sequence<int, N>());
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == s1.data()[N - 1 - i]);
+                test_assert(s3.data()[i] == s1.data()[i ^ 1]);
+            }
+        }
+
+        static void TEST_CASE_unpack_lo()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = test_simd2();
+            const auto s3 = unpack_lo(s1, s2);
+            for (int i = 0; i < N/2; ++i)
+            {
+                test_assert(s3.data()[i*2] == s1.data()[i]);
+                test_assert(s3.data()[i*2 + 1] == s2.data()[i]);
+            }
+        }
+
+        static void TEST_CASE_unpack_hi()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = test_simd2();
+            const auto s3 = unpack_hi(s1, s2);
+            for (int i = 0; i < N/2; ++i)
+            {
+                test_assert(s3.data()[i*2] == s1.data()[N/2 + i]);
+                test_assert(s3.data()[i*2 + 1] == s2.data()[N/2 + i]);
+            }
+        }
+
+        static void TEST_CASE_broadcast()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = broadcast<0>(s1);
+            const auto s3 = broadcast<N - 1>(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == s1.data()[0]);
+                test_assert(s3.data()[i] == s1.data()[N - 1]);
+            }
+        }
+
+        static void TEST_CASE_rotate()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = rotate<1>(s1);
+            const auto s3 = rotate<-1>(s1);
+            const auto s4 = rotate<N + 2>(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == s1.data()[(i + 1) % N]);
+                test_assert(s3.data()[i] == s1.data()[(i + N - 1) % N]);
+                test_assert(s4.data()[i] == s1.data()[(i + 2) % N]);
+            }
+        }
+
         static void run_all()
         {
             TEST_CASE_alias();
@@ -624,6 +807,11 @@ namespace
             TEST_CASE_loadu();
             TEST_CASE_store();
             TEST_CASE_storeu();
+            TEST_CASE_store_stream();
+            TEST_CASE_load_partial();
+            TEST_CASE_maskload();
+            TEST_CASE_store_partial();
+            TEST_CASE_maskstore();
             TEST_CASE_data();
             TEST_CASE_equality_operator();
             TEST_CASE_inequality_operator();
@@ -631,6 +819,11 @@ namespace
             TEST_CASE_select();
             TEST_CASE_equal();
             TEST_CASE_not_equal();
+            TEST_CASE_shuffle();
+            TEST_CASE_unpack_lo();
+            TEST_CASE_unpack_hi();
+            TEST_CASE_broadcast();
+            TEST_CASE_rotate();
         }
     };
 
@@ -878,6 +1071,146 @@ namespace
             }
         }
 
+        static void TEST_CASE_hsum()
+        {
+            const auto s = test_simd();
+            T expected = 0;
+            for (int i = 0; i < N; ++i)
+            {
+                expected = T(expected + s.data()[i]);
+            }
+            test_assert(math::hsum(s) == expected);
+        }
+
+        static void TEST_CASE_hprod()
+        {
+            // Mostly ones, so the product can't overflow any T.
+            simd<T, N> s;
+            for (int i = 0; i < N; ++i)
+            {
+                s.data()[i] = static_cast<T>(
+                    (i == 0 ? 3 : i == N - 1 ? 2 : 1)
+                    * (std::is_signed<T>::value && i % 3 == 1 ? -1 : 1));
+            }
+            T expected = 1;
+            for (int i = 0; i < N; ++i)
+            {
+                expected = T(expected * s.data()[i]);
+            }
+            test_assert(math::hprod(s) == expected);
+        }
+
+        static void TEST_CASE_hmin()
+        {
+            const auto s = test_simd();
+            T expected = s.data()[0];
+            for (int i = 1; i < N; ++i)
+            {
+                expected = math::min(expected, s.data()[i]);
+            }
+            test_assert(math::hmin(s) == expected);
+        }
+
+        static void TEST_CASE_hmax()
+        {
+            const auto s = test_simd();
+            T expected = s.data()[0];
+            for (int i = 1; i < N; ++i)
+            {
+                expected = math::max(expected, s.data()[i]);
+            }
+            test_assert(math::hmax(s) == expected);
+        }
+
+        static void TEST_CASE_dot()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = test_simd2();
+            T expected = 0;
+            for (int i = 0; i < N; ++i)
+            {
+                expected = T(expected + T(s1.data()[i] * s2.data()[i]));
+            }
+            test_assert(math::dot(s1, s2) == expected);
+        }
+
+        static const simd<std::int32_t, N>& test_indices() noexcept
+        {
+            static bool initialized = false;
+            static simd<std::int32_t, N> s;
+            if (!initialized)
+            {
+                for (int i = 0; i < N; ++i)
+                {
+                    s.data()[i] = 2 * (N - 1 - i) + 1;
+                }
+                initialized = true;
+            }
+            return s;
+        }
+
+        static const simd<sized_bool_t<sizeof(T)>, N>& test_conditions()
+            noexcept
+        {
+            static bool initialized = false;
+            static simd<sized_bool_t<sizeof(T)>, N> s;
+            if (!initialized)
+            {
+                for (int i = 0; i < N; ++i)
+                {
+                    s.data()[i] = static_cast<sized_bool_t<sizeof(T)>>(
+                        i%2==0 ? 0LL : ~0LL);
+                }
+                initialized = true;
+            }
+            return s;
+        }
+
+        static void TEST_CASE_gather()
+        {
+            T table[2 * N];
+            for (int i = 0; i < 2 * N; ++i)
+            {
+                table[i] = static_cast<T>(i);
+            }
+
+            const auto& indices = test_indices();
+            const auto& conditions = test_conditions();
+            const auto s1 = simd<T, N>::gather(table, indices);
+            const auto s2 = simd<T, N>::gather(table, indices, conditions);
+            for (int i = 0; i < N; ++i)
+            {
+                const auto expected = table[indices.data()[i]];
+                test_assert(s1.data()[i] == expected);
+                test_assert(s2.data()[i] ==
+                    (conditions.data()[i] ? expected : static_cast<T>(0)));
+            }
+        }
+
+        static void TEST_CASE_scatter()
+        {
+            const auto s = test_simd();
+            const auto& indices = test_indices();
+            const auto& conditions = test_conditions();
+
+            T table1[2 * N] = {};
+            T table2[2 * N] = {};
+            s.scatter(table1, indices);
+            s.scatter(table2, indices, conditions);
+            for (int i = 0; i < N; ++i)
+            {
+                const auto j = indices.data()[i];
+                test_assert(table1[j] == s.data()[i]);
+                test_assert(table1[j - 1] == static_cast<T>(0));
+                test_assert(table2[j] ==
+                    (conditions.data()[i] ? s.data()[i] : static_cast<T>(0)));
+            }
+
+            T table3[1] = {};
+            s.scatter(table3, simd<std::int32_t, N>(0));
+            test_assert(table3[0] == s.data()[N - 1]);
+        }
+
         static void TEST_CASE_less()
         {
             const auto s1 = test_simd();
@@ -950,6 +1283,13 @@ namespace
             TEST_CASE_abs();
             TEST_CASE_min();
             TEST_CASE_max();
+            TEST_CASE_hsum();
+            TEST_CASE_hprod();
+            TEST_CASE_hmin();
+            TEST_CASE_hmax();
+            TEST_CASE_dot();
+            TEST_CASE_gather();
+            TEST_CASE_scatter();
             TEST_CASE_less();
             TEST_CASE_less_equal();
             TEST_CASE_greater();
@@ -1003,6 +1343,171 @@ namespace
             }
         }
 
+        static const simd<T, N>& test_simd_large() noexcept
+        {
+            static bool initialized = false;
+            static simd<T, N> s;
+            if (!initialized)
+            {
+                for (int i = 0; i < N; ++i)
+                {
+                    const auto sign = i % 2 == 0 ? 1.0 : -1.0;
+                    s.data()[i] = static_cast<T>(
+                        sign * (i+1.25) * std::pow(10.0, 2 * (i % 8)));
+                }
+                initialized = true;
+            }
+            return s;
+        }
+
+        static bool accurately_equal(T actual, T expected) noexcept
+        {
+            return std::abs(actual - expected)
+                <= 4 * std::numeric_limits<T>::epsilon();
+        }
+
+        static void TEST_CASE_sin_accurate()
+        {
+            const auto s1 = test_simd_large();
+            const auto s2 = math::sin_accurate(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(accurately_equal(
+                    s2.data()[i], math::sin_accurate(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_cos_accurate()
+        {
+            const auto s1 = test_simd_large();
+            const auto s2 = math::cos_accurate(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(accurately_equal(
+                    s2.data()[i], math::cos_accurate(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_sincos_accurate()
+        {
+            const auto s = test_simd_large();
+            simd<T, N> sin_out, cos_out;
+            math::sincos_accurate(s, sin_out, cos_out);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(accurately_equal(
+                    sin_out.data()[i], math::sin_accurate(s.data()[i])));
+                test_assert(accurately_equal(
+                    cos_out.data()[i], math::cos_accurate(s.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_tan()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = math::tan(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::tan(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_tan_accuracy()
+        {
+            // Sweep [-1.5, 1.5], which includes the large errors near
+            // +-pi/4 of a float-precision kernel.
+            const int count = 3000;
+            for (int j = 0; j < count; j += N)
+            {
+                simd<T, N> s1;
+                for (int i = 0; i < N; ++i)
+                {
+                    s1.data()[i] = static_cast<T>(
+                        -1.5 + 3.0 * (j + i) / (count - 1));
+                }
+                const auto s2 = math::tan(s1);
+                for (int i = 0; i < N; ++i)
+                {
+                    const T expected = math::tan(s1.data()[i]);
+                    test_assert(std::abs(s2.data()[i] - expected)
+                        <= 4 * std::numeric_limits<T>::epsilon()
+                            * std::abs(expected));
+                }
+            }
+        }
+
+        static void TEST_CASE_asin()
+        {
+            const auto s1 = test_simd() / simd<T, N>(T(N + 1));
+            const auto s2 = math::asin(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::asin(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_acos()
+        {
+            const auto s1 = test_simd() / simd<T, N>(T(N + 1));
+            const auto s2 = math::acos(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::acos(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_atan()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = math::atan(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::atan(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_atan2()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = test_simd2();
+            const auto s3 = math::atan2(s1, s2);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s3.data()[i], math::atan2(s1.data()[i], s2.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_atan2_special()
+        {
+            // Both operands infinite, and every signed zero quadrant
+            const T inf = std::numeric_limits<T>::infinity();
+            const T ys[] = { inf, inf, -inf, -inf, T(0), T(0), -T(0), -T(0) };
+            const T xs[] = { inf, -inf, inf, -inf, T(0), -T(0), T(0), -T(0) };
+            for (int offset = 0; offset < 8; ++offset)
+            {
+                simd<T, N> s1, s2;
+                for (int i = 0; i < N; ++i)
+                {
+                    s1.data()[i] = ys[(i + offset) % 8];
+                    s2.data()[i] = xs[(i + offset) % 8];
+                }
+                const auto s3 = math::atan2(s1, s2);
+                for (int i = 0; i < N; ++i)
+                {
+                    const T expected = math::atan2(
+                        s1.data()[i], s2.data()[i]);
+                    test_assert(nearly_equal(s3.data()[i], expected));
+                    test_assert(
+                        std::signbit(s3.data()[i]) == std::signbit(expected));
+                }
+            }
+        }
+
         static void TEST_CASE_exp()
         {
             const auto s1 = test_simd();
@@ -1025,6 +1530,28 @@ namespace
             }
         }
 
+        static void TEST_CASE_exp2()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = math::exp2(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::exp2(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_log2()
+        {
+            const auto s1 = test_simd_abs();
+            const auto s2 = math::log2(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::log2(s1.data()[i])));
+            }
+        }
+
         static void TEST_CASE_pow()
         {
             const auto s1 = test_simd_abs();
@@ -1037,6 +1564,27 @@ namespace
             }
         }
 
+        static void TEST_CASE_pow_int()
+        {
+            const auto s1 = -test_simd();
+            const auto s2 = math::pow<5>(s1);
+            const auto s3 = math::pow<-2>(s1);
+            const auto s4 = math::pow<0>(s1);
+            const auto s5 = math::pow(s1, 7);
+            const auto s6 = math::pow(s1, -3);
+            for (int i = 0; i < N; ++i)
+            {
+                const auto x = s1.data()[i];
+                test_assert(nearly_equal(s2.data()[i], math::pow(x, T(5))));
+                test_assert(nearly_equal(s3.data()[i], math::pow(x, T(-2))));
+                test_assert(s4.data()[i] == T(1));
+                test_assert(nearly_equal(s5.data()[i], math::pow(x, T(7))));
+                test_assert(nearly_equal(s6.data()[i], math::pow(x, T(-3))));
+                test_assert(s2.data()[i] == math::pow<5>(x));
+                test_assert(s5.data()[i] == math::pow(x, 7));
+            }
+        }
+
         static void TEST_CASE_recip()
         {
             const auto s1 = test_simd();
@@ -1048,6 +1596,58 @@ namespace
             }
         }
 
+        static void TEST_CASE_recip_fast()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = math::recip_fast(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal_within(
+                    s2.data()[i], math::recip(s1.data()[i]), T(0.001)));
+            }
+        }
+
+        static void TEST_CASE_recip_refined()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = math::recip(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal_within(
+                    s2.data()[i], math::recip(s1.data()[i]), T(0.000001)));
+            }
+
+            // The refinement step must not turn 0 or inf into NAN.
+            const T inf = std::numeric_limits<T>::infinity();
+            const T specials[] = { T(0), -T(0), inf, -inf };
+            for (int offset = 0; offset < 4; ++offset)
+            {
+                simd<T, N> s3;
+                for (int i = 0; i < N; ++i)
+                {
+                    s3.data()[i] = specials[(i + offset) % 4];
+                }
+                const auto s4 = math::recip(s3);
+                for (int i = 0; i < N; ++i)
+                {
+                    const T expected = math::recip(s3.data()[i]);
+                    test_assert(s4.data()[i] == expected);
+                    test_assert(
+                        std::signbit(s4.data()[i]) == std::signbit(expected));
+                }
+            }
+        }
+
+        static void TEST_CASE_recip_exact()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = math::recip_exact(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == math::recip(s1.data()[i]));
+            }
+        }
+
         static void TEST_CASE_sqrt()
         {
             const auto s1 = test_simd_abs();
@@ -1070,18 +1670,89 @@ namespace
             }
         }
 
+        static void TEST_CASE_rsqrt_fast()
+        {
+            const auto s1 = test_simd_abs();
+            const auto s2 = math::rsqrt_fast(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal_within(
+                    s2.data()[i], math::rsqrt(s1.data()[i]), T(0.001)));
+            }
+        }
+
+        static void TEST_CASE_rsqrt_refined()
+        {
+            const auto s1 = test_simd_abs();
+            const auto s2 = math::rsqrt(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal_within(
+                    s2.data()[i], math::rsqrt(s1.data()[i]), T(0.000001)));
+            }
+
+            // The refinement step must not turn 0 or inf into NAN.
+            const T inf = std::numeric_limits<T>::infinity();
+            const T specials[] = { T(0), -T(0), inf };
+            for (int offset = 0; offset < 3; ++offset)
+            {
+                simd<T, N> s3;
+                for (int i = 0; i < N; ++i)
+                {
+                    s3.data()[i] = specials[(i + offset) % 3];
+                }
+                const auto s4 = math::rsqrt(s3);
+                for (int i = 0; i < N; ++i)
+                {
+                    const T expected = math::rsqrt(s3.data()[i]);
+                    test_assert(s4.data()[i] == expected);
+                    test_assert(
+                        std::signbit(s4.data()[i]) == std::signbit(expected));
+                }
+            }
+        }
+
+        static void TEST_CASE_rsqrt_exact()
+        {
+            const auto s1 = test_simd_abs();
+            const auto s2 = math::rsqrt_exact(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == math::rsqrt(s1.data()[i]));
+            }
+        }
+
         static void run_all()
         {
             arithmetic_simd_tests<Alias, T, N>::run_all();
             TEST_CASE_sin();
             TEST_CASE_cos();
             TEST_CASE_sincos();
+            TEST_CASE_sin_accurate();
+            TEST_CASE_cos_accurate();
+            TEST_CASE_sincos_accurate();
+            TEST_CASE_tan();
+            TEST_CASE_tan_accuracy();
+            TEST_CASE_asin();
+            TEST_CASE_acos();
+            TEST_CASE_atan();
+            TEST_CASE_atan2();
+            TEST_CASE_atan2_special();
             TEST_CASE_exp();
             TEST_CASE_log();
+            TEST_CASE_exp2();
+            TEST_CASE_log2();
             TEST_CASE_pow();
+            TEST_CASE_pow_int();
             TEST_CASE_recip();
+            TEST_CASE_recip_fast();
+            TEST_CASE_recip_refined();
+            TEST_CASE_recip_exact();
             TEST_CASE_sqrt();
             TEST_CASE_rsqrt();
+            TEST_CASE_rsqrt_fast();
+            TEST_CASE_rsqrt_refined();
+            TEST_CASE_rsqrt_exact();
         }
     };
 
@@ -1264,6 +1935,96 @@ namespace
         }
     };
 
+    /*
+     * Bool SIMD Tests
+     */
+    template<typename Alias, typename T, int N>
+    struct bool_simd_tests : public common_simd_tests<Alias, T, N>
+    {
+        static simd<T, N> from_mask(std::uint64_t mask) noexcept
+        {
+            simd<T, N> s;
+            for (int i = 0; i < N; ++i)
+            {
+                s.data()[i] = (mask >> i) & 1u ? T(~0LL) : T(0LL);
+            }
+            return s;
+        }
+
+        static std::vector<std::uint64_t> test_masks()
+        {
+            const auto full = ~std::uint64_t(0) >> (64 - N);
+            std::vector<std::uint64_t> masks = {
+                0u,
+                full,
+                UINT64_C(0x5555555555555555) & full,
+                UINT64_C(0xAAAAAAAAAAAAAAAA) & full,
+            };
+            for (int i = 0; i < N; ++i)
+            {
+                masks.push_back(std::uint64_t(1) << i);
+                masks.push_back(full & ~(std::uint64_t(1) << i));
+            }
+            return masks;
+        }
+
+        static void TEST_CASE_movemask()
+        {
+            for (const auto mask : test_masks())
+            {
+                test_assert(math::movemask(from_mask(mask)) == mask);
+            }
+        }
+
+        static void TEST_CASE_any()
+        {
+            for (const auto mask : test_masks())
+            {
+                test_assert(math::any(from_mask(mask)) == (mask != 0));
+            }
+        }
+
+        static void TEST_CASE_all()
+        {
+            const auto full = ~std::uint64_t(0) >> (64 - N);
+            for (const auto mask : test_masks())
+            {
+                test_assert(math::all(from_mask(mask)) == (mask == full));
+            }
+        }
+
+        static void TEST_CASE_none()
+        {
+            for (const auto mask : test_masks())
+            {
+                test_assert(math::none(from_mask(mask)) == (mask == 0));
+            }
+        }
+
+        static void TEST_CASE_count()
+        {
+            for (const auto mask : test_masks())
+            {
+                int expected = 0;
+                for (int i = 0; i < N; ++i)
+                {
+                    expected += (mask >> i) & 1u ? 1 : 0;
+                }
+                test_assert(math::count(from_mask(mask)) == expected);
+            }
+        }
+
+        static void run_all()
+        {
+            common_simd_tests<Alias, T, N>::run_all();
+            TEST_CASE_movemask();
+            TEST_CASE_any();
+            TEST_CASE_all();
+            TEST_CASE_none();
+            TEST_CASE_count();
+        }
+    };
+
 #define FLOAT_SIMD_TEST_CASES(Alias, T, N) \
     TEST_CASE(Alias) \
     { \
@@ -1279,7 +2040,7 @@ namespace
 #define BOOL_SIMD_TEST_CASES(Alias, T, N) \
     TEST_CASE(Alias) \
     { \
-        common_simd_tests<Alias, T, N>::run_all(); \
+        bool_simd_tests<Alias, T, N>::run_all(); \
     }
 
     FLOAT_SIMD_TEST_CASES(float32x2, float, 2)
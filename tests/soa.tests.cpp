@@ -0,0 +1,126 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/soa.hpp>
+#include "tue.tests.hpp"
+
+#include <cstdint>
+
+#include <tue/quat.hpp>
+#include <tue/simd.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    template<typename T, int N, int M>
+    struct soa_tests
+    {
+        // One extra vector on each side catches out-of-bounds writes, and
+        // starting at index 1 keeps the vectors from being over-aligned.
+        static void make_vectors(vec<T, M> (&vectors)[N + 2]) noexcept
+        {
+            for (int i = 0; i < N + 2; ++i)
+            {
+                for (int j = 0; j < M; ++j)
+                {
+                    vectors[i][j] = static_cast<T>(1 + i*M + j);
+                }
+            }
+        }
+
+        static void TEST_CASE_load()
+        {
+            vec<T, M> vectors[N + 2];
+            make_vectors(vectors);
+
+            const auto v = soa::load<N>(vectors + 1);
+            for (int j = 0; j < M; ++j)
+            {
+                for (int i = 0; i < N; ++i)
+                {
+                    test_assert(v[j].data()[i] == vectors[i + 1][j]);
+                }
+            }
+        }
+
+        static void TEST_CASE_store()
+        {
+            vec<T, M> expected[N + 2];
+            make_vectors(expected);
+
+            vec<simd<T, N>, M> v;
+            for (int j = 0; j < M; ++j)
+            {
+                for (int i = 0; i < N; ++i)
+                {
+                    v[j].data()[i] = expected[i + 1][j];
+                }
+            }
+
+            vec<T, M> actual[N + 2];
+            actual[0] = vec<T, M>::zero();
+            actual[N + 1] = vec<T, M>::zero();
+            soa::store(v, actual + 1);
+            test_assert((actual[0] == vec<T, M>::zero()));
+            test_assert((actual[N + 1] == vec<T, M>::zero()));
+            for (int i = 1; i <= N; ++i)
+            {
+                test_assert(actual[i] == expected[i]);
+            }
+        }
+
+        static void run_all()
+        {
+            TEST_CASE_load();
+            TEST_CASE_store();
+        }
+    };
+
+#define SOA_TEST_CASES(Name, T, N) \
+    TEST_CASE(Name) \
+    { \
+        soa_tests<T, N, 2>::run_all(); \
+        soa_tests<T, N, 3>::run_all(); \
+        soa_tests<T, N, 4>::run_all(); \
+    }
+
+    SOA_TEST_CASES(float32x2, float, 2)
+    SOA_TEST_CASES(float32x4, float, 4)
+    SOA_TEST_CASES(float32x8, float, 8)
+    SOA_TEST_CASES(float32x16, float, 16)
+    SOA_TEST_CASES(float64x4, double, 4)
+    SOA_TEST_CASES(int32x8, std::int32_t, 8)
+
+    TEST_CASE(quat)
+    {
+        fquat quats[10];
+        for (int i = 0; i < 10; ++i)
+        {
+            const auto f = static_cast<float>(i);
+            quats[i] = fquat(f, f + 0.25f, f + 0.5f, f + 0.75f);
+        }
+
+        const auto q = soa::load<8>(quats + 1);
+        for (int i = 0; i < 8; ++i)
+        {
+            test_assert(q.x().data()[i] == quats[i + 1].x());
+            test_assert(q.w().data()[i] == quats[i + 1].w());
+        }
+
+        fquat actual[10] = {};
+        soa::store(q, actual + 1);
+        test_assert(actual[0] == fquat(0.0f, 0.0f, 0.0f, 0.0f));
+        test_assert(actual[9] == fquat(0.0f, 0.0f, 0.0f, 0.0f));
+        for (int i = 1; i <= 8; ++i)
+        {
+            test_assert(actual[i] == quats[i]);
+        }
+    }
+}
@@ -0,0 +1,228 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/soa_vector.hpp>
+#include "tue.tests.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <tue/math.hpp>
+#include <tue/simd.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    template<typename V, int N>
+    bool is_aligned(const soa_vector<V, N>& v) noexcept
+    {
+        using block_type = typename soa_vector<V, N>::block_type;
+        for (std::size_t i = 0; i < v.block_count(); ++i)
+        {
+            const auto address =
+                reinterpret_cast<std::uintptr_t>(&v.block(i));
+            if (address % alignof(block_type) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename V, int N>
+    bool padding_is_zero(const soa_vector<V, N>& v) noexcept
+    {
+        for (auto i = v.size(); i < v.block_count() * N; ++i)
+        {
+            const auto& block = v.block(i / N);
+            for (int j = 0; j < V::component_count; ++j)
+            {
+                if (block[j].data()[i % N] != 0)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    fvec3 make_vector(std::size_t i) noexcept
+    {
+        const auto f = static_cast<float>(i);
+        return { f, 2.0f * f, -f };
+    }
+
+    TEST_CASE(default_constructor)
+    {
+        const soa_vector<fvec3> v;
+        test_assert(v.empty());
+        test_assert(v.size() == 0);
+        test_assert(v.block_count() == 0);
+        test_assert(v.block_begin() == v.block_end());
+    }
+
+    TEST_CASE(size_constructor)
+    {
+        const soa_vector<fvec3, 8> v(13);
+        test_assert(v.size() == 13);
+        test_assert(v.block_count() == 2);
+        test_assert(is_aligned(v));
+        for (std::size_t i = 0; i < v.size(); ++i)
+        {
+            test_assert(v[i] == fvec3::zero());
+        }
+        test_assert(padding_is_zero(v));
+    }
+
+    TEST_CASE(initializer_list_constructor)
+    {
+        const soa_vector<fvec2> v = {
+            { 1.0f, 2.0f },
+            { 3.0f, 4.0f },
+            { 5.0f, 6.0f },
+        };
+        test_assert(v.size() == 3);
+        test_assert(v.block_count() == 1);
+        test_assert(v[0] == fvec2(1.0f, 2.0f));
+        test_assert(v[1] == fvec2(3.0f, 4.0f));
+        test_assert(v[2] == fvec2(5.0f, 6.0f));
+        test_assert(padding_is_zero(v));
+    }
+
+    TEST_CASE(reference)
+    {
+        soa_vector<fvec3> v(6);
+        v[1] = fvec3(1.0f, 2.0f, 3.0f);
+        v[5][2] = 4.0f;
+        v[4] = v[1];
+        test_assert(fvec3(v[1]) == fvec3(1.0f, 2.0f, 3.0f));
+        test_assert(fvec3(v[4]) == fvec3(1.0f, 2.0f, 3.0f));
+        test_assert(fvec3(v[5]) == fvec3(0.0f, 0.0f, 4.0f));
+        test_assert(v.block(1)[0].data()[0] == 1.0f);
+        test_assert(v.block(1)[2].data()[1] == 4.0f);
+
+        const fvec3 copy = v[4];
+        test_assert(copy == fvec3(1.0f, 2.0f, 3.0f));
+    }
+
+    TEST_CASE(push_back)
+    {
+        soa_vector<fvec3, 16> v;
+        for (std::size_t i = 0; i < 40; ++i)
+        {
+            v.push_back(make_vector(i));
+            test_assert(v.size() == i + 1);
+            test_assert(v.block_count() == i / 16 + 1);
+            test_assert(padding_is_zero(v));
+        }
+        test_assert(is_aligned(v));
+        for (std::size_t i = 0; i < v.size(); ++i)
+        {
+            test_assert(fvec3(v[i]) == make_vector(i));
+        }
+    }
+
+    TEST_CASE(pop_back)
+    {
+        soa_vector<fvec3> v;
+        for (std::size_t i = 0; i < 9; ++i)
+        {
+            v.push_back(make_vector(i));
+        }
+        for (std::size_t i = 9; i > 0; --i)
+        {
+            v.pop_back();
+            test_assert(v.size() == i - 1);
+            test_assert(v.block_count() == (i + 2) / 4);
+            test_assert(padding_is_zero(v));
+        }
+        test_assert(v.empty());
+    }
+
+    TEST_CASE(resize)
+    {
+        soa_vector<fvec3> v;
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+            v.push_back(make_vector(i));
+        }
+
+        v.resize(5);
+        test_assert(v.size() == 5);
+        test_assert(v.block_count() == 2);
+        test_assert(padding_is_zero(v));
+
+        v.resize(11);
+        test_assert(v.size() == 11);
+        test_assert(v.block_count() == 3);
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            test_assert(fvec3(v[i]) == make_vector(i));
+        }
+        for (std::size_t i = 5; i < 11; ++i)
+        {
+            test_assert(fvec3(v[i]) == fvec3::zero());
+        }
+        test_assert(padding_is_zero(v));
+
+        v.clear();
+        test_assert(v.empty());
+        test_assert(v.block_count() == 0);
+    }
+
+    TEST_CASE(block_iterators)
+    {
+        soa_vector<fvec3> v;
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+            v.push_back(make_vector(i));
+        }
+
+        std::size_t count = 0;
+        for (auto it = v.block_begin(); it != v.block_end(); ++it)
+        {
+            test_assert(&*it == &v.block(count));
+            ++count;
+        }
+        test_assert(count == v.block_count());
+    }
+
+    TEST_CASE(for_each_block)
+    {
+        soa_vector<fvec3, 8> v;
+        for (std::size_t i = 0; i < 21; ++i)
+        {
+            v.push_back(make_vector(i));
+        }
+
+        v.for_each_block([](vec3<float32x8>& block)
+        {
+            block += vec3<float32x8>(float32x8(1.0f));
+        });
+        test_assert(padding_is_zero(v));
+        for (std::size_t i = 0; i < v.size(); ++i)
+        {
+            test_assert(fvec3(v[i]) == make_vector(i) + fvec3(1.0f));
+        }
+
+        const auto& cv = v;
+        float32x8 sum(0.0f);
+        cv.for_each_block([&](const vec3<float32x8>& block)
+        {
+            sum += block[0];
+        });
+        float total = 0.0f;
+        for (int i = 0; i < 8; ++i)
+        {
+            total += sum.data()[i];
+        }
+        test_assert(total == 21.0f + 210.0f);
+    }
+}
@@ -19,6 +19,15 @@
 #define CONST_OR_CONSTEXPR constexpr
 #endif
 
+namespace tue
+{
+    template<typename T, int N>
+    class vec;
+
+    template<typename T, int C, int R>
+    class mat;
+}
+
 namespace
 {
     template<typename T>
@@ -28,4 +37,45 @@ namespace
             || std::abs(actual - expected) < std::abs(expected * 0.0003f)
             || std::abs(expected) == std::numeric_limits<T>::infinity();
     }
+
+    template<typename T>
+    bool nearly_equal_within(T actual, T expected, T tolerance) noexcept
+    {
+        return actual == expected
+            || std::abs(actual - expected) <= std::abs(expected * tolerance);
+    }
+
+    // Unlike the scalar overloads, these compare each component against an
+    // absolute tolerance, so they also work for components expected to be 0.
+    template<typename T, int N>
+    bool nearly_equal(
+        const tue::vec<T, N>& actual,
+        const tue::vec<T, N>& expected,
+        T tolerance = T(1e-4)) noexcept
+    {
+        for (int i = 0; i < N; ++i)
+        {
+            if (std::abs(actual[i] - expected[i]) > tolerance)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename T, int C, int R>
+    bool nearly_equal(
+        const tue::mat<T, C, R>& actual,
+        const tue::mat<T, C, R>& expected,
+        T tolerance = T(1e-4)) noexcept
+    {
+        for (int i = 0; i < C; ++i)
+        {
+            if (!nearly_equal(actual[i], expected[i], tolerance))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
 }
@@ -643,6 +643,42 @@ namespace
         test_assert(nearly_equal(c[1], math::cos(3.4)));
     }
 
+    TEST_CASE(tan)
+    {
+        const auto v = math::tan(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::tan(1.2)));
+        test_assert(nearly_equal(v[1], math::tan(3.4)));
+    }
+
+    TEST_CASE(asin)
+    {
+        const auto v = math::asin(dvec2(0.12, -0.34));
+        test_assert(nearly_equal(v[0], math::asin(0.12)));
+        test_assert(nearly_equal(v[1], math::asin(-0.34)));
+    }
+
+    TEST_CASE(acos)
+    {
+        const auto v = math::acos(dvec2(0.12, -0.34));
+        test_assert(nearly_equal(v[0], math::acos(0.12)));
+        test_assert(nearly_equal(v[1], math::acos(-0.34)));
+    }
+
+    TEST_CASE(atan)
+    {
+        const auto v = math::atan(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::atan(1.2)));
+        test_assert(nearly_equal(v[1], math::atan(3.4)));
+    }
+
+    TEST_CASE(atan2)
+    {
+        const auto v = math::atan2(
+            dvec2(1.2, 3.4), dvec2(-5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::atan2(1.2, -5.6)));
+        test_assert(nearly_equal(v[1], math::atan2(3.4, 7.8)));
+    }
+
     TEST_CASE(exp)
     {
         const auto v = math::exp(dvec2(1.2, 3.4));
@@ -657,6 +693,20 @@ namespace
         test_assert(nearly_equal(v[1], math::log(3.4)));
     }
 
+    TEST_CASE(exp2)
+    {
+        const auto v = math::exp2(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::exp2(1.2)));
+        test_assert(nearly_equal(v[1], math::exp2(3.4)));
+    }
+
+    TEST_CASE(log2)
+    {
+        const auto v = math::log2(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::log2(1.2)));
+        test_assert(nearly_equal(v[1], math::log2(3.4)));
+    }
+
     TEST_CASE(abs)
     {
         const auto v = math::abs(dvec2(1.2, -3.4));
@@ -813,6 +813,47 @@ namespace
         test_assert(nearly_equal(c[2], math::cos(5.6)));
     }
 
+    TEST_CASE(tan)
+    {
+        const auto v = math::tan(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::tan(1.2)));
+        test_assert(nearly_equal(v[1], math::tan(3.4)));
+        test_assert(nearly_equal(v[2], math::tan(5.6)));
+    }
+
+    TEST_CASE(asin)
+    {
+        const auto v = math::asin(dvec3(0.12, -0.34, 0.56));
+        test_assert(nearly_equal(v[0], math::asin(0.12)));
+        test_assert(nearly_equal(v[1], math::asin(-0.34)));
+        test_assert(nearly_equal(v[2], math::asin(0.56)));
+    }
+
+    TEST_CASE(acos)
+    {
+        const auto v = math::acos(dvec3(0.12, -0.34, 0.56));
+        test_assert(nearly_equal(v[0], math::acos(0.12)));
+        test_assert(nearly_equal(v[1], math::acos(-0.34)));
+        test_assert(nearly_equal(v[2], math::acos(0.56)));
+    }
+
+    TEST_CASE(atan)
+    {
+        const auto v = math::atan(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::atan(1.2)));
+        test_assert(nearly_equal(v[1], math::atan(3.4)));
+        test_assert(nearly_equal(v[2], math::atan(5.6)));
+    }
+
+    TEST_CASE(atan2)
+    {
+        const auto v = math::atan2(
+            dvec3(1.2, 3.4, 5.6), dvec3(-7.8, 9.10, -11.12));
+        test_assert(nearly_equal(v[0], math::atan2(1.2, -7.8)));
+        test_assert(nearly_equal(v[1], math::atan2(3.4, 9.10)));
+        test_assert(nearly_equal(v[2], math::atan2(5.6, -11.12)));
+    }
+
     TEST_CASE(exp)
     {
         const auto v = math::exp(dvec3(1.2, 3.4, 5.6));
@@ -829,6 +870,22 @@ namespace
         test_assert(nearly_equal(v[2], math::log(5.6)));
     }
 
+    TEST_CASE(exp2)
+    {
+        const auto v = math::exp2(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::exp2(1.2)));
+        test_assert(nearly_equal(v[1], math::exp2(3.4)));
+        test_assert(nearly_equal(v[2], math::exp2(5.6)));
+    }
+
+    TEST_CASE(log2)
+    {
+        const auto v = math::log2(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::log2(1.2)));
+        test_assert(nearly_equal(v[1], math::log2(3.4)));
+        test_assert(nearly_equal(v[2], math::log2(5.6)));
+    }
+
     TEST_CASE(abs)
     {
         const auto v = math::abs(dvec3(1.2, -3.4, 5.6));
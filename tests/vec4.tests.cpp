@@ -993,6 +993,52 @@ namespace
         test_assert(nearly_equal(c[3], math::cos(7.8)));
     }
 
+    TEST_CASE(tan)
+    {
+        const auto v = math::tan(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::tan(1.2)));
+        test_assert(nearly_equal(v[1], math::tan(3.4)));
+        test_assert(nearly_equal(v[2], math::tan(5.6)));
+        test_assert(nearly_equal(v[3], math::tan(7.8)));
+    }
+
+    TEST_CASE(asin)
+    {
+        const auto v = math::asin(dvec4(0.12, -0.34, 0.56, -0.78));
+        test_assert(nearly_equal(v[0], math::asin(0.12)));
+        test_assert(nearly_equal(v[1], math::asin(-0.34)));
+        test_assert(nearly_equal(v[2], math::asin(0.56)));
+        test_assert(nearly_equal(v[3], math::asin(-0.78)));
+    }
+
+    TEST_CASE(acos)
+    {
+        const auto v = math::acos(dvec4(0.12, -0.34, 0.56, -0.78));
+        test_assert(nearly_equal(v[0], math::acos(0.12)));
+        test_assert(nearly_equal(v[1], math::acos(-0.34)));
+        test_assert(nearly_equal(v[2], math::acos(0.56)));
+        test_assert(nearly_equal(v[3], math::acos(-0.78)));
+    }
+
+    TEST_CASE(atan)
+    {
+        const auto v = math::atan(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::atan(1.2)));
+        test_assert(nearly_equal(v[1], math::atan(3.4)));
+        test_assert(nearly_equal(v[2], math::atan(5.6)));
+        test_assert(nearly_equal(v[3], math::atan(7.8)));
+    }
+
+    TEST_CASE(atan2)
+    {
+        const auto v = math::atan2(
+            dvec4(1.2, 3.4, 5.6, 7.8), dvec4(-9.10, 11.12, -13.14, 15.16));
+        test_assert(nearly_equal(v[0], math::atan2(1.2, -9.10)));
+        test_assert(nearly_equal(v[1], math::atan2(3.4, 11.12)));
+        test_assert(nearly_equal(v[2], math::atan2(5.6, -13.14)));
+        test_assert(nearly_equal(v[3], math::atan2(7.8, 15.16)));
+    }
+
     TEST_CASE(exp)
     {
         const auto v = math::exp(dvec4(1.2, 3.4, 5.6, 7.8));
@@ -1011,6 +1057,24 @@ namespace
         test_assert(nearly_equal(v[3], math::log(7.8)));
     }
 
+    TEST_CASE(exp2)
+    {
+        const auto v = math::exp2(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::exp2(1.2)));
+        test_assert(nearly_equal(v[1], math::exp2(3.4)));
+        test_assert(nearly_equal(v[2], math::exp2(5.6)));
+        test_assert(nearly_equal(v[3], math::exp2(7.8)));
+    }
+
+    TEST_CASE(log2)
+    {
+        const auto v = math::log2(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::log2(1.2)));
+        test_assert(nearly_equal(v[1], math::log2(3.4)));
+        test_assert(nearly_equal(v[2], math::log2(5.6)));
+        test_assert(nearly_equal(v[3], math::log2(7.8)));
+    }
+
     TEST_CASE(abs)
     {
         const auto v = math::abs(dvec4(1.2, -3.4, 5.6, -7.8));